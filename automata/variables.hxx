@@ -109,7 +109,7 @@ class EventBasedVariable : public EventVariableBase {
 
  private:
   void SetArgs(int client, int offset, int bit) {
-    arg1_ = (0 << 5) | (client & 0b11111);
+    arg1_ = (_VAR_TYPE_EVENT_BIT << 5) | (client & 0b11111);
     arg2_ = (offset << 3) | (bit & 7);
   }
 
@@ -203,7 +203,7 @@ class EventBlock : public EventVariableBase {
   virtual void Render(string* output) {
     CreateEventId(0, event_base_, output);
     HASSERT(size_ < (8 << 8));
-    arg1_ = (1 << 5) | ((size_ >> 8) & 7);
+    arg1_ = (_VAR_TYPE_EVENT_BLOCK << 5) | ((size_ >> 8) & 7);
     arg2_ = size_ & 0xff;
     RenderHelper(output);
   }
@@ -363,7 +363,7 @@ class SignalVariable : public EventVariableBase {
   virtual void Render(string* output) {
     CreateEventId(0, event_base_, output);
     // @TODO(bracz) is 2 a free variable definition type?
-    arg1_ = (2 << 5);  // We have some unused bits here.
+    arg1_ = (_VAR_TYPE_BYTE_BLOCK << 5);  // We have some unused bits here.
     arg2_ = 2;  // size -- number of bytes to export.
     RenderHelper(output);
     // We use local id 30 to import the variable straight away. This will
@@ -379,7 +379,7 @@ class SignalVariable : public EventVariableBase {
 
  private:
   void SetArgs(int client, int offset, int bit) {
-    arg1_ = (0 << 5) | (client & 0b11111);
+    arg1_ = (_VAR_TYPE_EVENT_BIT << 5) | (client & 0b11111);
     arg2_ = (offset << 3) | (bit & 7);
   }
 
@@ -405,7 +405,7 @@ class ByteImportVariable : public EventVariableBase {
 
   virtual void Render(string* output) {
     CreateEventId(0, event_base_, output);
-    arg1_ = (3 << 5);  // Event byte block consumer
+    arg1_ = (_VAR_TYPE_BYTE_BLOCK_CONSUMER << 5);
     arg2_ = 1;  // size -- number of bytes to import.
     RenderHelper(output);
     // We use local id 30 to import the variable straight away. This will
@@ -140,8 +140,24 @@ struct AllTrainNodes::Impl {
     delete train_;
   }
   int id;
-  openlcb::Node* node_ = nullptr;
+  /// Node ID of the train, also while the node is parked.
+  openlcb::NodeID node_id_ = 0;
+  /// Drive mode and address to re-create a parked train with.
+  DccMode mode_;
+  int address_;
+  /// When the node was last accessed (os_get_time_monotonic).
+  long long lastUsed_ = 0;
+  /// nullptr while the train is parked.
+  openlcb::TrainNodeForProxy* node_ = nullptr;
+  /// nullptr while the train is parked.
   openlcb::TrainImpl* train_ = nullptr;
+  /// Highest function number that is kept while the train is parked.
+  static constexpr unsigned MAX_PARKED_FN = 28;
+  /// Functions that were on when the train was parked; bit i is function
+  /// i. Turned back on when the node is created again.
+  uint32_t parkedFns_ = 0;
+  /// Rendered SNIP reply, or empty if not rendered yet.
+  string snip_;
 };
 
 openlcb::TrainImpl* AllTrainNodes::get_train_impl(int id) {
@@ -150,21 +166,17 @@ openlcb::TrainImpl* AllTrainNodes::get_train_impl(int id) {
 }
 
 AllTrainNodes::Impl* AllTrainNodes::find_node(openlcb::Node* node) {
-  for (auto* i : trains_) {
-    if (i->node_ == node) {
-      return i;
-    }
+  if (!node) return nullptr;
+  Impl* impl = trainIndex_.find(node->node_id());
+  if (impl && impl->node_ == node) {
+    impl->lastUsed_ = os_get_time_monotonic();
+    return impl;
   }
   return nullptr;
 }
 
 AllTrainNodes::Impl* AllTrainNodes::find_node(openlcb::NodeID node_id) {
-  for (auto* i : trains_) {
-    if (i->node_->node_id() == node_id) {
-      return i;
-    }
-  }
-  return nullptr;
+  return trainIndex_.find(node_id);
 }
 
 /// Returns a traindb entry or nullptr if the id is too high.
@@ -183,13 +195,54 @@ openlcb::NodeID AllTrainNodes::get_train_node_id(size_t id) {
   return 0;
 }
 
+openlcb::NodeID AllTrainNodes::activate_train_node(size_t id) {
+  if (id >= trains_.size()) return 0;
+  Impl* impl = trains_[id];
+  if (!impl->node_) {
+    materialize(impl);
+  }
+  impl->lastUsed_ = os_get_time_monotonic();
+  return impl->node_id_;
+}
+
+/// @return the part of the SNIP reply that is the same for all trains, up to
+/// the user name.
+static string render_snip_prefix() {
+  string ret;
+  ret.push_back(4);
+  ret.append(openlcb::SNIP_STATIC_DATA.manufacturer_name);
+  ret.push_back(0);
+  ret.append("Virtual train node");
+  ret.push_back(0);
+  // Hardware version.
+  ret.append("n/a");
+  ret.push_back(0);
+  ret.append(openlcb::SNIP_STATIC_DATA.software_version);
+  ret.push_back(0);
+  ret.push_back(2);
+  return ret;
+}
+
+void AllTrainNodes::render_snip(const string& name, string* payload) {
+  static const string prefix = render_snip_prefix();
+  *payload = prefix;
+  payload->append(name, 0, MAX_SNIP_NAME_LENGTH);
+  payload->push_back(0);
+  // User description.
+  payload->append("n/a");
+  payload->push_back(0);
+}
+
+/// Responds to SNIP requests to train nodes. The reply payload of each train
+/// is rendered once and kept in the Impl, so replies need no train database
+/// access, and we do not need to wait for a reply to be sent out before
+/// serving the next request.
 class AllTrainNodes::TrainSnipHandler
     : public openlcb::IncomingMessageStateFlow {
  public:
-  TrainSnipHandler(AllTrainNodes* parent, openlcb::SimpleInfoFlow* info_flow)
+  TrainSnipHandler(AllTrainNodes* parent)
       : IncomingMessageStateFlow(parent->train_service()->iface()),
-        parent_(parent),
-        responseFlow_(info_flow) {
+        parent_(parent) {
     iface()->dispatcher()->register_handler(
         this, openlcb::Defs::MTI_IDENT_INFO_REQUEST, openlcb::Defs::MTI_EXACT);
   }
@@ -202,52 +255,28 @@ class AllTrainNodes::TrainSnipHandler
     // Let's find the train ID.
     impl_ = parent_->find_node(nmsg()->dstNode);
     if (!impl_) return release_and_exit();
-    return allocate_and_call(responseFlow_, STATE(send_response_request));
+    return allocate_and_call(iface()->addressed_message_write_flow(),
+                             STATE(send_response));
   }
 
-  Action send_response_request() {
-    auto* b = get_allocation_result(responseFlow_);
-    auto entry = parent_->db_->get_entry(impl_->id);
-    if (entry.get()) {
-      snipName_ = entry->get_train_name();
-    } else {
-      snipName_.clear();
+  Action send_response() {
+    auto* b = get_allocation_result(iface()->addressed_message_write_flow());
+    if (impl_->snip_.empty()) {
+      auto entry = parent_->db_->get_entry(impl_->id);
+      AllTrainNodes::render_snip(
+          entry.get() ? entry->get_train_name() : string(), &impl_->snip_);
     }
-    snipResponse_[6].data = snipName_.c_str();
-    b->data()->reset(nmsg(), snipResponse_,
-                     openlcb::Defs::MTI_IDENT_INFO_REPLY);
-    // We must wait for the data to be sent out because we have a static member
-    // that we are changing constantly.
-    b->set_done(n_.reset(this));
-    responseFlow_->send(b);
-    release();
-    return wait_and_call(STATE(send_done));
+    b->data()->reset(openlcb::Defs::MTI_IDENT_INFO_REPLY,
+                     nmsg()->dstNode->node_id(), nmsg()->src, impl_->snip_);
+    iface()->addressed_message_write_flow()->send(b);
+    return release_and_exit();
   }
 
-  Action send_done() { return exit(); }
-
  private:
   AllTrainNodes* parent_;
-  openlcb::SimpleInfoFlow* responseFlow_;
   AllTrainNodes::Impl* impl_;
-  BarrierNotifiable n_;
-  string snipName_;
-  static openlcb::SimpleInfoDescriptor snipResponse_[];
 };
 
-openlcb::SimpleInfoDescriptor AllTrainNodes::TrainSnipHandler::snipResponse_[] =
-    {{openlcb::SimpleInfoDescriptor::LITERAL_BYTE, 4, 0, nullptr},
-     {openlcb::SimpleInfoDescriptor::C_STRING, 0, 0,
-      openlcb::SNIP_STATIC_DATA.manufacturer_name},
-     {openlcb::SimpleInfoDescriptor::C_STRING, 41, 0, "Virtual train node"},
-     {openlcb::SimpleInfoDescriptor::C_STRING, 0, 0, "n/a"},
-     {openlcb::SimpleInfoDescriptor::C_STRING, 0, 0,
-      openlcb::SNIP_STATIC_DATA.software_version},
-     {openlcb::SimpleInfoDescriptor::LITERAL_BYTE, 2, 0, nullptr},
-     {openlcb::SimpleInfoDescriptor::C_STRING, 63, 1, nullptr},
-     {openlcb::SimpleInfoDescriptor::C_STRING, 0, 0, "n/a"},
-     {openlcb::SimpleInfoDescriptor::END_OF_DATA, 0, 0, 0}};
-
 class AllTrainNodes::TrainPipHandler
     : public openlcb::IncomingMessageStateFlow {
  public:
@@ -305,6 +334,70 @@ class AllTrainNodes::TrainPipHandler
       openlcb::Defs::TRACTION_FDI | openlcb::Defs::CDI;
 };
 
+/// Creates parked train nodes when someone looks for their alias. Throttles
+/// that remember a train's node ID do this before sending traction commands.
+class AllTrainNodes::TrainVerifyHandler
+    : public openlcb::IncomingMessageStateFlow {
+ public:
+  TrainVerifyHandler(AllTrainNodes* parent)
+      : IncomingMessageStateFlow(parent->train_service()->iface()),
+        parent_(parent) {
+    iface()->dispatcher()->register_handler(
+        this, openlcb::Defs::MTI_VERIFY_NODE_ID_GLOBAL,
+        openlcb::Defs::MTI_EXACT);
+  }
+
+  ~TrainVerifyHandler() {
+    iface()->dispatcher()->unregister_handler(
+        this, openlcb::Defs::MTI_VERIFY_NODE_ID_GLOBAL,
+        openlcb::Defs::MTI_EXACT);
+  }
+
+ private:
+  Action entry() override {
+    if (nmsg()->payload.size() == 6) {
+      Impl* impl =
+          parent_->find_node(openlcb::buffer_to_node_id(nmsg()->payload));
+      if (impl && !impl->node_) {
+        // The new node's initialization complete message answers the
+        // verify request.
+        parent_->materialize(impl);
+      }
+    }
+    return release_and_exit();
+  }
+
+  AllTrainNodes* parent_;
+};
+
+/// Periodically parks the idle train nodes.
+class AllTrainNodes::TrainParker : public StateFlowBase {
+ public:
+  TrainParker(AllTrainNodes* parent)
+      : StateFlowBase(parent->train_service()), parent_(parent), timer_(this) {
+    start_flow(STATE(wait_for_timer));
+  }
+
+  ~TrainParker() {
+    set_terminated();
+    timer_.cancel();
+  }
+
+ private:
+  Action wait_for_timer() {
+    return sleep_and_call(&timer_, parent_->parkTimeoutNsec_ / 2,
+                          STATE(park));
+  }
+
+  Action park() {
+    parent_->park_idle_nodes();
+    return call_immediately(STATE(wait_for_timer));
+  }
+
+  AllTrainNodes* parent_;
+  StateFlowTimer timer_;
+};
+
 class AllTrainNodes::TrainFDISpace : public openlcb::MemorySpace {
  public:
   TrainFDISpace(AllTrainNodes* parent) : parent_(parent) {}
@@ -469,12 +562,18 @@ class AllTrainNodes::TrainNodesUpdater : private DefaultConfigUpdateListener {
 AllTrainNodes::AllTrainNodes(TrainDb* db,
                              openlcb::TrainService* traction_service,
                              openlcb::SimpleInfoFlow* info_flow,
-                             openlcb::MemoryConfigHandler* memory_config)
+                             openlcb::MemoryConfigHandler* memory_config,
+                             long long park_timeout_nsec)
     : AllTrainNodesInterface(traction_service),
       db_(db),
       memoryConfigService_(memory_config),
-      snipHandler_(new TrainSnipHandler(this, info_flow)),
+      parkTimeoutNsec_(park_timeout_nsec),
+      snipHandler_(new TrainSnipHandler(this)),
       pipHandler_(new TrainPipHandler(this)) {
+  if (parkTimeoutNsec_) {
+    verifyHandler_.reset(new TrainVerifyHandler(this));
+    parker_.reset(new TrainParker(this));
+  }
   for (unsigned train_id = 0; train_id < const_lokdb_size; ++train_id) {
     if (!db->is_train_id_known(train_id)) continue;
     auto e = db->get_entry(train_id);
@@ -494,14 +593,31 @@ AllTrainNodes::AllTrainNodes(TrainDb* db,
 }
 
 void AllTrainNodes::update_config() {
+  // Train names might have changed.
+  for (Impl* impl : trains_) {
+    impl->snip_.clear();
+  }
   // First delete all implementations of trains that do not exist anymore.
   for (unsigned id = 0; id < trains_.size(); ++id) {
     Impl* impl = trains_[id];
-    auto entry = db_->find_entry(impl->node_->node_id(), impl->id);
+    auto entry = db_->find_entry(impl->node_id_, impl->id);
     if (entry) continue;
     // Delete current node.
     trains_[id] = nullptr;
-    impl->node_->iface()->delete_local_node(impl->node_);
+    openlcb::NodeID node_id = impl->node_id_;
+    if (trainIndex_.find(node_id) == impl) {
+      trainIndex_.erase(node_id);
+      // Another train database entry might use the same node.
+      for (auto* t : trains_) {
+        if (t && t->node_id_ == node_id) {
+          trainIndex_.insert(node_id, t);
+          break;
+        }
+      }
+    }
+    if (impl->node_) {
+      impl->node_->iface()->delete_local_node(impl->node_);
+    }
     delete impl;
     impl = trains_.back();
     trains_.pop_back();
@@ -528,16 +644,78 @@ void AllTrainNodes::update_config() {
 
 AllTrainNodes::Impl* AllTrainNodes::create_impl(int train_id, DccMode mode,
                                                 int address) {
+  openlcb::TrainImpl* train = create_train(mode, address);
+  if (!train) {
+    return nullptr;
+  }
   Impl* impl = new Impl;
   impl->id = train_id;
+  impl->mode_ = mode;
+  impl->address_ = address;
+  impl->node_id_ = openlcb::TractionDefs::train_node_id_from_legacy(
+      train->legacy_address_type(), train->legacy_address());
+  trains_.push_back(impl);
+  trainIndex_.insert(impl->node_id_, impl);
+  if (parkTimeoutNsec_) {
+    // The node will be created when it is first needed.
+    delete train;
+    return impl;
+  }
+  impl->train_ = train;
+  impl->node_ = new openlcb::TrainNodeForProxy(train_service(), impl->train_);
+  return impl;
+}
+
+void AllTrainNodes::materialize(Impl* impl) {
+  impl->train_ = create_train(impl->mode_, impl->address_);
+  HASSERT(impl->train_);
+  for (unsigned fn = 0; fn <= Impl::MAX_PARKED_FN; ++fn) {
+    if (impl->parkedFns_ & (1u << fn)) {
+      impl->train_->set_fn(fn, 1);
+    }
+  }
+  impl->parkedFns_ = 0;
+  impl->node_ = new openlcb::TrainNodeForProxy(train_service(), impl->train_);
+  impl->lastUsed_ = os_get_time_monotonic();
+}
+
+void AllTrainNodes::park_idle_nodes() {
+  long long now = os_get_time_monotonic();
+  for (Impl* impl : trains_) {
+    if (!impl->node_ || !impl->node_->is_initialized()) continue;
+    auto ctrl = impl->node_->get_controller();
+    if (ctrl.id || ctrl.alias || impl->node_->query_consist_length() > 0 ||
+        static_cast<int>(impl->train_->get_speed().mph() + 0.5) != 0) {
+      // In use.
+      impl->lastUsed_ = now;
+      continue;
+    }
+    if (now - impl->lastUsed_ < parkTimeoutNsec_) continue;
+    // Lights and sounds stay on when the train comes back.
+    impl->parkedFns_ = 0;
+    for (unsigned fn = 0; fn <= Impl::MAX_PARKED_FN; ++fn) {
+      if (impl->train_->get_fn(fn)) {
+        impl->parkedFns_ |= 1u << fn;
+      }
+    }
+    impl->node_->iface()->delete_local_node(impl->node_);
+    delete impl->node_;
+    impl->node_ = nullptr;
+    delete impl->train_;
+    impl->train_ = nullptr;
+    impl->snip_.clear();
+  }
+}
+
+openlcb::TrainImpl* AllTrainNodes::create_train(DccMode mode, int address) {
+  openlcb::TrainImpl* train = nullptr;
 #ifdef __EMSCRIPTEN__
   switch (mode) {
     case MARKLIN_OLD:
     case MARKLIN_DEFAULT:
     case MARKLIN_NEW:
     case MARKLIN_TWOADDR:
-      impl->train_ =
-          new openlcb::LoggingTrain(address, dcc::TrainAddressType::MM);
+      train = new openlcb::LoggingTrain(address, dcc::TrainAddressType::MM);
       break;
     case DCC_14:      
     case DCC_14_LONG_ADDRESS:      
@@ -546,29 +724,29 @@ AllTrainNodes::Impl* AllTrainNodes::create_impl(int train_id, DccMode mode,
     case DCC_128:
     case DCC_128_LONG_ADDRESS:
       if ((mode & DCC_LONG_ADDRESS) || address >= 128) {
-        impl->train_ =
+        train =
             new openlcb::LoggingTrain(address, dcc::TrainAddressType::DCC_LONG_ADDRESS);
       } else {
-        impl->train_ =
+        train =
             new openlcb::LoggingTrain(address, dcc::TrainAddressType::DCC_SHORT_ADDRESS);
       }
       break;
     default:
-      impl->train_ = new openlcb::LoggingTrain(
+      train = new openlcb::LoggingTrain(
           address, dcc::TrainAddressType::DCC_LONG_ADDRESS);
       break;
     };
 #else  
   switch (mode) {
     case MARKLIN_OLD: {
-      impl->train_ = new dcc::MMOldTrain(dcc::MMAddress(address));
+      train = new dcc::MMOldTrain(dcc::MMAddress(address));
       break;
     }
     case MARKLIN_DEFAULT:
     case MARKLIN_NEW:
       /// @todo (balazs.racz) implement marklin twoaddr train drive mode.
     case MARKLIN_TWOADDR: {
-      impl->train_ = new dcc::MMNewTrain(dcc::MMAddress(address));
+      train = new dcc::MMNewTrain(dcc::MMAddress(address));
       break;
     }
       /// @todo (balazs.racz) implement dcc 14 train drive mode.
@@ -577,48 +755,44 @@ AllTrainNodes::Impl* AllTrainNodes::create_impl(int train_id, DccMode mode,
     case DCC_28:
     case DCC_28_LONG_ADDRESS: {
       if ((mode & DCC_LONG_ADDRESS) || address >= 128) {
-        impl->train_ = new dcc::Dcc28Train(dcc::DccLongAddress(address));
+        train = new dcc::Dcc28Train(dcc::DccLongAddress(address));
       } else {
-        impl->train_ = new dcc::Dcc28Train(dcc::DccShortAddress(address));
+        train = new dcc::Dcc28Train(dcc::DccShortAddress(address));
       }
       break;
     }
     case DCC_128:
     case DCC_128_LONG_ADDRESS: {
       if ((mode & DCC_LONG_ADDRESS) || address >= 128) {
-        impl->train_ = new dcc::Dcc128Train(dcc::DccLongAddress(address));
+        train = new dcc::Dcc128Train(dcc::DccLongAddress(address));
       } else {
-        impl->train_ = new dcc::Dcc128Train(dcc::DccShortAddress(address));
+        train = new dcc::Dcc128Train(dcc::DccShortAddress(address));
       }
       break;
     }
 #ifndef __FreeRTOS__
     case DCCMODE_FAKE_DRIVE: {
-      impl->train_ = new openlcb::LoggingTrain(address);
+      train = new openlcb::LoggingTrain(address);
       break;
     }
 #endif
     default:
-      impl->train_ = nullptr;
+      train = nullptr;
       LOG_ERROR("Unhandled train drive mode.");
   }
 #endif  
-  if (impl->train_) {
-    trains_.push_back(impl);
-    impl->node_ = new openlcb::TrainNodeForProxy(train_service(), impl->train_);
-    return impl;
-  } else {
-    delete impl;
-    return nullptr;
-  }
+  return train;
 }
 
 openlcb::NodeID AllTrainNodes::allocate_node(DccMode drive_type,
                                              unsigned address) {
   Impl* impl = create_impl(-1, drive_type, address);
   if (!impl) return 0; // failed.
+  if (!impl->node_) {
+    materialize(impl);
+  }
   impl->id = db_->add_dynamic_entry(new DccTrainDbEntry(address, drive_type));
-  return impl->node_->node_id();
+  return impl->node_id_;
 }
 
 // For testing.
@@ -627,6 +801,8 @@ bool AllTrainNodes::find_flow_is_idle() {
 }
 
 AllTrainNodes::~AllTrainNodes() {
+  parker_.reset();
+  verifyHandler_.reset();
   for (auto* t : trains_) {
     delete t;
   }
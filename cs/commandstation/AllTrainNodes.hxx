@@ -39,6 +39,7 @@
 #include <vector>
 
 #include "commandstation/AllTrainNodesInterface.hxx"
+#include "commandstation/NodeIdIndex.hxx"
 #include "commandstation/TrainDb.hxx"
 //#include "openlcb/SimpleInfoProtocol.hxx"
 
@@ -55,9 +56,16 @@ class FindProtocolServer;
 
 class AllTrainNodes : public AllTrainNodesInterface {
  public:
+  /// Constructor.
+  /// @param info_flow is not used anymore; SNIP replies are sent directly.
+  /// @param park_timeout_nsec if zero, every train in the database gets a
+  /// node on the bus at startup. Otherwise train nodes are only created when
+  /// they are first needed (find protocol match, verify node ID, allocate),
+  /// and nodes that were idle for this long are removed from the bus again.
   AllTrainNodes(TrainDb* db, openlcb::TrainService* traction_service,
                 openlcb::SimpleInfoFlow* info_flow,
-                openlcb::MemoryConfigHandler* memory_config);
+                openlcb::MemoryConfigHandler* memory_config,
+                long long park_timeout_nsec = 0);
   ~AllTrainNodes();
 
   // Used for debugging purposes
@@ -70,6 +78,9 @@ class AllTrainNodes : public AllTrainNodesInterface {
   /// Returns a node id or 0 if the id is not known to be a train.
   openlcb::NodeID get_train_node_id(size_t id) override;
 
+  /// Creates the train node if it is parked.
+  openlcb::NodeID activate_train_node(size_t id) override;
+
   /// Creates a new train node based on the given address and drive mode.
   /// @param drive_type describes what kind of train node this should be
   /// @param address is the hardware (legacy) address
@@ -81,6 +92,15 @@ class AllTrainNodes : public AllTrainNodesInterface {
   // For testing.
   bool find_flow_is_idle();
 
+  /// Maximum length of the user name field in the SNIP reply of a train,
+  /// without the terminating zero.
+  static constexpr unsigned MAX_SNIP_NAME_LENGTH = 62;
+
+  /// Renders the SNIP reply payload of a train node. Public for testing.
+  /// @param name the train's name; truncated to MAX_SNIP_NAME_LENGTH.
+  /// @param payload will be filled with the reply.
+  static void render_snip(const string& name, string* payload);
+
  private:
   // ==== Interface for children ====
   struct Impl;
@@ -92,9 +112,20 @@ class AllTrainNodes : public AllTrainNodesInterface {
   Impl* find_node(openlcb::NodeID node_id);
 
   /// Helper function to create lok objects. Adds a new Impl structure to
-  /// impl_.
+  /// impl_. When parking is enabled, the node is not created yet.
   Impl* create_impl(int train_id, DccMode mode, int address);
 
+  /// Creates the train implementation for a given drive mode.
+  /// @return nullptr if the drive mode is not supported.
+  static openlcb::TrainImpl* create_train(DccMode mode, int address);
+
+  /// Creates the train object and node of a parked train.
+  void materialize(Impl* impl);
+
+  /// Removes the nodes from the bus that are not used by any throttle and
+  /// were not accessed for parkTimeoutNsec_.
+  void park_idle_nodes();
+
   /// Callback from the updater to notify that the traindb config should be
   /// consulted.
   void update_config();
@@ -102,9 +133,14 @@ class AllTrainNodes : public AllTrainNodesInterface {
   // Externally owned.
   TrainDb* db_;
   openlcb::MemoryConfigHandler* memoryConfigService_;
+  /// Idle time after which train nodes are parked, or 0 if parking is off.
+  long long parkTimeoutNsec_;
 
   /// All train nodes that we know about.
   std::vector<Impl*> trains_;
+  /// Looks up the entries of trains_ by node ID. Must be updated together
+  /// with trains_.
+  NodeIdIndex<Impl> trainIndex_;
 
   friend class FindProtocolServer;
   std::unique_ptr<FindProtocolServer> findProtocolServer_;
@@ -123,6 +159,14 @@ class AllTrainNodes : public AllTrainNodesInterface {
   class TrainPipHandler;
   friend class TrainPipHandler;
   std::unique_ptr<TrainPipHandler> pipHandler_;
+
+  class TrainVerifyHandler;
+  friend class TrainVerifyHandler;
+  std::unique_ptr<TrainVerifyHandler> verifyHandler_;
+
+  class TrainParker;
+  friend class TrainParker;
+  std::unique_ptr<TrainParker> parker_;
   
   class TrainFDISpace;
   friend class TrainFDISpace;
@@ -81,10 +81,20 @@ class AllTrainNodesInterface : public Destructable {
                                                           Notifiable* done) = 0;
 
   /// @return the openlcb train node ID for a given train index, or 0 if
-  /// the train index is not valid.
+  /// the train index is not valid or the train node is not currently present
+  /// on the bus.
   /// @param index 0..size() - 1.
   virtual openlcb::NodeID get_train_node_id(size_t index) = 0;
 
+  /// Makes sure that the train node for a given train index is present on the
+  /// bus, creating it if needed. The node might need some time to finish
+  /// initialization before it can send messages.
+  /// @return the openlcb train node ID, or 0 if the train index is not valid.
+  /// @param index 0..size() - 1.
+  virtual openlcb::NodeID activate_train_node(size_t index) {
+    return get_train_node_id(index);
+  }
+
   /// Allocates a new legacy train node.
   /// @param mode which protocol mode to use.
   /// @param address legacy address (to be interpreted for the given protocol
@@ -0,0 +1,236 @@
+/** \copyright
+ * Copyright (c) 2026, Balazs Racz
+ * All rights reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are strictly prohibited without written consent.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \file DecoderCvCache.cxx
+ *
+ * Remembers CV values read from or written to decoders, and persists
+ * them in a file.
+ *
+ * @author Balazs Racz
+ * @date 19 Oct 2026
+ */
+
+#include "commandstation/DecoderCvCache.hxx"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include "utils/logging.h"
+
+namespace commandstation {
+
+/// Start of the persistence file.
+static const char CACHE_FILE_MAGIC[] = "DCV1";
+/// Length of the magic (without terminating zero).
+static constexpr unsigned CACHE_FILE_MAGIC_LEN = 4;
+
+/// Appends a little-endian integer to a string.
+static void append_le(std::string *s, uint32_t value, unsigned bytes) {
+  for (unsigned i = 0; i < bytes; ++i) {
+    s->push_back(value & 0xff);
+    value >>= 8;
+  }
+}
+
+/// Reads a little-endian integer from a string.
+/// @param ofs offset to read from; advanced past the integer.
+/// @param value output.
+/// @return false if there is not enough data.
+static bool parse_le(const std::string &s, size_t *ofs, unsigned bytes,
+                     uint32_t *value) {
+  if (*ofs + bytes > s.size()) {
+    return false;
+  }
+  *value = 0;
+  for (unsigned i = 0; i < bytes; ++i) {
+    *value |= uint32_t(uint8_t(s[*ofs + i])) << (8 * i);
+  }
+  *ofs += bytes;
+  return true;
+}
+
+DecoderCvCache::DecoderCvCache(const char *path) {
+  if (!path) {
+    return;
+  }
+  path_ = path;
+  int fd = ::open(path, O_RDONLY);
+  if (fd < 0) {
+    return;
+  }
+  std::string data;
+  char buf[256];
+  ssize_t ret;
+  while ((ret = ::read(fd, buf, sizeof(buf))) > 0) {
+    data.append(buf, ret);
+  }
+  ::close(fd);
+  if (!parse(data)) {
+    LOG(WARNING, "CV cache file %s is malformed, ignoring.", path);
+    profiles_.clear();
+  }
+}
+
+DecoderCvCache::Profile *DecoderCvCache::get(dcc::TrainAddressType type,
+                                             uint16_t address) {
+  return &profiles_[key(type, address)];
+}
+
+bool DecoderCvCache::lookup(Profile *p, unsigned cv, uint8_t *value) {
+  if (!p->identified_) {
+    return false;
+  }
+  auto it = p->values_.find(cv);
+  if (it == p->values_.end()) {
+    return false;
+  }
+  *value = it->second;
+  return true;
+}
+
+void DecoderCvCache::store(Profile *p, unsigned cv, uint8_t value) {
+  if (!p->identified_) {
+    return;
+  }
+  auto it = p->values_.find(cv);
+  if (it != p->values_.end() && it->second == value) {
+    return;
+  }
+  p->values_[cv] = value;
+  dirty_ = true;
+}
+
+void DecoderCvCache::invalidate(Profile *p, unsigned cv) {
+  if (p->values_.erase(cv)) {
+    dirty_ = true;
+  }
+}
+
+void DecoderCvCache::clear(Profile *p) {
+  p->values_.clear();
+  p->hasIdentity_ = false;
+  p->identified_ = false;
+  dirty_ = true;
+}
+
+void DecoderCvCache::clear_all() {
+  profiles_.clear();
+  dirty_ = true;
+}
+
+bool DecoderCvCache::identify(Profile *p, uint8_t manufacturer,
+                              uint8_t version) {
+  bool kept = true;
+  if (!p->hasIdentity_ || p->manufacturer_ != manufacturer ||
+      p->version_ != version) {
+    kept = p->values_.empty();
+    p->values_.clear();
+    p->hasIdentity_ = true;
+    p->manufacturer_ = manufacturer;
+    p->version_ = version;
+    dirty_ = true;
+  }
+  p->identified_ = true;
+  store(p, CV_MANUFACTURER, manufacturer);
+  store(p, CV_VERSION, version);
+  return kept;
+}
+
+bool DecoderCvCache::flush() {
+  if (!dirty_ || path_.empty()) {
+    return true;
+  }
+  std::string data = serialize();
+  // Writes a new file and renames it, so that a power loss does not leave a
+  // truncated cache behind.
+  std::string tmp_path = path_ + ".tmp";
+  int fd = ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    LOG(WARNING, "Could not write CV cache file %s.", tmp_path.c_str());
+    return false;
+  }
+  size_t ofs = 0;
+  while (ofs < data.size()) {
+    ssize_t ret = ::write(fd, data.data() + ofs, data.size() - ofs);
+    if (ret <= 0) {
+      ::close(fd);
+      return false;
+    }
+    ofs += ret;
+  }
+  ::close(fd);
+  if (::rename(tmp_path.c_str(), path_.c_str()) != 0) {
+    return false;
+  }
+  dirty_ = false;
+  return true;
+}
+
+std::string DecoderCvCache::serialize() {
+  std::string ret(CACHE_FILE_MAGIC, CACHE_FILE_MAGIC_LEN);
+  for (const auto &kv : profiles_) {
+    const Profile &p = kv.second;
+    if (!p.hasIdentity_ && p.values_.empty()) {
+      continue;
+    }
+    append_le(&ret, kv.first, 4);
+    append_le(&ret, p.hasIdentity_ ? 1 : 0, 1);
+    append_le(&ret, p.manufacturer_, 1);
+    append_le(&ret, p.version_, 1);
+    append_le(&ret, p.values_.size(), 2);
+    for (const auto &cv : p.values_) {
+      append_le(&ret, cv.first, 2);
+      append_le(&ret, cv.second, 1);
+    }
+  }
+  return ret;
+}
+
+bool DecoderCvCache::parse(const std::string &data) {
+  if (data.compare(0, CACHE_FILE_MAGIC_LEN, CACHE_FILE_MAGIC) != 0) {
+    return false;
+  }
+  size_t ofs = CACHE_FILE_MAGIC_LEN;
+  while (ofs < data.size()) {
+    uint32_t k, has_identity, manufacturer, version, count;
+    if (!parse_le(data, &ofs, 4, &k) ||
+        !parse_le(data, &ofs, 1, &has_identity) ||
+        !parse_le(data, &ofs, 1, &manufacturer) ||
+        !parse_le(data, &ofs, 1, &version) ||
+        !parse_le(data, &ofs, 2, &count)) {
+      return false;
+    }
+    Profile &p = profiles_[k];
+    p.hasIdentity_ = has_identity != 0;
+    p.identified_ = false;
+    p.manufacturer_ = manufacturer;
+    p.version_ = version;
+    for (unsigned i = 0; i < count; ++i) {
+      uint32_t cv, value;
+      if (!parse_le(data, &ofs, 2, &cv) || !parse_le(data, &ofs, 1, &value)) {
+        return false;
+      }
+      p.values_[cv] = value;
+    }
+  }
+  return true;
+}
+
+}  // namespace commandstation
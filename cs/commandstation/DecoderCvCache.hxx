@@ -0,0 +1,153 @@
+/** \copyright
+ * Copyright (c) 2026, Balazs Racz
+ * All rights reserved
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are strictly prohibited without written consent.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \file DecoderCvCache.hxx
+ *
+ * Remembers CV values read from or written to decoders.
+ *
+ * @author Balazs Racz
+ * @date 19 Oct 2026
+ */
+
+#ifndef _COMMANDSTATION_DECODERCVCACHE_HXX_
+#define _COMMANDSTATION_DECODERCVCACHE_HXX_
+
+#include <stdint.h>
+
+#include <map>
+#include <string>
+
+#include "dcc/Defs.hxx"
+
+namespace commandstation {
+
+/// Remembers CV values of decoders, so that repeated reads do not need to go
+/// to the track.
+///
+/// Values are kept in profiles, one per decoder address, plus one for
+/// whatever decoder is on the programming track. Each profile remembers the
+/// manufacturer (CV8) and version (CV7) of the decoder it was filled from.
+/// A profile only serves values after identify() was called with the
+/// decoder's current CV8 and CV7; if those differ from the remembered ones,
+/// the values are dropped.
+class DecoderCvCache {
+ public:
+  /// CV number of the manufacturer ID.
+  static constexpr unsigned CV_MANUFACTURER = 8;
+  /// CV number of the decoder version.
+  static constexpr unsigned CV_VERSION = 7;
+
+  /// Cached values of one decoder.
+  class Profile {
+   public:
+    /// @return true if the profile was identified since it was loaded or
+    /// the identification was revoked.
+    bool is_identified() const {
+      return identified_;
+    }
+
+    /// @return number of cached CVs.
+    size_t size() const {
+      return values_.size();
+    }
+
+   private:
+    friend class DecoderCvCache;
+
+    /// 1 if manufacturer_ and version_ are valid.
+    bool hasIdentity_{false};
+    /// 1 if the identity was confirmed with the decoder.
+    bool identified_{false};
+    uint8_t manufacturer_{0};
+    uint8_t version_{0};
+    /// CV number (1-based) -> value.
+    std::map<uint16_t, uint8_t> values_;
+  };
+
+  /// Constructor.
+  /// @param path file to persist the cache in, or nullptr to keep it in
+  /// memory only. If the file exists, its contents are loaded.
+  DecoderCvCache(const char *path = nullptr);
+
+  /// Finds the profile for a decoder, creating an empty one if needed.
+  /// @param type address type for POM, or UNSPECIFIED for the programming
+  /// track.
+  /// @param address the decoder address (0 for the programming track).
+  /// @return the profile, owned by the cache.
+  Profile *get(dcc::TrainAddressType type, uint16_t address);
+
+  /// Looks up a value. Fails if the profile is not identified.
+  /// @param p the decoder's profile.
+  /// @param cv 1-based CV number.
+  /// @param value will be filled with the cached value on success.
+  /// @return true if the value was found.
+  bool lookup(Profile *p, unsigned cv, uint8_t *value);
+
+  /// Remembers a value read from or written to the decoder. Ignored if the
+  /// profile is not identified.
+  void store(Profile *p, unsigned cv, uint8_t value);
+
+  /// Forgets the value of one CV.
+  void invalidate(Profile *p, unsigned cv);
+
+  /// Forgets all values and the identity of a decoder.
+  void clear(Profile *p);
+
+  /// Forgets all values of all decoders.
+  void clear_all();
+
+  /// Records the manufacturer and version of the decoder, as read from the
+  /// track.
+  /// @return true if the cached values were kept, false if they were
+  /// dropped because the decoder is not the one they came from.
+  bool identify(Profile *p, uint8_t manufacturer, uint8_t version);
+
+  /// Requires a new identify() call before the profile serves values again.
+  /// Use this when the decoder might have been replaced.
+  void unidentify(Profile *p) {
+    p->identified_ = false;
+  }
+
+  /// Writes the cache to the file if it has changed since the last flush.
+  /// @return false if writing the file failed.
+  bool flush();
+
+ private:
+  /// @return the map key of a profile.
+  static uint32_t key(dcc::TrainAddressType type, uint16_t address) {
+    return (uint32_t(type) << 16) | address;
+  }
+
+  /// Serializes all profiles.
+  std::string serialize();
+  /// Parses serialized profiles. Loaded profiles are not identified.
+  /// @return false if the data is malformed.
+  bool parse(const std::string &data);
+
+  /// Persistence file, or empty.
+  std::string path_;
+  /// All decoders we know about.
+  std::map<uint32_t, Profile> profiles_;
+  /// True if the contents changed since the last flush.
+  bool dirty_{false};
+};
+
+}  // namespace commandstation
+
+#endif  // _COMMANDSTATION_DECODERCVCACHE_HXX_
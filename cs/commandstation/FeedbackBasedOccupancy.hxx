@@ -36,41 +36,140 @@
 #ifndef _BRACZ_COMMANDSTATION_FEEDBACKBASEDOCCUPANCY_HXX_
 #define _BRACZ_COMMANDSTATION_FEEDBACKBASEDOCCUPANCY_HXX_
 
-#include "openlcb/EventHandlerTemplates.hxx"
 #include "dcc/RailcomHub.hxx"
+#include "executor/Timer.hxx"
+#include "openlcb/EventHandlerTemplates.hxx"
+#include "os/os.h"
 
 namespace commandstation {
 
+/// Listens to the occupancy bits reported by the booster on the railcom hub
+/// (channel 0xff), and turns every change into an event report. All channels
+/// that changed in one message are reported together. Optionally a channel
+/// has to keep its new value for a hold time before the change is reported.
 class FeedbackBasedOccupancy : public dcc::RailcomHubPort {
  public:
-    FeedbackBasedOccupancy(openlcb::Node* node, uint64_t event_base,
-                         unsigned channel_count)
+  /// Constructor.
+  /// @param node the node to send the event reports from.
+  /// @param event_base the event for channel 0 occupied; channel i uses
+  /// event_base + 2 * i for occupied and event_base + 2 * i + 1 for free.
+  /// @param channel_count how many channels there are (at most 32).
+  /// @param hold_msec if nonzero, a change is only reported after the channel
+  /// kept its new value for this long.
+  FeedbackBasedOccupancy(openlcb::Node* node, uint64_t event_base,
+                         unsigned channel_count, unsigned hold_msec = 0)
       : dcc::RailcomHubPort(node->iface()),
-        currentValues_(0),
-        eventHandler_(node, event_base, &currentValues_, channel_count) {}
+        node_(node),
+        eventBase_(event_base),
+        holdNsec_(MSEC_TO_NSEC(hold_msec)),
+        eventHandler_(node, event_base, &currentValues_, channel_count),
+        timer_(this) {}
 
   Action entry() override {
     if (message()->data()->channel != 0xff) return release_and_exit();
     uint32_t new_values = message()->data()->ch1Data[0];
     release();
-    if (new_values == currentValues_) return exit();
-    unsigned bit = 1;
-    unsigned ofs = 0;
-    uint32_t diff = new_values ^ currentValues_;
-    while (bit && ((diff & bit) == 0)) {
-      bit <<= 1;
-      ofs++;
+    if (holdNsec_) {
+      // Channels whose raw value moved restart their hold time.
+      long long now = os_get_time_monotonic();
+      uint32_t restart =
+          (new_values ^ rawValues_) & (new_values ^ currentValues_);
+      for (uint32_t bits = restart; bits; bits &= bits - 1) {
+        changeTime_[__builtin_ctz(bits)] = now;
+      }
     }
-    eventHandler_.Set(ofs, (new_values & bit), &h_, n_.reset(this));
+    rawValues_ = new_values;
+    return call_immediately(STATE(report_changes));
+  }
+
+  /// Sends an event report for every channel that needs to be reported, all
+  /// at once, and waits for them to be sent.
+  Action report_changes() {
+    uint32_t diff = rawValues_ ^ currentValues_;
+    if (holdNsec_) {
+      diff = stable_channels(diff);
+    }
+    if (!diff) return exit();
+    auto* flow = node_->iface()->global_message_write_flow();
+    n_.reset(this);
+    for (; diff; diff &= diff - 1) {
+      unsigned ofs = __builtin_ctz(diff);
+      uint32_t mask = 1u << ofs;
+      currentValues_ ^= mask;
+      uint64_t event = eventBase_ + ofs * 2;
+      if (!(currentValues_ & mask)) ++event;
+      auto* b = flow->alloc();
+      b->data()->reset(openlcb::Defs::MTI_EVENT_REPORT, node_->node_id(),
+                       openlcb::eventid_to_buffer(event));
+      b->set_done(n_.new_child());
+      flow->send(b);
+    }
+    n_.notify();
     return wait_and_call(STATE(set_done));
   }
 
   Action set_done() { return exit(); }
 
  private:
-  uint32_t currentValues_;
+  /// Wakes up the flow when a held change might be due.
+  class HoldTimer : public ::Timer {
+   public:
+    HoldTimer(FeedbackBasedOccupancy* parent)
+        : ::Timer(parent->node_->iface()->executor()->active_timers()),
+          parent_(parent) {}
+
+    long long timeout() override {
+      parent_->timerRunning_ = false;
+      // Re-evaluates the last known values as if they arrived again.
+      auto* b = parent_->alloc();
+      b->data()->reset(0);
+      b->data()->channel = 0xff;
+      b->data()->ch1Data[0] = parent_->rawValues_;
+      b->data()->ch1Size = 1;
+      parent_->send(b);
+      return NONE;
+    }
+
+   private:
+    FeedbackBasedOccupancy* parent_;
+  };
+
+  /// @param diff channels whose value differs from the reported one.
+  /// @return the subset of diff that kept its value for the hold time. Starts
+  /// the timer for the rest.
+  uint32_t stable_channels(uint32_t diff) {
+    long long now = os_get_time_monotonic();
+    uint32_t stable = 0;
+    long long next_due = 0;
+    for (uint32_t bits = diff; bits; bits &= bits - 1) {
+      unsigned ofs = __builtin_ctz(bits);
+      long long due = changeTime_[ofs] + holdNsec_;
+      if (due <= now) {
+        stable |= 1u << ofs;
+      } else if (!next_due || due < next_due) {
+        next_due = due;
+      }
+    }
+    if (next_due && !timerRunning_) {
+      timerRunning_ = true;
+      timer_.start(next_due - now);
+    }
+    return stable;
+  }
+
+  openlcb::Node* node_;
+  uint64_t eventBase_;
+  /// Debouncing time, 0 if disabled.
+  long long holdNsec_;
+  /// Values as reported to the bus.
+  uint32_t currentValues_{0};
+  /// Values as last received from the booster.
+  uint32_t rawValues_{0};
+  /// When each channel last changed its raw value (only with hold time).
+  long long changeTime_[32] = {0};
+  bool timerRunning_{false};
   openlcb::BitRangeEventPC eventHandler_;
-  openlcb::WriteHelper h_;
+  HoldTimer timer_;
   BarrierNotifiable n_;
 };
 
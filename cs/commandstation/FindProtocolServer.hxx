@@ -139,6 +139,9 @@ class FindProtocolServer : public openlcb::SimpleEventHandler {
     USER_ARG_FIND = 1,
     USER_ARG_ISTRAIN = 2,
   };
+  /// How long we wait for a train node to finish initializing before we give
+  /// up sending a response from it.
+  static constexpr long long NODE_INIT_TIMEOUT_NSEC = SEC_TO_NSEC(2);
   struct Request {
     void reset(openlcb::EventId event, openlcb::NodeHandle src) {
       event_ = event;
@@ -293,12 +296,30 @@ class FindProtocolServer : public openlcb::SimpleEventHandler {
       if (!db_entry) return call_immediately(STATE(next_iterate));
       if (FindProtocolDefs::match_query_to_node(eventId_, db_entry.get())) {
         hasMatches_ = true;
-        return allocate_and_call(iface()->global_message_write_flow(),
-                                 STATE(send_response));
+        initDeadline_ = os_get_time_monotonic() + NODE_INIT_TIMEOUT_NSEC;
+        return call_immediately(STATE(activate_match));
       }
       return yield_and_call(STATE(next_iterate));
     }
 
+    /// Makes sure the matching train node is present on the bus (it might
+    /// have been parked), and waits until it may send the response.
+    Action activate_match() {
+      auto node_id = nodes()->activate_train_node(nextTrainId_);
+      openlcb::Node *n =
+          node_id ? iface()->lookup_local_node(node_id) : nullptr;
+      if (n && !n->is_initialized()) {
+        if (os_get_time_monotonic() > initDeadline_) {
+          LOG(WARNING, "Train node %u did not initialize; no find response.",
+              nextTrainId_);
+          return call_immediately(STATE(next_iterate));
+        }
+        return sleep_and_call(&timer_, MSEC_TO_NSEC(1), STATE(activate_match));
+      }
+      return allocate_and_call(iface()->global_message_write_flow(),
+                               STATE(send_response));
+    }
+
     Action send_response() {
       auto *b = get_allocation_result(iface()->global_message_write_flow());
       auto node_id = nodes()->get_train_node_id(nextTrainId_);
@@ -355,6 +376,7 @@ class FindProtocolServer : public openlcb::SimpleEventHandler {
               (int)mode, (int)address);
           return release_and_exit();
         }
+        initDeadline_ = os_get_time_monotonic() + NODE_INIT_TIMEOUT_NSEC;
         return call_immediately(STATE(wait_for_new_node));
       }
       return release_and_exit();
@@ -367,6 +389,9 @@ class FindProtocolServer : public openlcb::SimpleEventHandler {
       HASSERT(n);
       if (n->is_initialized()) {
         return call_immediately(STATE(new_node_reply));
+      } else if (os_get_time_monotonic() > initDeadline_) {
+        LOG(WARNING, "New train node did not initialize; no find response.");
+        return release_and_exit();
       } else {
         return sleep_and_call(&timer_, MSEC_TO_NSEC(1), STATE(wait_for_new_node));
       }
@@ -396,6 +421,9 @@ class FindProtocolServer : public openlcb::SimpleEventHandler {
       openlcb::NodeID newNodeId_;
     };
     BarrierNotifiable bn_;
+    /// Time (os_get_time_monotonic) after which we stop waiting for a train
+    /// node to initialize.
+    long long initDeadline_;
     /// True if we found any matches during the iteration.
     bool hasMatches_ : 1;
     /// True if the current iteration has to touch every node.
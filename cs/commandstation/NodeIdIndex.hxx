@@ -0,0 +1,176 @@
+/** \copyright
+ * Copyright (c) 2018, Balazs Racz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are met:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ *  - Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \file NodeIdIndex.hxx
+ *
+ * Open-addressed hash index from node IDs to objects.
+ *
+ * @author Balazs Racz
+ * @date 9 June 2018
+ */
+
+#ifndef _COMMANDSTATION_NODEIDINDEX_HXX_
+#define _COMMANDSTATION_NODEIDINDEX_HXX_
+
+#include <stdint.h>
+
+#include <vector>
+
+namespace commandstation {
+
+/// Maps 48-bit node IDs to (not owned) object pointers. Uses linear probing
+/// with backward-shift deletion, so there are no tombstones and lookups stay
+/// short after many insert/erase cycles. Node ID zero cannot be stored.
+template <class T> class NodeIdIndex {
+ public:
+  /// Adds an entry.
+  /// @param id node ID, must not be zero.
+  /// @param value object to return for this ID.
+  /// @return false if the ID was already present; the existing entry is
+  /// kept in this case.
+  bool insert(uint64_t id, T *value) {
+    if (!id) {
+      return false;
+    }
+    if ((size_ + 1) * 2 > slots_.size()) {
+      rehash(slots_.empty() ? MIN_SLOTS : slots_.size() * 2);
+    }
+    unsigned i = home(id);
+    while (slots_[i].id_) {
+      if (slots_[i].id_ == id) {
+        return false;
+      }
+      i = (i + 1) & mask();
+    }
+    slots_[i].id_ = id;
+    slots_[i].value_ = value;
+    ++size_;
+    return true;
+  }
+
+  /// @return the object stored for id, or nullptr if not found.
+  T *find(uint64_t id) const {
+    if (!id || slots_.empty()) {
+      return nullptr;
+    }
+    for (unsigned i = home(id); slots_[i].id_; i = (i + 1) & mask()) {
+      if (slots_[i].id_ == id) {
+        return slots_[i].value_;
+      }
+    }
+    return nullptr;
+  }
+
+  /// Removes an entry.
+  /// @return false if the ID was not present.
+  bool erase(uint64_t id) {
+    if (!id || slots_.empty()) {
+      return false;
+    }
+    unsigned i = home(id);
+    while (slots_[i].id_ != id) {
+      if (!slots_[i].id_) {
+        return false;
+      }
+      i = (i + 1) & mask();
+    }
+    // Moves back later entries of the probe chain that could not be placed
+    // into the freed slot at insertion time.
+    unsigned j = i;
+    while (true) {
+      j = (j + 1) & mask();
+      if (!slots_[j].id_) {
+        break;
+      }
+      unsigned h = home(slots_[j].id_);
+      // Distance from the home slot; the entry may move to i only if i is
+      // not before its home slot.
+      if (((j - h) & mask()) >= ((j - i) & mask())) {
+        slots_[i] = slots_[j];
+        i = j;
+      }
+    }
+    slots_[i].id_ = 0;
+    slots_[i].value_ = nullptr;
+    --size_;
+    return true;
+  }
+
+  /// Removes all entries.
+  void clear() {
+    slots_.clear();
+    size_ = 0;
+  }
+
+  /// @return number of entries.
+  size_t size() const {
+    return size_;
+  }
+
+ private:
+  /// Table size when the first entry is added.
+  static constexpr unsigned MIN_SLOTS = 16;
+
+  struct Slot {
+    /// Node ID, or 0 if the slot is free.
+    uint64_t id_{0};
+    T *value_{nullptr};
+  };
+
+  /// @return bit mask for slot indexes.
+  unsigned mask() const {
+    return slots_.size() - 1;
+  }
+
+  /// @return the preferred slot of an ID.
+  unsigned home(uint64_t id) const {
+    // Fibonacci hashing; train node IDs differ only in the low bits.
+    return ((id * 0x9E3779B97F4A7C15ULL) >> 32) & mask();
+  }
+
+  /// Changes the table size and re-inserts all entries.
+  /// @param slots new table size, a power of two.
+  void rehash(unsigned slots) {
+    std::vector<Slot> old;
+    old.swap(slots_);
+    slots_.resize(slots);
+    size_ = 0;
+    for (const auto &s : old) {
+      if (s.id_) {
+        insert(s.id_, s.value_);
+      }
+    }
+  }
+
+  /// The hash table. Size is zero or a power of two.
+  std::vector<Slot> slots_;
+  /// Number of used slots.
+  size_t size_{0};
+};
+
+}  // namespace commandstation
+
+#endif  // _COMMANDSTATION_NODEIDINDEX_HXX_
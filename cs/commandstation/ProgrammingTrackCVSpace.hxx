@@ -28,8 +28,10 @@
 #ifndef _COMMANDSTATION_PROGRAMMINGTRACKCVSPACE_HXX_
 #define _COMMANDSTATION_PROGRAMMINGTRACKCVSPACE_HXX_
 
+#include "commandstation/DecoderCvCache.hxx"
 #include "commandstation/ProgrammingTrackSpaceConfig.hxx"
 #include "commandstation/ProgrammingTrackFrontend.hxx"
+#include "executor/Timer.hxx"
 #include "utils/ConfigUpdateListener.hxx"
 #include "openlcb/MemoryConfig.hxx"
 #include "openlcb/TractionDefs.hxx"
@@ -65,6 +67,16 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
   void set_enable_service_mode(bool enable) {
     enableServiceMode_ = enable;
   }
+
+  /// Enables caching CV values. Reads of cached CVs are answered from memory
+  /// without accessing the track; writes update the cache. The cache is
+  /// flushed to its file a few seconds after it changed, and when the
+  /// configuration tool closes the session.
+  /// @param cache the cache to use (owned by the caller), or nullptr to turn
+  /// caching off.
+  void set_cv_cache(DecoderCvCache *cache) {
+    cache_ = cache;
+  }
   
   /// @returns whether the memory space does not accept writes.
   bool read_only() override
@@ -114,6 +126,9 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
       len = 1;
       store_.cv = htobe32(destination + 1);
       store_.value = data[0];
+      if (asyncState_ == IDLE) {
+        select_cache_profile();
+      }
       return eval_async_state(STATE(do_cv_write), again, error, len);
     }
     if (destination < MIN_ADDRESS || destination > MAX_ADDRESS) {
@@ -131,8 +146,14 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
     destination &= ~3;
     switch(destination) {
       case cfg.value().offset():
+        if (asyncState_ == IDLE) {
+          select_cache_profile();
+        }
         return eval_async_state(STATE(do_cv_write), again, error, len);
       case cfg.bit_write_value().offset():
+        if (asyncState_ == IDLE) {
+          select_cache_profile();
+        }
         return eval_async_state(STATE(do_bit_write), again, error, len);
       case cfg.advanced().repeat_verify().offset():
         frontend_->set_repeat_verify(be32toh(store_.verify_repeats));
@@ -141,6 +162,23 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
         frontend_->set_repeat_verify_cooldown(
             be32toh(store_.verify_cooldown_repeats));
         break;
+      case cfg.advanced().cache_control().offset():
+        if (cache_) {
+          switch (be32toh(store_.cache_control)) {
+            case CACHE_FORGET_DECODER:
+              select_cache_profile();
+              if (profile_) {
+                cache_->clear(profile_);
+              }
+              break;
+            case CACHE_FORGET_ALL:
+              cache_->clear_all();
+              break;
+          }
+          cache_changed();
+        }
+        store_.cache_control = 0;
+        break;
     }
     return len;
   }
@@ -156,6 +194,10 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
       // second call after async done.
       *dst = store_.value;
       store_.cv = htobe32(source + 1);
+      if (asyncState_ == IDLE && read_from_cache()) {
+        *dst = store_.value;
+        return len;
+      }
       return eval_async_state(STATE(do_cv_read), again, error, len);
     }
     if (source < MIN_ADDRESS || source > MAX_ADDRESS) {
@@ -170,6 +212,10 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
       case cfg.value().offset():
         // We do actual operations only if individual fields are requested.
         if (len != 1) break;
+        if (asyncState_ == IDLE && read_from_cache()) {
+          *dst = store_.value;
+          return len;
+        }
         return eval_async_state(STATE(do_cv_read), again, error, len);
     }
     return len;
@@ -188,9 +234,79 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
     memset(&store_, 0, sizeof(store_));
     // Zero is not a valid value in this field.
     store_.bit_write_value = htobe16(1000);
+    if (cache_) {
+      cache_->flush();
+    }
     return UPDATED;
   }
 
+  /// Sets profile_ to the cache entry of the decoder the current operation
+  /// (as set in store_) targets.
+  void select_cache_profile() {
+    profile_ = nullptr;
+    if (!cache_) {
+      return;
+    }
+    switch (store_.mode) {
+      case ProgrammingTrackSpaceConfig::POM_MODE:
+        profile_ = cache_->get((dcc::TrainAddressType)store_.address_type,
+                               be16toh(store_.dcc_address));
+        break;
+      case ProgrammingTrackSpaceConfig::DIRECT_MODE:
+      case ProgrammingTrackSpaceConfig::PAGED_MODE: {
+        profile_ = cache_->get(dcc::TrainAddressType::UNSPECIFIED, 0);
+        // After a pause a different locomotive might be on the programming
+        // track.
+        long long now = os_get_time_monotonic();
+        if (now - progTrackLastUse_ >
+            SEC_TO_NSEC(PROG_TRACK_IDLE_SEC)) {
+          cache_->unidentify(profile_);
+        }
+        progTrackLastUse_ = now;
+        break;
+      }
+    }
+  }
+
+  /// Tries to answer a CV read from the cache.
+  /// @return true if store_.value was filled in from the cache.
+  bool read_from_cache() {
+    select_cache_profile();
+    uint8_t value;
+    if (!profile_ || !cache_->lookup(profile_, be32toh(store_.cv), &value)) {
+      return false;
+    }
+    store_.value = value;
+    update_bits_decomposition();
+    return true;
+  }
+
+  /// Updates the cache after an operation on the track.
+  /// @param ok true if the operation succeeded.
+  /// @param is_write true for writes, false for reads.
+  /// @param has_value true if store_.value now holds the CV value.
+  void update_cache(bool ok, bool is_write, bool has_value) {
+    if (!profile_) {
+      return;
+    }
+    unsigned cv = be32toh(store_.cv);
+    if (is_write && (cv == DecoderCvCache::CV_MANUFACTURER ||
+                     cv == DecoderCvCache::CV_VERSION)) {
+      // Writing these usually resets the decoder.
+      cache_->clear(profile_);
+    } else if (ok && has_value) {
+      cache_->store(profile_, cv, store_.value);
+    } else {
+      cache_->invalidate(profile_, cv);
+    }
+    cache_changed();
+  }
+
+  /// Makes sure the cache gets written to its file soon.
+  void cache_changed() {
+    flushTimer_.schedule();
+  }
+
   /// Helper function to process the memory space address. Fills in
   /// store_.mode.
   /// @param address will be normalized to the 0..1023 CV space if mode
@@ -296,6 +412,7 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
 
   Action do_cv_write() {
     uint32_t mode = store_.mode;
+    cacheByteWrite_ = !bitOperation_;
     if (mode == ProgrammingTrackSpaceConfig::DIRECT_MODE) {
       if (bitOperation_) {
         return invoke_subflow_and_wait(
@@ -344,6 +461,7 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
 
   Action cv_write_done() {
     auto b = get_buffer_deleter(full_allocation_result(frontend_));
+    update_cache(b->data()->resultCode == 0, true, cacheByteWrite_);
     return finish_async_state(b->data()->resultCode);
   }
 
@@ -384,6 +502,7 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
   }
 
   Action do_bit_write() {
+    cacheByteWrite_ = false;
     unsigned value = be16toh(store_.bit_write_value);
     unsigned bit = 8;
     bool new_value = false;
@@ -414,12 +533,58 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
   }
 
   Action do_cv_read() {
+    cacheByteWrite_ = false;
+    if (profile_ && !profile_->is_identified()) {
+      return call_immediately(STATE(identify_decoder));
+    }
+    return read_cv(be32toh(store_.cv), STATE(cv_read_done));
+  }
+
+  /// Reads the manufacturer and version CVs, to check whether the cached
+  /// values belong to the decoder we are talking to.
+  Action identify_decoder() {
+    return read_cv(DecoderCvCache::CV_MANUFACTURER,
+                   STATE(identify_manufacturer_done));
+  }
+
+  Action identify_manufacturer_done() {
+    auto b = get_buffer_deleter(full_allocation_result(frontend_));
+    if (b->data()->resultCode != 0) {
+      // Continues without the cache.
+      profile_ = nullptr;
+      return read_cv(be32toh(store_.cv), STATE(cv_read_done));
+    }
+    idManufacturer_ = b->data()->value_;
+    return read_cv(DecoderCvCache::CV_VERSION, STATE(identify_version_done));
+  }
+
+  Action identify_version_done() {
+    auto b = get_buffer_deleter(full_allocation_result(frontend_));
+    if (b->data()->resultCode != 0) {
+      profile_ = nullptr;
+      return read_cv(be32toh(store_.cv), STATE(cv_read_done));
+    }
+    if (!cache_->identify(profile_, idManufacturer_, b->data()->value_)) {
+      LOG(INFO, "CV cache: different decoder, dropped cached values.");
+    }
+    cache_changed();
+    uint8_t value;
+    if (cache_->lookup(profile_, be32toh(store_.cv), &value)) {
+      store_.value = value;
+      update_bits_decomposition();
+      return finish_async_state(0);
+    }
+    return read_cv(be32toh(store_.cv), STATE(cv_read_done));
+  }
+
+  /// Reads a CV using the mode set in store_.
+  /// @param cv 1-based CV number.
+  /// @param c state to continue in when the frontend returns.
+  Action read_cv(unsigned cv, Callback c) {
     uint32_t mode = store_.mode;
     if (mode == ProgrammingTrackSpaceConfig::DIRECT_MODE) {
       return invoke_subflow_and_wait(
-          frontend_, STATE(cv_read_done),
-          ProgrammingTrackFrontendRequest::DIRECT_READ_BYTE,
-          be32toh(store_.cv));
+          frontend_, c, ProgrammingTrackFrontendRequest::DIRECT_READ_BYTE, cv);
     }
     if (mode == ProgrammingTrackSpaceConfig::POM_MODE) {
       uint16_t addr = be16toh(store_.dcc_address);
@@ -429,17 +594,20 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
         addr = dcc::Defs::accy_address_user_to_binary(addr);
       }
       return invoke_subflow_and_wait(
-          frontend_, STATE(cv_read_done),
-          ProgrammingTrackFrontendRequest::POM_READ_BYTE, atype,
-          addr, be32toh(store_.cv));
+          frontend_, c, ProgrammingTrackFrontendRequest::POM_READ_BYTE, atype,
+          addr, cv);
     }
     return finish_async_state(openlcb::Defs::ERROR_UNIMPLEMENTED);
   }
 
+  /// Exit of CV reads and POM byte writes.
   Action cv_read_done() {
     auto b = get_buffer_deleter(full_allocation_result(frontend_));
     store_.value = b->data()->value_;
     update_bits_decomposition();
+    bool is_write = b->data()->cmd_ ==
+        ProgrammingTrackFrontendRequest::Type::POM_WRITE_BYTE;
+    update_cache(b->data()->resultCode == 0, is_write, true);
     return finish_async_state(b->data()->resultCode);
   }
 
@@ -479,6 +647,8 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
   static constexpr uint32_t ADDRESS_PREFIX_SVC_BITOP = 0x10 << 24;
   /// The bit number should be shifted this many bits.
   static constexpr uint32_t SVC_BITOP_BITSHIFT = 24;
+  /// How many seconds after a change the CV cache is written to its file.
+  static constexpr unsigned CACHE_FLUSH_DELAY_SEC = 10;
   
   
  private:
@@ -491,6 +661,18 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
     DONE
   };
 
+  /// After this many seconds without access, the decoder on the programming
+  /// track needs to be identified again before using cached values.
+  static constexpr unsigned PROG_TRACK_IDLE_SEC = 30;
+
+  /// Values of the cache control field.
+  enum CacheControl {
+    /// Forget the cached values of the selected decoder.
+    CACHE_FORGET_DECODER = 1,
+    /// Forget all cached values.
+    CACHE_FORGET_ALL = 2,
+  };
+
   /// Where are we with doing asynchronous operations like read/write.
   AsyncState asyncState_{IDLE};
   /// Error return value from async state.
@@ -510,6 +692,49 @@ class ProgrammingTrackCVSpace : private openlcb::MemorySpace,
   openlcb::Node* node_;
   /// Which memory space we exported ourselves.
   uint8_t spaceId_;
+  /// CV cache, or nullptr if caching is off.
+  DecoderCvCache *cache_{nullptr};
+  /// Cache entry of the decoder of the current operation, or nullptr if the
+  /// operation is not cached.
+  DecoderCvCache::Profile *profile_{nullptr};
+  /// When the programming track cache entry was last used.
+  long long progTrackLastUse_{0};
+
+  /// Writes the CV cache to its file some time after it changed, so that the
+  /// values survive a restart even if the configuration session is never
+  /// closed.
+  class FlushTimer : public ::Timer {
+   public:
+    FlushTimer(ProgrammingTrackCVSpace* parent)
+        : ::Timer(parent->service()->executor()->active_timers()),
+          parent_(parent) {}
+
+    /// Starts the timer unless it is already running.
+    void schedule() {
+      if (!isRunning_) {
+        isRunning_ = true;
+        start(SEC_TO_NSEC(CACHE_FLUSH_DELAY_SEC));
+      }
+    }
+
+   private:
+    long long timeout() override {
+      isRunning_ = false;
+      if (parent_->cache_) {
+        parent_->cache_->flush();
+      }
+      return NONE;
+    }
+
+    /// True if the timer is running and not expired yet.
+    bool isRunning_{false};
+    /// Owning instance.
+    ProgrammingTrackCVSpace* parent_;
+  } flushTimer_{this};
+  /// Manufacturer ID read while identifying the decoder.
+  uint8_t idManufacturer_;
+  /// True if the current write operation sets the entire CV value.
+  bool cacheByteWrite_{false};
   /// True if we are operating on the main node, false if on a train node.
   bool isMainNode_ : 1;
   /// True if we are executing a bit operation, false otherwise.
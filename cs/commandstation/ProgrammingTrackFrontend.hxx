@@ -40,6 +40,22 @@
 
 namespace commandstation {
 
+/// One CV of a bulk read or write request.
+struct ProgrammingTrackCvEntry {
+  /// 1-based CV number (as the user sees it).
+  uint16_t cv_;
+  /// For writes: the value to write. For reads: output of the value read,
+  /// and if hasHint_ is set, on input the value the CV is expected to have.
+  uint8_t value_;
+  /// For reads: 1 if value_ holds an expected value. The read then starts
+  /// with verifying this value, and the bit search tests the expected bit
+  /// values first.
+  uint8_t hasHint_;
+  /// Result code of the operation on this CV
+  /// (ProgrammingTrackFrontend::ResultCodes).
+  int result_;
+};
+
 struct ProgrammingTrackFrontendRequest : public CallableFlowRequestBase {
   enum DirectWriteByte { DIRECT_WRITE_BYTE };
   enum DirectWriteBit { DIRECT_WRITE_BIT };
@@ -52,6 +68,8 @@ struct ProgrammingTrackFrontendRequest : public CallableFlowRequestBase {
   enum PagedVerifyByte { PAGED_VERIFY_BYTE };
   enum PagedReadByte { PAGED_READ_BYTE };
   enum ExitServiceMode { EXIT_SERVICE_MODE };
+  enum BulkRead { BULK_READ };
+  enum BulkWrite { BULK_WRITE };
 
   /// Request to write a byte sized CV in direct mode.
   /// @param cv_number is the 1-based CV number (as the user sees it).
@@ -154,6 +172,39 @@ struct ProgrammingTrackFrontendRequest : public CallableFlowRequestBase {
     cmd_ = Type::EXIT_SERVICE_MODE;
   }
 
+  /// Request to read a list of CVs. If a locomotive address is given, each
+  /// CV is first read with POM using RailCom; if the decoder does not answer
+  /// in RailCom, the CV (and if there was no RailCom at all, the rest of the
+  /// batch) is read in direct mode on the programming track. All service
+  /// mode reads happen in one service mode session.
+  /// @param entries array of CVs to read, owned by the caller. The values
+  /// and the per-CV results are filled in.
+  /// @param count number of entries.
+  /// @param addrtype DCC_SHORT_ADDRESS or DCC_LONG_ADDRESS to try POM reads,
+  /// anything else for service mode only.
+  /// @param dcc_address is the DCC address of the target locomotive.
+  void reset(
+      BulkRead, ProgrammingTrackCvEntry* entries, unsigned count,
+      dcc::TrainAddressType addrtype = dcc::TrainAddressType::UNSPECIFIED,
+      uint32_t dcc_address = 0) {
+    reset_base();
+    cmd_ = Type::BULK_READ;
+    entries_ = entries;
+    numEntries_ = count;
+    addrType_ = addrtype;
+    dccAddress_ = dcc_address;
+  }
+
+  /// Request to write a list of CVs. Same as BULK_READ, but uses POM write
+  /// and direct mode write byte with verify.
+  void reset(
+      BulkWrite, ProgrammingTrackCvEntry* entries, unsigned count,
+      dcc::TrainAddressType addrtype = dcc::TrainAddressType::UNSPECIFIED,
+      uint32_t dcc_address = 0) {
+    reset(BULK_READ, entries, count, addrtype, dcc_address);
+    cmd_ = Type::BULK_WRITE;
+  }
+
   /// Values for the cmd_ argument.
   enum class Type {
     DIRECT_WRITE_BYTE,
@@ -166,7 +217,9 @@ struct ProgrammingTrackFrontendRequest : public CallableFlowRequestBase {
     PAGED_WRITE_BYTE,
     PAGED_VERIFY_BYTE,
     PAGED_READ_BYTE,
-    EXIT_SERVICE_MODE
+    EXIT_SERVICE_MODE,
+    BULK_READ,
+    BULK_WRITE,
   };
 
   /// What is the instruction to do.
@@ -183,6 +236,10 @@ struct ProgrammingTrackFrontendRequest : public CallableFlowRequestBase {
   /// For POM commands holds the DCC address to talk to. Long vs short address
   /// is defined by addrType_.
   uint16_t dccAddress_;
+  /// For bulk commands: the CVs to operate on.
+  ProgrammingTrackCvEntry* entries_;
+  /// For bulk commands: number of entries.
+  unsigned numEntries_;
 };
 
 class ProgrammingTrackFrontend
@@ -200,6 +257,7 @@ class ProgrammingTrackFrontend
                            dcc::RailcomHubFlow* railcom_hub)
       : CallableFlow<ProgrammingTrackFrontendRequest>(railcom_hub->service()),
         inServiceMode_(0),
+        inBatch_(0),
         backend_(backend),
         track_(track),
         railcomHub_(railcom_hub) {}
@@ -265,17 +323,124 @@ class ProgrammingTrackFrontend
         break;
       case RequestType::EXIT_SERVICE_MODE:
         return call_immediately(STATE(exit_service_mode));
+      case RequestType::BULK_READ:
+      case RequestType::BULK_WRITE:
+        return call_immediately(STATE(batch_start));
     }
     return return_with_error(ERROR_UNIMPLEMENTED_CMD);
   }
 
+  /// Root state of bulk operations. Each CV is executed by rewriting the
+  /// request into the matching single-CV command and running the usual
+  /// states; op_done() then moves on to the next CV.
+  Action batch_start() {
+    batchType_ = request()->cmd_;
+    batchIndex_ = 0;
+    batchResult_ = ERROR_CODE_OK;
+    batchNoRailcom_ =
+        (request()->addrType_ != dcc::TrainAddressType::DCC_SHORT_ADDRESS &&
+         request()->addrType_ != dcc::TrainAddressType::DCC_LONG_ADDRESS) ||
+        !track_;
+    for (unsigned i = 0; i < request()->numEntries_; ++i) {
+      request()->entries_[i].result_ = OPERATION_PENDING;
+    }
+    inBatch_ = 1;
+    return call_immediately(STATE(batch_next));
+  }
+
+  /// Starts the operation on the next CV of the batch.
+  Action batch_next() {
+    if (batchIndex_ >= request()->numEntries_) {
+      end_batch();
+      return return_with_error(batchResult_);
+    }
+    const auto& e = request()->entries_[batchIndex_];
+    request()->resultCode = OPERATION_PENDING;
+    request()->cvOffset_ = e.cv_ - 1;
+    request()->value_ = e.value_;
+    numTry_ = 0;
+    if (batchNoRailcom_) {
+      return call_immediately(STATE(batch_service_mode));
+    }
+    if (batchType_ == RequestType::BULK_READ) {
+      request()->cmd_ = RequestType::POM_READ_BYTE;
+      return call_immediately(STATE(pom_read_byte));
+    } else {
+      request()->cmd_ = RequestType::POM_WRITE_BYTE;
+      return call_immediately(STATE(pom_write_byte));
+    }
+  }
+
+  /// Executes the current CV of the batch on the programming track.
+  Action batch_service_mode() {
+    const auto& e = request()->entries_[batchIndex_];
+    request()->resultCode = OPERATION_PENDING;
+    request()->value_ = e.value_;
+    numTry_ = 0;
+    if (batchType_ == RequestType::BULK_READ) {
+      request()->cmd_ = RequestType::DIRECT_READ_BYTE;
+    } else {
+      request()->cmd_ = RequestType::DIRECT_WRITE_BYTE;
+    }
+    return call_immediately(STATE(enter_service_mode));
+  }
+
+  /// Completes the operation on the current CV. In a batch stores the result
+  /// and continues with the next CV, otherwise returns to the caller.
+  /// @param code result code of the operation.
+  Action op_done(int code) {
+    if (!inBatch_) {
+      return return_with_error(code);
+    }
+    auto& e = request()->entries_[batchIndex_];
+    e.result_ = code;
+    if (code == ERROR_CODE_OK) {
+      e.value_ = request()->value_;
+    } else if (batchResult_ == ERROR_CODE_OK) {
+      batchResult_ = code;
+    }
+    ++batchIndex_;
+    return call_immediately(STATE(batch_next));
+  }
+
+  /// Completes a POM operation on the current CV. In a batch falls back to
+  /// service mode if RailCom did not produce an answer.
+  /// @param code result code of the POM operation.
+  Action pom_done(int code) {
+    if (!inBatch_ || code == ERROR_CODE_OK || !backend_) {
+      return op_done(code);
+    }
+    if (code == ERROR_NO_RAILCOM) {
+      // The decoder is not talking RailCom; do not try for the remaining CVs
+      // either.
+      batchNoRailcom_ = 1;
+    }
+    return call_immediately(STATE(batch_service_mode));
+  }
+
+  /// Aborts the batch if there is one, then returns an error to the caller.
+  /// @param code the error to return.
+  Action abort_with_error(int code) {
+    if (inBatch_) {
+      request()->entries_[batchIndex_].result_ = code;
+      end_batch();
+    }
+    return return_with_error(code);
+  }
+
+  /// Restores the request to the state the caller has set.
+  void end_batch() {
+    inBatch_ = 0;
+    request()->cmd_ = batchType_;
+  }
+
   Action enter_service_mode() {
     if (inServiceMode_) {
       // the timer has not elapsed yet.
       return call_immediately(STATE(act_service_mode));
     }
     if (!backend_) {
-      return return_with_error(ERROR_PGMTRACK_DISABLED);
+      return abort_with_error(ERROR_PGMTRACK_DISABLED);
     }
     inServiceMode_ = true;
     return invoke_subflow_and_wait(backend_, STATE(send_initial_resets),
@@ -421,18 +586,62 @@ class ProgrammingTrackFrontend
     nextBitToRead_ = 0;
     confirmedOnes_ = 0;
     confirmedZeros_ = 0;
+    // Single reads test every bit for one. Batch reads test for the expected
+    // value and stop the repeats on the ack, which is faster when the guess
+    // is right. Most CVs have mostly zero bits.
+    bitExpect_ = 0xFF;
+    if (inBatch_) {
+      const auto& e = request()->entries_[batchIndex_];
+      bitExpect_ = e.hasHint_ ? e.value_ : 0;
+      if (e.hasHint_) {
+        serviceModePacket_.set_dcc_svc_verify_byte(request()->cvOffset_,
+                                                   e.value_);
+        foundAck_ = 0;
+        return invoke_subflow_and_wait(
+            backend_, STATE(check_hint),
+            ProgrammingTrackRequest::SEND_PROGRAMMING_PACKET,
+            serviceModePacket_, verifyRepeats_, true);
+      }
+    }
     return call_immediately(STATE(read_next_bit));
   }
-  
+
+  /// Called after verifying the expected value of a batch read.
+  Action check_hint() {
+    auto b = get_buffer_deleter(full_allocation_result(backend_));
+    if (b->data()->hasShortCircuit_) return call_immediately(STATE(pgm_short));
+    if (b->data()->hasAck_) {
+      foundAck_ = 1;
+    }
+    return invoke_subflow_and_wait(backend_, STATE(cooldown_hint),
+                                   ProgrammingTrackRequest::SEND_RESET,
+                                   verifyCooldownReset_);
+  }
+
+  Action cooldown_hint() {
+    auto b = get_buffer_deleter(full_allocation_result(backend_));
+    if (b->data()->hasShortCircuit_) return call_immediately(STATE(pgm_short));
+    if (b->data()->hasAck_) {
+      foundAck_ = 1;
+    }
+    LOG(INFO, "hint 0x%02x verify ack %u", request()->value_, foundAck_);
+    if (foundAck_) {
+      request()->resultCode |= ERROR_CODE_OK;
+      return done_and_return();
+    }
+    return call_immediately(STATE(read_next_bit));
+  }
+
   Action read_next_bit() {
-    LOG(INFO, "Testing bit %d", nextBitToRead_);
+    bool expect = (bitExpect_ >> nextBitToRead_) & 1;
+    LOG(INFO, "Testing bit %d for %d", nextBitToRead_, expect);
     serviceModePacket_.set_dcc_svc_verify_bit(request()->cvOffset_,
-                                              nextBitToRead_,
-                                              true);
+                                              nextBitToRead_, expect);
+    foundAck_ = 0;
     return invoke_subflow_and_wait(
         backend_, STATE(check_next_bit_one),
         ProgrammingTrackRequest::SEND_PROGRAMMING_PACKET, serviceModePacket_,
-        verifyRepeats_);
+        verifyRepeats_, inBatch_ != 0);
   }
 
   Action check_next_bit_one() {
@@ -440,7 +649,7 @@ class ProgrammingTrackFrontend
     LOG(INFO, "bit %d verify ack %u", nextBitToRead_, b->data()->hasAck_);
     if (b->data()->hasShortCircuit_) return call_immediately(STATE(pgm_short));
     if (b->data()->hasAck_) {
-      confirmedOnes_ |= (1<<nextBitToRead_);
+      foundAck_ = 1;
     }
     return invoke_subflow_and_wait(backend_, STATE(cooldown_next_bit_one),
                                    ProgrammingTrackRequest::SEND_RESET,
@@ -452,6 +661,10 @@ class ProgrammingTrackFrontend
     LOG(INFO, "bit %d cooldown ack %u", nextBitToRead_, b->data()->hasAck_);
     if (b->data()->hasShortCircuit_) return call_immediately(STATE(pgm_short));
     if (b->data()->hasAck_) {
+      foundAck_ = 1;
+    }
+    // An ack confirms the tested value; no ack means the other value.
+    if (foundAck_ == ((bitExpect_ >> nextBitToRead_) & 1)) {
       confirmedOnes_ |= (1<<nextBitToRead_);
     }
     if (nextBitToRead_ == 7) {
@@ -646,7 +859,7 @@ class ProgrammingTrackFrontend
       case dcc::TrainAddressType::MM:
       case dcc::TrainAddressType::UNSPECIFIED:
       case dcc::TrainAddressType::UNSUPPORTED:
-        return return_with_error(ERROR_INVALID_ARGS);
+        return abort_with_error(ERROR_INVALID_ARGS);
     }
     b->data()->add_dcc_pom_write1(request()->cvOffset_, request()->value_);
     b->data()->feedback_key = reinterpret_cast<uintptr_t>(this);
@@ -674,16 +887,16 @@ class ProgrammingTrackFrontend
                                 STATE(pom_write_byte));
         }
         if (seenRailcomBusy_ || seenRailcomGarbage_) {
-          return return_with_error(ERROR_INVALID_RESPONSE);
+          return pom_done(ERROR_INVALID_RESPONSE);
         } else {
-          return return_with_error(ERROR_NO_RAILCOM);
+          return pom_done(ERROR_NO_RAILCOM);
         }
         break;
       case ERROR_OK:
-        return return_with_error(ERROR_CODE_OK);
+        return pom_done(ERROR_CODE_OK);
     }
     // Should not get here.
-    return return_with_error(openlcb::Defs::ERROR_TEMPORARY);
+    return abort_with_error(openlcb::Defs::ERROR_TEMPORARY);
   }
 
   Action pom_read_byte() {
@@ -698,7 +911,7 @@ class ProgrammingTrackFrontend
     } else if (request()->addrType_ == dcc::TrainAddressType::DCC_LONG_ADDRESS) {
       b->data()->add_dcc_address(dcc::DccLongAddress(request()->dccAddress_));
     } else {
-      return return_with_error(ERROR_INVALID_ARGS);
+      return abort_with_error(ERROR_INVALID_ARGS);
     }
     b->data()->add_dcc_pom_read1(request()->cvOffset_);
     b->data()->feedback_key = reinterpret_cast<uintptr_t>(this);
@@ -717,7 +930,7 @@ class ProgrammingTrackFrontend
         cvData_);
     if (errorCode_ == ERROR_OK) {
       request()->value_ = cvData_;
-      return return_with_error(ERROR_CODE_OK);
+      return pom_done(ERROR_CODE_OK);
     }
     if (errorCode_ == ERROR_PENDING) {
       railcomHub_->unregister_port(&railcomHandler_);
@@ -726,9 +939,9 @@ class ProgrammingTrackFrontend
       return call_immediately(STATE(pom_read_byte));
     }
     if (seenRailcomBusy_ || seenRailcomGarbage_) {
-      return return_with_error(ERROR_INVALID_RESPONSE);
+      return pom_done(ERROR_INVALID_RESPONSE);
     } else {
-      return return_with_error(ERROR_NO_RAILCOM);
+      return pom_done(ERROR_NO_RAILCOM);
     }
   }
 
@@ -756,14 +969,14 @@ class ProgrammingTrackFrontend
   Action pgm_short() {
     StateFlow::invoke_subflow_and_ignore_result(
         this, ProgrammingTrackFrontendRequest::EXIT_SERVICE_MODE);
-    return return_with_error(ERROR_PGM_SHORT);
+    return abort_with_error(ERROR_PGM_SHORT);
   }
 
   /// Invoked when an operation is done and we are ready to return. Handles the
   /// service mode exit timer.
   Action done_and_return() {
     serviceModeTimer_.ping();
-    return return_with_error(request()->resultCode & (~OPERATION_PENDING));
+    return op_done(request()->resultCode & (~OPERATION_PENDING));
   }
 
   /// Handler class for railcom feedback messages.
@@ -966,6 +1179,8 @@ class ProgrammingTrackFrontend
   uint8_t verifyRepeats_{DEFAULT_VERIFY_REPEATS};
   /// The number of reset commands to send between verify bit commands.
   uint8_t verifyCooldownReset_{DEFAULT_VERIFY_COOLDOWN};
+  /// When reading a byte, the value each bit is tested for.
+  uint8_t bitExpect_;
   /// When reading a byte, which bt we are testing next.
   uint8_t nextBitToRead_ : 4;
   /// 1 if we have an ack (aggregated over an write/verify and the cooldown
@@ -985,6 +1200,16 @@ class ProgrammingTrackFrontend
   uint8_t pagedRegister_ : 3;
   /// True if we are in service mode.
   uint8_t inServiceMode_ : 1;
+  /// 1 if a bulk request is being executed.
+  uint8_t inBatch_ : 1;
+  /// 1 if the bulk request should not try POM reads or writes.
+  uint8_t batchNoRailcom_ : 1;
+  /// The original command of the bulk request being executed.
+  RequestType batchType_;
+  /// Index of the CV being worked on in the bulk request.
+  unsigned batchIndex_;
+  /// Result of the bulk request: the first error, or OK.
+  int batchResult_;
 
   StateFlowTimer timer_{this};
   long long deadline_;  //< time when we should give up and return error.
@@ -75,6 +75,12 @@ CDI_GROUP_ENTRY(
     Name("Repeat count for reset packets after verify"),
     Description("How many reset packets to send after a verify."),
     Default(6), Min(0), Max(255));
+CDI_GROUP_ENTRY(
+    cache_control, openlcb::Uint32ConfigEntry, Name("CV cache"),
+    Description("CV values already read or written are remembered and not "
+                "read again from the decoder. Write 1 to forget the values of "
+                "the decoder selected above, or 2 to forget all values."),
+    Default(0), Min(0), Max(2));
 CDI_GROUP_END();
 
 CDI_GROUP(ProgrammingTrackSpaceConfig, Segment(openlcb::MemoryConfigDefs::SPACE_DCC_CV), Offset(0x7F100000),
@@ -141,6 +147,7 @@ struct ProgrammingTrackSpaceConfig::Shadow {
   char bit_value_string[24];
   uint32_t verify_repeats;
   uint32_t verify_cooldown_repeats;
+  uint32_t cache_control;
 };
 
 #if (__GNUC__ > 6) || defined(__EMSCRIPTEN__)
@@ -162,6 +169,13 @@ static_assert(SHADOW_OFFSETOF(verify_cooldown_repeats) ==
                       .offset(),
               "Offset of repeat cooldown reset field does not match.");
 
+static_assert(SHADOW_OFFSETOF(cache_control) ==
+                  ProgrammingTrackSpaceConfig::zero_offset_this()
+                      .advanced()
+                      .cache_control()
+                      .offset(),
+              "Offset of cache control field does not match.");
+
 } // namespace commandstation
 
 
@@ -2,6 +2,9 @@
 #ifndef _BRACZ_CUSTOM_AUTOMATACONTROL_HXX_
 #define _BRACZ_CUSTOM_AUTOMATACONTROL_HXX_
 
+#include <algorithm>
+
+#include "custom/Crc32.h"
 #include "openlcb/DatagramHandlerDefault.hxx"
 #include "openlcb/Defs.hxx"
 #include "src/automata_runner.h"
@@ -18,15 +21,38 @@ struct AutomataDefs {
 
     GET_AUTOMATA_STATE = 0x20,
 
+    // Request: 4 bytes offset, 2 bytes length. Response: 4 bytes offset,
+    // 1 byte block count, then the block_hash of each HASH_BLOCK_SIZE
+    // bytes block in the range, 4 bytes each. The last block may be shorter.
+    GET_BLOCK_HASHES = 0x30,
+    HASH_BLOCK_SIZE = 64,
+    // Largest block count that fits a response datagram.
+    MAX_HASH_BLOCKS = 16,
+
     ERROR_AUTOMATA_NOT_FOUND = openlcb::Defs::ERROR_INVALID_ARGS | 0xF,
   };
+
+  // Checksum of a block of the automata image. Used to find out which blocks
+  // need to be reflashed.
+  static uint32_t block_hash(const uint8_t* data, unsigned len) {
+    Crc32 crc;
+    for (unsigned i = 0; i < len; ++i) {
+      crc.Add(data[i]);
+    }
+    return crc.Get();
+  }
 };
 
 class AutomataControl : public openlcb::DefaultDatagramHandler {
  public:
+  // @param code_size is the size of the automata area starting at code. Block
+  // hash requests are rejected if it is zero.
   AutomataControl(openlcb::Node* node, openlcb::DatagramService* if_datagram,
-                  const insn_t* code)
-      : DefaultDatagramHandler(if_datagram), runner_(node, code) {
+                  const insn_t* code, size_t code_size = 0)
+      : DefaultDatagramHandler(if_datagram),
+        runner_(node, code),
+        code_(code),
+        codeSize_(code_size) {
     dg_service()->registry()->insert(runner_.node(),
                                      AutomataDefs::DATAGRAM_CODE, this);
   }
@@ -72,6 +98,45 @@ class AutomataControl : public openlcb::DefaultDatagramHandler {
         needResponse_ = 1;
         return respond_ok(openlcb::DatagramDefs::REPLY_PENDING);
       }
+      case AutomataDefs::GET_BLOCK_HASHES: {
+        if (size() < 8) {
+          return respond_reject(
+              openlcb::Defs::ERROR_INVALID_ARGS_MESSAGE_TOO_SHORT);
+        }
+        uint32_t ofs = payload()[2];
+        ofs = (ofs << 8) | payload()[3];
+        ofs = (ofs << 8) | payload()[4];
+        ofs = (ofs << 8) | payload()[5];
+        unsigned len = payload()[6];
+        len = (len << 8) | payload()[7];
+        if (!codeSize_ || ofs > codeSize_ ||
+            len > AutomataDefs::MAX_HASH_BLOCKS *
+                      AutomataDefs::HASH_BLOCK_SIZE) {
+          return respond_reject(openlcb::Defs::ERROR_INVALID_ARGS);
+        }
+        if (len > codeSize_ - ofs) {
+          len = codeSize_ - ofs;
+        }
+        responsePayload_.clear();
+        responsePayload_.push_back(AutomataDefs::RESPONSE_CODE);
+        responsePayload_.push_back(cmd);
+        responsePayload_.append((const char*)payload() + 2, 4);
+        unsigned count = (len + AutomataDefs::HASH_BLOCK_SIZE - 1) /
+                         AutomataDefs::HASH_BLOCK_SIZE;
+        responsePayload_.push_back(count);
+        for (unsigned i = 0; i < count; ++i) {
+          unsigned start = i * AutomataDefs::HASH_BLOCK_SIZE;
+          unsigned block_len =
+              std::min(len - start, (unsigned)AutomataDefs::HASH_BLOCK_SIZE);
+          uint32_t h =
+              AutomataDefs::block_hash(code_ + ofs + start, block_len);
+          for (int b = 24; b >= 0; b -= 8) {
+            responsePayload_.push_back((h >> b) & 0xff);
+          }
+        }
+        needResponse_ = 1;
+        return respond_ok(openlcb::DatagramDefs::REPLY_PENDING);
+      }
       default:
         return respond_reject(openlcb::DatagramClient::PERMANENT_ERROR);
     }
@@ -112,6 +177,10 @@ class AutomataControl : public openlcb::DefaultDatagramHandler {
 
  private:
   AutomataRunner runner_;
+  // Start of the automata image.
+  const insn_t* code_;
+  // Size of the automata area, or 0 if unknown.
+  size_t codeSize_;
   openlcb::DatagramClient* clientFlow_;
   openlcb::DatagramPayload responsePayload_;
   uint16_t automataNum_;
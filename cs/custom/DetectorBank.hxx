@@ -0,0 +1,703 @@
+/** \copyright
+ * Copyright (c) 2026, Balazs Racz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are met:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ *  - Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \file DetectorBank.hxx
+ *
+ * Business logic for all ports of the railcom+occupancy detector, with the
+ * per-port state packed into bit words.
+ *
+ * @author Balazs Racz
+ * @date 19 Oct 2026
+ */
+
+#ifndef _BRACZ_CUSTOM_DETECTORBANK_HXX_
+#define _BRACZ_CUSTOM_DETECTORBANK_HXX_
+
+#include <algorithm>
+#include <unistd.h>
+
+#include "custom/DetectorPort.hxx"
+#include "openlcb/EventHandlerTemplates.hxx"
+
+namespace bracz_custom {
+
+/// Runs the same logic as N DetectorPort objects, but with one state flow, one
+/// event handler and the boolean state of all ports packed into 32-bit words.
+///
+/// The flow sleeps until the earliest deadline of any port, or until a port
+/// gets woken up by a sensor or network change. When every port waits for a
+/// wakeup, the flow does not run at all. Event IDs that form aligned
+/// contiguous blocks are registered as a single event registry range.
+template <unsigned N>
+class DetectorBank : public StateFlowBase, private openlcb::SimpleEventHandler {
+  static_assert(N <= 32, "Port state is packed into 32-bit words.");
+
+ public:
+  using PortsConfig = openlcb::RepeatedGroup<DetectorPortConfig, N>;
+
+  /// Constructor.
+  /// @param node the virtual node to produce and consume events on.
+  /// @param config_fd the config file to read the event IDs from.
+  /// @param cfg the repeated group of the port configurations. Port i drives
+  /// output enable_ptrs[i].
+  /// @param opts the tuning options shared by all ports.
+  DetectorBank(openlcb::Node* node, int config_fd, const PortsConfig& cfg,
+               const DetectorOptions& opts)
+      : StateFlowBase(node->iface()), node_(node), opts_(opts) {
+    read_events(config_fd, cfg);
+    register_events();
+    uint32_t now = now_msec();
+    for (unsigned p = 0; p < N; ++p) {
+      phase_[p] = INIT_START;
+      deadline_[p] = now;
+    }
+    start_flow(STATE(evaluate));
+  }
+
+  ~DetectorBank() {
+    openlcb::EventRegistry::instance()->unregister_handler(this);
+  }
+
+  bool is_enabled(unsigned port) {
+    return get(commandedEnable_, port);
+  }
+
+  bool is_overcurrent(unsigned port) {
+    return get(killedOutputDueToOvercurrent_, port);
+  }
+
+  void set_overcurrent(unsigned port, bool value) {
+    if (value) {
+      // We have a short circuit. Stop the output.
+      set_output_enable(port, false);
+      killedOutputDueToOvercurrent_ |= bit(port);
+      wakeup_normal_state(port);
+    }
+  }
+
+  // This function needs to be called when the DCC signal has been lost,
+  // presumably due to a recent short. Applies to all ports.
+  void set_have_dcc_signal(bool have) {
+    lostDccSignal_ = have ? 0 : ALL_PORTS;
+  }
+
+  void set_occupancy(unsigned port, bool value) {
+    put(&sensedOccupancy_, port, value);
+    if (value) {
+      seenOccupancyOn_ |= bit(port);
+    } else {
+      seenOccupancyOff_ |= bit(port);
+    }
+    wakeup_normal_state(port);
+  }
+
+  void set_network_occupancy(unsigned port, bool value) {
+    put(&networkOccupancy_, port, value);
+    if (value == get(sensedOccupancy_, port)) {
+      // We write down this bit in case it prevents us from producing the same
+      // event when the timer expires.
+      g_gpio_stored_bit_set
+          ->set_bit(storage_base(port) + DetectorPort::NETWORK_OCCUPANCY_OFS,
+                    value)
+          .lock_and_flush();
+    }
+    wakeup_normal_state(port);
+  }
+
+  void set_network_overcurrent(unsigned port, bool value) {
+    put(&networkOvercurrent_, port, value);
+    wakeup_normal_state(port);
+  }
+
+  void set_network_enable(unsigned port, bool value) {
+    put(&networkEnable_, port, value);
+    g_gpio_stored_bit_set
+        ->set_bit(storage_base(port) + DetectorPort::NETWORK_ENABLE_OFS, value)
+        .lock_and_flush();
+    if (value && phase_[port] == NETWORK_OFF) {
+      // wake up from terminal state
+      wakeup(port);
+    }
+    if (!value) {
+      // turn off
+      set_output_enable(port, false);
+    }
+    wakeup_normal_state(port);
+  }
+
+ private:
+  static constexpr uint32_t ALL_PORTS = N < 32 ? (1u << N) - 1 : 0xffffffffu;
+
+  /// Which state of the DetectorPort flow a port is in.
+  enum Phase : uint8_t {
+    INIT_START,
+    INIT_WAIT,
+    INIT_TRY_TURNON,
+    TRY_TURNON,
+    WAIT_FOR_DCC_TO_TURN_ON,
+    EVAL_TURNON,
+    NETWORK_OFF,
+    EVAL_NORMAL_STATE,
+    SENSOR_DEBOUNCE_DONE,
+  };
+
+  /// Defines what we use the arg bits for in the event table. Same as in
+  /// DetectorPort.
+  enum EventArgs {
+    ENABLE_BIT = 1,
+    OCCUPANCY_BIT = 2,
+    OVERCURRENT_BIT = 3,
+    MASK_FOR_BIT = 3,
+    ARG_ON = 16,
+  };
+
+  /// Number of events per port.
+  static constexpr unsigned EVENTS_PER_PORT = 6;
+
+  /// One event that a port produces or consumes.
+  struct EventEntry {
+    openlcb::EventId event;
+    uint8_t port;
+    uint8_t arg;  //< EventArgs
+  };
+
+  static uint32_t bit(unsigned port) {
+    return 1u << port;
+  }
+
+  static bool get(uint32_t word, unsigned port) {
+    return word & bit(port);
+  }
+
+  static void put(uint32_t* word, unsigned port, bool value) {
+    if (value) {
+      *word |= bit(port);
+    } else {
+      *word &= ~bit(port);
+    }
+  }
+
+  static uint32_t now_msec() {
+    return os_get_time_monotonic() / 1000000;
+  }
+
+  static unsigned storage_base(unsigned port) {
+    return DetectorPort::CHANNEL_0_OFS +
+           (port * DetectorPort::BITS_PER_CHANNEL);
+  }
+
+  /// Reads the event IDs of all ports, with one file read per port.
+  void read_events(int fd, const PortsConfig& cfg) {
+    unsigned n = 0;
+    for (unsigned p = 0; p < N; ++p) {
+      const DetectorPortConfig grp = cfg.entry(p);
+      uint8_t block[DetectorPortConfig::size()];
+      off_t ofs = lseek(fd, grp.offset(), SEEK_SET);
+      ERRNOCHECK("lseek", ofs);
+      size_t done = 0;
+      while (done < sizeof(block)) {
+        ssize_t ret = ::read(fd, block + done, sizeof(block) - done);
+        ERRNOCHECK("read", ret);
+        HASSERT(ret > 0);
+        done += ret;
+      }
+      auto add = [&](unsigned entry_offset, uint8_t arg) {
+        events_[n].event = read_event(block, entry_offset - grp.offset());
+        events_[n].port = p;
+        events_[n].arg = arg;
+        ++n;
+      };
+      add(grp.occupancy().occ_on().offset(), OCCUPANCY_BIT | ARG_ON);
+      add(grp.occupancy().occ_off().offset(), OCCUPANCY_BIT);
+      add(grp.overcurrent().over_on().offset(), OVERCURRENT_BIT | ARG_ON);
+      add(grp.overcurrent().over_off().offset(), OVERCURRENT_BIT);
+      add(grp.enable().enable_on().offset(), ENABLE_BIT | ARG_ON);
+      add(grp.enable().enable_off().offset(), ENABLE_BIT);
+      eventOccupancyOn_[p] = events_[n - 6].event;
+      eventOccupancyOff_[p] = events_[n - 5].event;
+      eventOvercurrentOn_[p] = events_[n - 4].event;
+      eventOvercurrentOff_[p] = events_[n - 3].event;
+    }
+    std::sort(events_, events_ + NUM_EVENTS,
+              [](const EventEntry& a, const EventEntry& b) {
+                return a.event < b.event;
+              });
+  }
+
+  /// Decodes a big-endian event ID from a config block.
+  static openlcb::EventId read_event(const uint8_t* block, unsigned ofs) {
+    openlcb::EventId ret = 0;
+    for (unsigned i = 0; i < 8; ++i) {
+      ret = (ret << 8) | block[ofs + i];
+    }
+    return ret;
+  }
+
+  /// Registers the (sorted) event table with the event registry. Aligned runs
+  /// of consecutive event IDs become a single masked registry entry. The
+  /// user_arg of each registry entry is the index of its first event.
+  void register_events() {
+    unsigned i = 0;
+    while (i < NUM_EVENTS) {
+      openlcb::EventId start = events_[i].event;
+      unsigned mask = 0;
+      while (true) {
+        unsigned len = 2u << mask;
+        if ((start & (len - 1)) || i + len > NUM_EVENTS) {
+          break;
+        }
+        bool contiguous = true;
+        for (unsigned k = 1; k < len; ++k) {
+          if (events_[i + k].event != start + k) {
+            contiguous = false;
+            break;
+          }
+        }
+        if (!contiguous) {
+          break;
+        }
+        ++mask;
+      }
+      openlcb::EventRegistry::instance()->register_handler(
+          openlcb::EventRegistryEntry(this, start, i), mask);
+      i += 1u << mask;
+      // The same event on multiple ports is registered only once.
+      while (i < NUM_EVENTS && events_[i].event == events_[i - 1].event) {
+        ++i;
+      }
+    }
+  }
+
+  /// @return the range of entries in the event table for an event ID.
+  std::pair<EventEntry*, EventEntry*> find_events(openlcb::EventId event) {
+    return std::equal_range(
+        events_, events_ + NUM_EVENTS, EventEntry{event, 0, 0},
+        [](const EventEntry& a, const EventEntry& b) {
+          return a.event < b.event;
+        });
+  }
+
+  void handle_event_report(const openlcb::EventRegistryEntry& registry_entry,
+                           openlcb::EventReport* event,
+                           BarrierNotifiable* done) override {
+    AutoNotify an(done);
+    auto r = find_events(event->event);
+    for (EventEntry* e = r.first; e != r.second; ++e) {
+      bool on = e->arg & ARG_ON;
+      switch (e->arg & MASK_FOR_BIT) {
+        case ENABLE_BIT:
+          set_network_enable(e->port, on);
+          break;
+        case OVERCURRENT_BIT:
+          set_network_overcurrent(e->port, on);
+          break;
+        case OCCUPANCY_BIT:
+          set_network_occupancy(e->port, on);
+          break;
+      }
+    }
+  }
+
+  void handle_identify_producer(
+      const openlcb::EventRegistryEntry& registry_entry,
+      openlcb::EventReport* event, BarrierNotifiable* done) override {
+    AutoNotify an(done);
+    auto r = find_events(event->event);
+    for (EventEntry* e = r.first; e != r.second; ++e) {
+      if ((e->arg & MASK_FOR_BIT) != ENABLE_BIT) {
+        send_identified(*e, done);
+      }
+    }
+  }
+
+  void handle_identify_consumer(
+      const openlcb::EventRegistryEntry& registry_entry,
+      openlcb::EventReport* event, BarrierNotifiable* done) override {
+    AutoNotify an(done);
+    auto r = find_events(event->event);
+    for (EventEntry* e = r.first; e != r.second; ++e) {
+      if ((e->arg & MASK_FOR_BIT) == ENABLE_BIT) {
+        send_identified(*e, done);
+      }
+    }
+  }
+
+  void handle_identify_global(const openlcb::EventRegistryEntry& registry_entry,
+                              openlcb::EventReport* event,
+                              BarrierNotifiable* done) override {
+    AutoNotify an(done);
+    if (event->dst_node && event->dst_node != node_) {
+      return;
+    }
+    if (registry_entry.user_arg != 0) {
+      // The first registry entry answers for all ports at once.
+      return;
+    }
+    for (unsigned i = 0; i < NUM_EVENTS; ++i) {
+      send_identified(events_[i], done);
+    }
+  }
+
+  /// Sends a producer or consumer identified message with the current state
+  /// of an event.
+  void send_identified(const EventEntry& e, BarrierNotifiable* done) {
+    bool producer = (e.arg & MASK_FOR_BIT) != ENABLE_BIT;
+    openlcb::Defs::MTI mti;
+    switch (get_event_state(e)) {
+      case openlcb::EventState::VALID:
+        mti = producer ? openlcb::Defs::MTI_PRODUCER_IDENTIFIED_VALID
+                       : openlcb::Defs::MTI_CONSUMER_IDENTIFIED_VALID;
+        break;
+      case openlcb::EventState::INVALID:
+        mti = producer ? openlcb::Defs::MTI_PRODUCER_IDENTIFIED_INVALID
+                       : openlcb::Defs::MTI_CONSUMER_IDENTIFIED_INVALID;
+        break;
+      default:
+        mti = producer ? openlcb::Defs::MTI_PRODUCER_IDENTIFIED_UNKNOWN
+                       : openlcb::Defs::MTI_CONSUMER_IDENTIFIED_UNKNOWN;
+        break;
+    }
+    auto* flow = node_->iface()->global_message_write_flow();
+    auto* b = flow->alloc();
+    b->data()->reset(mti, node_->node_id(),
+                     openlcb::eventid_to_buffer(e.event));
+    b->set_done(done->new_child());
+    flow->send(b);
+  }
+
+  openlcb::EventState get_event_state(const EventEntry& e) {
+    unsigned p = e.port;
+    openlcb::EventState st = openlcb::EventState::UNKNOWN;
+    switch (e.arg & MASK_FOR_BIT) {
+      case ENABLE_BIT:
+        st = openlcb::to_event_state(get(networkEnable_, p));
+        break;
+      case OVERCURRENT_BIT:
+        if (get(networkOvercurrentKnown_, p)) {
+          st = openlcb::to_event_state(get(killedOutputDueToOvercurrent_, p));
+        }
+        break;
+      case OCCUPANCY_BIT:
+        st = openlcb::to_event_state(get(networkOccupancy_, p));
+        break;
+    };
+    if (!(e.arg & ARG_ON)) {
+      st = invert_event_state(st);
+    }
+    return st;
+  }
+
+  /// @param value is true if the output should be provided with power, false
+  /// if the output should have no power.
+  void set_output_enable(unsigned port, bool value) {
+    put(&commandedEnable_, port, value);
+    enable_ptrs[port]->write(!value);  // inverted
+    if (value) {
+      killedOutputDueToOvercurrent_ &= ~bit(port);
+    }
+  }
+
+  /// Makes a port that waits without a deadline runnable, and wakes up the
+  /// flow.
+  void wakeup(unsigned port) {
+    if (get(parked_, port)) {
+      parked_ &= ~bit(port);
+      deadline_[port] = now_msec();
+      if (idle_) {
+        idle_ = false;
+        notify();
+      } else {
+        timer_.ensure_triggered();
+      }
+    }
+  }
+
+  /// Same as DetectorPort::wakeup_normal_state: only interrupts the wait in
+  /// the normal (track on) state.
+  void wakeup_normal_state(unsigned port) {
+    if (phase_[port] == EVAL_NORMAL_STATE) {
+      wakeup(port);
+    }
+  }
+
+  /// Continues with a phase right away.
+  void go(unsigned port, Phase phase) {
+    phase_[port] = phase;
+  }
+
+  /// Continues with a phase after a delay.
+  void delay(unsigned port, uint32_t now, unsigned msec, Phase phase) {
+    phase_[port] = phase;
+    deadline_[port] = now + msec;
+  }
+
+  /// Continues with a phase when the port gets woken up.
+  void park(unsigned port, Phase phase) {
+    phase_[port] = phase;
+    parked_ |= bit(port);
+  }
+
+  /// Runs all ports that are due, then sleeps until the next deadline. If
+  /// all ports are parked, waits for a wakeup() without a timer.
+  Action evaluate() {
+    uint32_t now = now_msec();
+    uint32_t sleep_msec = 0;
+    bool have_deadline = false;
+    for (unsigned p = 0; p < N; ++p) {
+      while (!get(parked_, p) && int32_t(deadline_[p] - now) <= 0) {
+        step(p, now);
+      }
+      if (!get(parked_, p)) {
+        uint32_t d = deadline_[p] - now;
+        if (!have_deadline || d < sleep_msec) {
+          sleep_msec = d;
+        }
+        have_deadline = true;
+      }
+    }
+    if (!have_deadline) {
+      idle_ = true;
+      return wait_and_call(STATE(evaluate));
+    }
+    return sleep_and_call(&timer_, MSEC_TO_NSEC(sleep_msec), STATE(evaluate));
+  }
+
+  /// Executes one state of the DetectorPort state machine for a port. The
+  /// cases correspond to the Action functions of the same name there.
+  void step(unsigned p, uint32_t now) {
+    switch (phase_[p]) {
+      case INIT_START:
+        put(&networkEnable_, p,
+            g_gpio_stored_bit_set->get_bit(storage_base(p) +
+                                           DetectorPort::NETWORK_ENABLE_OFS));
+        put(&networkOccupancy_, p,
+            g_gpio_stored_bit_set->get_bit(
+                storage_base(p) + DetectorPort::NETWORK_OCCUPANCY_OFS));
+        networkOccupancyKnown_ |= bit(p);
+        return go(p, INIT_WAIT);
+
+      case INIT_WAIT: {
+        // Waits for the parallel running flow that loads the default settings
+        // from EEPROM.
+        if (!opts_.isInitialized_) {
+          return delay(p, now, 5, INIT_WAIT);
+        }
+        if (get(lostDccSignal_, p)) {
+          return delay(p, now, 300, INIT_WAIT);
+        }
+        if (!get(networkEnable_, p)) {
+          return set_network_off(p);
+        }
+        unsigned init_delay_msec =
+            unsigned(opts_.initStaticDelay_) + p * opts_.initStraggleDelay_;
+        return delay(p, now, init_delay_msec, INIT_TRY_TURNON);
+      }
+
+      case INIT_TRY_TURNON:
+        turnonTryCount_[p] = 0;
+        return go(p, TRY_TURNON);
+
+      case TRY_TURNON:
+        if (!get(networkEnable_, p)) {
+          // Someone turned off the output in the meantime.
+          return set_network_off(p);
+        }
+        if (get(lostDccSignal_, p)) {
+          return go(p, WAIT_FOR_DCC_TO_TURN_ON);
+        }
+        set_output_enable(p, true);
+        return delay(p, now, opts_.turnonRetryDelay_, EVAL_TURNON);
+
+      case WAIT_FOR_DCC_TO_TURN_ON:
+        if (!get(lostDccSignal_, p)) {
+          return go(p, INIT_TRY_TURNON);
+        }
+        if (turnonTryCount_[p] < opts_.turnonRetryCount_) {
+          ++turnonTryCount_[p];
+        } else if (get(killedOutputDueToOvercurrent_, p)) {
+          return produce_shorted(p, now);
+        } else {
+          // We do straggled turn-on of all channels if we had to wait too
+          // long for the DCC signal to come back.
+          return go(p, INIT_WAIT);
+        }
+        return delay(p, now, 500, WAIT_FOR_DCC_TO_TURN_ON);
+
+      case EVAL_TURNON:
+        if (!get(networkEnable_, p)) {
+          return set_network_off(p);
+        }
+        if (get(killedOutputDueToOvercurrent_, p)) {
+          // Turnon failed. try again.
+          if (turnonTryCount_[p] < opts_.turnonRetryCount_ &&
+              !get(lostDccSignal_, p)) {
+            turnonTryCount_[p]++;
+            return go(p, TRY_TURNON);
+          }
+          // Turnon failed, no more tries left.
+          return produce_shorted(p, now);
+        }
+        // now: not overcurrent -- we're successfully on.
+        return produce_not_shorted(p);
+
+      case NETWORK_OFF:
+        if (!get(networkEnable_, p)) {
+          // This is a terminal state.
+          return park(p, NETWORK_OFF);
+        }
+        // Turn back on event came.
+        return go(p, INIT_TRY_TURNON);
+
+      case EVAL_NORMAL_STATE:
+        if (get(killedOutputDueToOvercurrent_, p)) {
+          turnonTryCount_[p] = 1;  // already seen a short once
+          return delay(p, now, opts_.turnonRetryDelay_, TRY_TURNON);
+        }
+        if (!get(networkEnable_, p)) {
+          return set_network_off(p);
+        }
+        if (!get(networkOccupancyKnown_, p)) {
+          return produce_occupancy(p);
+        }
+        if (get(networkOccupancy_ ^ sensedOccupancy_, p)) {
+          // We have a change in occupancy.
+          seenOccupancyOff_ &= ~bit(p);
+          seenOccupancyOn_ &= ~bit(p);
+          if (get(sensedOccupancy_, p)) {
+            // No delay in going to occupied.
+            return produce_occupancy(p);
+          }
+          // Block release delay / debouncer.
+          return delay(p, now, opts_.sensorOffDelay_, SENSOR_DEBOUNCE_DONE);
+        }
+        return park(p, EVAL_NORMAL_STATE);
+
+      case SENSOR_DEBOUNCE_DONE:
+        if (get(killedOutputDueToOvercurrent_, p)) {
+          turnonTryCount_[p] = 1;  // already seen a short once
+          return delay(p, now, opts_.turnonRetryDelay_, TRY_TURNON);
+        }
+        if (!get(networkEnable_, p)) {
+          return set_network_off(p);
+        }
+        if (get(seenOccupancyOn_, p)) {
+          // failed the inactivity timer test. Do not produce the event.
+          return go(p, EVAL_NORMAL_STATE);
+        }
+        return produce_occupancy(p);
+    }
+  }
+
+  void set_network_off(unsigned p) {
+    set_output_enable(p, false);
+    park(p, NETWORK_OFF);
+  }
+
+  void produce_shorted(unsigned p, uint32_t now) {
+    if (!get(networkOvercurrent_, p) || !get(networkOvercurrentKnown_, p)) {
+      networkOvercurrent_ |= bit(p);
+      networkOvercurrentKnown_ |= bit(p);
+      produce_event(eventOvercurrentOn_[p]);
+    }
+    // short_wait_for_retry
+    delay(p, now, opts_.shortRetryDelay_, TRY_TURNON);
+  }
+
+  void produce_not_shorted(unsigned p) {
+    if (get(networkOvercurrent_, p) || !get(networkOvercurrentKnown_, p)) {
+      networkOvercurrent_ &= ~bit(p);
+      networkOvercurrentKnown_ |= bit(p);
+      produce_event(eventOvercurrentOff_[p]);
+    }
+    go(p, EVAL_NORMAL_STATE);
+  }
+
+  // Sends off the occupancy event.
+  void produce_occupancy(unsigned p) {
+    bool sensed = get(sensedOccupancy_, p);
+    networkOccupancyKnown_ |= bit(p);
+    put(&networkOccupancy_, p, sensed);
+    g_gpio_stored_bit_set
+        ->set_bit(storage_base(p) + DetectorPort::NETWORK_OCCUPANCY_OFS, sensed)
+        .lock_and_flush();
+    produce_event(sensed ? eventOccupancyOn_[p] : eventOccupancyOff_[p]);
+    go(p, EVAL_NORMAL_STATE);
+  }
+
+  /// Sends an event report. Does not wait for the send to complete; the
+  /// reports still go out in the order they were produced.
+  void produce_event(openlcb::EventId event_id) {
+    auto* flow = node_->iface()->global_message_write_flow();
+    auto* b = flow->alloc();
+    b->data()->reset(openlcb::Defs::MTI_EVENT_REPORT, node_->node_id(),
+                     openlcb::eventid_to_buffer(event_id));
+    flow->send(b);
+  }
+
+  static constexpr unsigned NUM_EVENTS = N * EVENTS_PER_PORT;
+
+  StateFlowTimer timer_{this};
+  openlcb::Node* node_;
+  const DetectorOptions& opts_;
+
+  /// set-once when overcurrent is detected.
+  uint32_t killedOutputDueToOvercurrent_{0};
+  /// set when we detect no DCC signal.
+  uint32_t lostDccSignal_{ALL_PORTS};
+  uint32_t sensedOccupancy_{0};          //< Current (debounced) sensor read
+  uint32_t networkOvercurrent_{0};       //< Current network state
+  uint32_t networkOccupancy_{0};         //< Current network state
+  uint32_t commandedEnable_{0};          //< Current output pin state
+  uint32_t networkEnable_{0};            //< Current input network state
+  uint32_t networkOccupancyKnown_{0};    //< 1 if we've already produced it
+  uint32_t networkOvercurrentKnown_{0};  //< 1 if we've already produced it
+  /// sticky bit set to 1 when sensed occupancy switches to true
+  uint32_t seenOccupancyOn_{0};
+  /// sticky bit set to 1 when sensed occupancy switches to false
+  uint32_t seenOccupancyOff_{0};
+  /// 1 if the port waits for a wakeup instead of a deadline.
+  uint32_t parked_{0};
+  /// True if all ports are parked and the flow waits for a notify().
+  bool idle_{false};
+
+  /// Where each port is in its state machine.
+  Phase phase_[N];
+  /// how many tries we had yet for turning on output.
+  uint8_t turnonTryCount_[N] = {0};
+  /// When each (not parked) port needs to run next, in msec.
+  uint32_t deadline_[N] = {0};
+
+  openlcb::EventId eventOccupancyOn_[N];
+  openlcb::EventId eventOccupancyOff_[N];
+  openlcb::EventId eventOvercurrentOn_[N];
+  openlcb::EventId eventOvercurrentOff_[N];
+  /// All events of all ports, sorted by event ID.
+  EventEntry events_[NUM_EVENTS];
+};
+
+}  // namespace bracz_custom
+
+#endif  // _BRACZ_CUSTOM_DETECTORBANK_HXX_
@@ -38,7 +38,7 @@
 #include <functional>
 
 #include "openlcb/CallbackEventHandler.hxx"
-#include "hardware.hxx"
+#include "os/Gpio.hxx"
 #include "custom/DetectorPortConfig.hxx"
 #include "utils/StoredBitSet.hxx"
 #include "utils/ConfigUpdateListener.hxx"
@@ -238,6 +238,21 @@ class DetectorPort : public StateFlowBase {
     wakeup_normal_state();
   }
 
+  enum StorageConstants {
+    /// The first bit in the storedbitset that belongs to DetectorPorts.
+    CHANNEL_0_OFS = 0,
+    /// How many bits we have reserved per channel.
+    BITS_PER_CHANNEL = 6,
+    /// This bit is true if the output port should be enabled (by the event
+    /// consumer).
+    NETWORK_ENABLE_OFS = 0,
+    /// Whether the track is occupied, according to the last time it was
+    /// enabled.
+    NETWORK_OCCUPANCY_OFS = 1,
+    /// Last known state of the overcurrent bit. TODO: implement
+    NETWORK_OVERCURRENT_OFS = 2,
+  };
+
   /// Sets all stored bits to their factory reset default value.
   static void factory_reset_stored_bits(unsigned port) {
     unsigned ofs = CHANNEL_0_OFS + (port * BITS_PER_CHANNEL);
@@ -538,21 +553,6 @@ class DetectorPort : public StateFlowBase {
     return wait_and_call(c);
   }
 
-  enum StorageConstants {
-    /// The first bit in the storedbitset that belongs to DetectorPorts.
-    CHANNEL_0_OFS = 0,
-    /// How many bits we have reserved per channel.
-    BITS_PER_CHANNEL = 6,
-    /// This bit is true if the output port should be enabled (by the event
-    /// consumer).
-    NETWORK_ENABLE_OFS = 0,
-    /// Whether the track is occupied, according to the last time it was
-    /// enabled.
-    NETWORK_OCCUPANCY_OFS = 1,
-    /// Last known state of the overcurrent bit. TODO: implement
-    NETWORK_OVERCURRENT_OFS = 2,
-  };
-
   /// @return the bit 
   unsigned get_storage_base() {
     return CHANNEL_0_OFS + (channel_ * BITS_PER_CHANNEL);
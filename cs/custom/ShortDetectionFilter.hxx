@@ -0,0 +1,318 @@
+/** \copyright
+ * Copyright (c) 2014, Balazs Racz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are met:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ *  - Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \file ShortDetectionFilter.hxx
+ *
+ * Hardware-independent filter for current samples that decides when an
+ * output is shorted, and keeps the waveform around the trip for analysis.
+ *
+ * @author Balazs Racz
+ * @date 23 Aug 2014
+ */
+
+#ifndef _BRACZ_CUSTOM_SHORTDETECTIONFILTER_HXX_
+#define _BRACZ_CUSTOM_SHORTDETECTIONFILTER_HXX_
+
+#include <stdint.h>
+#include <string.h>
+
+namespace bracz_custom {
+
+/// Keeps the last RING_SIZE current samples with their timestamps in a ring
+/// buffer, and maintains the RMS and peak value over a sliding window of the
+/// most recent samples.
+///
+/// A single sample above the kill limit trips the filter immediately. The
+/// window RMS above the RMS limit trips it once the window is full, so short
+/// spikes (e.g. charging a decoder's capacitors) do not cause nuisance trips.
+///
+/// On every trip the filter takes a snapshot of the ring buffer, containing
+/// the samples before the trip and a configurable number of samples after
+/// it.
+template <unsigned RING_SIZE = 64>
+class ShortDetectionFilter {
+ public:
+  static_assert(RING_SIZE <= 256, "tripIndex must fit 8 bits");
+
+  /// One sample in the ring buffer.
+  struct Sample {
+    /// When the sample was taken, in microseconds. Wraps around.
+    uint32_t tsUsec;
+    /// ADC reading.
+    uint16_t value;
+    uint16_t reserved;
+  };
+
+  /// Outcome of adding a sample.
+  enum Result : uint8_t {
+    OK = 0,
+    /// Window RMS is over the limit.
+    OVERCURRENT = 1,
+    /// A single sample is over the kill limit.
+    KILL = 2,
+  };
+
+  /// Snapshot of the waveform around the last trip. This is exported as
+  /// raw bytes (host byte order) via a memory space.
+  struct Capture {
+    /// Incremented every time a snapshot is completed.
+    uint32_t tripCount;
+    /// Result value that caused the trip.
+    uint8_t reason;
+    /// Index in samples[] of the sample that caused the trip.
+    uint8_t tripIndex;
+    /// Window size at the time of the trip.
+    uint16_t window;
+    /// Window RMS at the time of the trip.
+    uint16_t rms;
+    /// Window peak at the time of the trip.
+    uint16_t peak;
+    /// The samples, oldest first.
+    Sample samples[RING_SIZE];
+  };
+
+  /// Constructor.
+  /// @param window how many recent samples the RMS and peak is computed
+  /// over (1..RING_SIZE).
+  /// @param rms_limit trip when the window RMS is above this.
+  /// @param kill_limit trip when a single sample is above this.
+  /// @param post_trip how many samples after the trip to include in the
+  /// snapshot (less than RING_SIZE).
+  ShortDetectionFilter(unsigned window, uint16_t rms_limit,
+                       uint16_t kill_limit, unsigned post_trip = RING_SIZE / 4)
+      : rmsLimit_(rms_limit),
+        killLimit_(kill_limit),
+        postTrip_(post_trip < RING_SIZE ? post_trip : RING_SIZE - 1) {
+    memset(ring_, 0, sizeof(ring_));
+    memset(&capture_, 0, sizeof(capture_));
+    memset(&pending_, 0, sizeof(pending_));
+    set_window(window);
+  }
+
+  /// Changes the window size. Restarts the window.
+  void set_window(unsigned window) {
+    if (window < 1) {
+      window = 1;
+    }
+    if (window > RING_SIZE) {
+      window = RING_SIZE;
+    }
+    window_ = window;
+    clear_window();
+  }
+
+  /// Forgets the samples in the window (but not the ring buffer). Call this
+  /// after re-enabling an output so that samples from before the trip do not
+  /// cause another trip.
+  void clear_window() {
+    filled_ = 0;
+    sumSquares_ = 0;
+    peak_ = 0;
+  }
+
+  /// Adds a new sample.
+  /// @param value the ADC reading.
+  /// @param ts_usec the time of the reading in microseconds.
+  /// @return whether the output needs to be turned off.
+  Result add(uint16_t value, uint32_t ts_usec) {
+    if (filled_ >= window_) {
+      // The oldest sample in the window leaves.
+      uint16_t old = ring_[(head_ + RING_SIZE - window_) % RING_SIZE].value;
+      sumSquares_ -= uint64_t(old) * old;
+      --filled_;
+      if (old >= peak_) {
+        needRescan_ = true;
+      }
+    }
+    store(value, ts_usec);
+    ++filled_;
+    sumSquares_ += uint64_t(value) * value;
+    if (needRescan_) {
+      rescan_peak();
+    } else if (value > peak_) {
+      peak_ = value;
+    }
+
+    Result ret = OK;
+    if (value > killLimit_) {
+      ret = KILL;
+    } else if (filled_ >= window_ && rms() > rmsLimit_) {
+      ret = OVERCURRENT;
+    }
+    if (ret != OK) {
+      trigger_capture(ret);
+    }
+    return ret;
+  }
+
+  /// Adds a sample to the ring buffer only, e.g. while the output is off
+  /// after a trip. It advances a snapshot in progress, but never trips. The
+  /// window is restarted, since the samples around this one do not count.
+  /// @param value the ADC reading.
+  /// @param ts_usec the time of the reading in microseconds.
+  void record(uint16_t value, uint32_t ts_usec) {
+    clear_window();
+    store(value, ts_usec);
+  }
+
+  /// Completes a snapshot in progress right away, with the samples after the
+  /// trip that arrived so far. Call this before the samples stop belonging
+  /// to the trip, e.g. before re-enabling the output.
+  void finish_capture() {
+    if (pendingPost_) {
+      take_snapshot();
+    }
+  }
+
+  /// Starts a snapshot with the last added sample as the trip point. Does
+  /// nothing if a snapshot is already in progress. Useful for callers that
+  /// make the trip decision themselves.
+  void trigger_capture(Result reason) {
+    if (pendingPost_) {
+      return;
+    }
+    // The previous snapshot stays intact until the new one is complete.
+    pending_.reason = reason;
+    pending_.window = window_;
+    pending_.rms = rms();
+    pending_.peak = peak_;
+    if (postTrip_ == 0) {
+      take_snapshot();
+    } else {
+      pendingPost_ = postTrip_;
+    }
+  }
+
+  /// @return the RMS of the samples in the window.
+  uint16_t rms() const {
+    if (!filled_) {
+      return 0;
+    }
+    return isqrt(sumSquares_ / filled_);
+  }
+
+  /// @return the largest sample in the window.
+  uint16_t peak() const {
+    return peak_;
+  }
+
+  /// @return how many samples the window currently has.
+  unsigned filled() const {
+    return filled_;
+  }
+
+  /// @return the snapshot of the last trip. Stable in memory.
+  const Capture& capture() const {
+    return capture_;
+  }
+
+ private:
+  /// Puts a sample into the ring buffer and advances a snapshot in
+  /// progress.
+  void store(uint16_t value, uint32_t ts_usec) {
+    ring_[head_].tsUsec = ts_usec;
+    ring_[head_].value = value;
+    head_ = (head_ + 1) % RING_SIZE;
+    if (pendingPost_) {
+      if (--pendingPost_ == 0) {
+        take_snapshot();
+      }
+    }
+  }
+
+  void rescan_peak() {
+    needRescan_ = false;
+    peak_ = 0;
+    for (unsigned i = 1; i <= filled_; ++i) {
+      uint16_t v = ring_[(head_ + RING_SIZE - i) % RING_SIZE].value;
+      if (v > peak_) {
+        peak_ = v;
+      }
+    }
+  }
+
+  /// Copies the ring buffer into the capture, oldest sample first.
+  void take_snapshot() {
+    capture_.reason = pending_.reason;
+    capture_.window = pending_.window;
+    capture_.rms = pending_.rms;
+    capture_.peak = pending_.peak;
+    for (unsigned i = 0; i < RING_SIZE; ++i) {
+      capture_.samples[i] = ring_[(head_ + i) % RING_SIZE];
+    }
+    // pendingPost_ is nonzero if the snapshot was finished early.
+    capture_.tripIndex = RING_SIZE - 1 - (postTrip_ - pendingPost_);
+    pendingPost_ = 0;
+    ++capture_.tripCount;
+  }
+
+  /// Integer square root (floor).
+  static uint16_t isqrt(uint32_t v) {
+    uint32_t res = 0;
+    uint32_t bit = 1u << 30;
+    while (bit > v) {
+      bit >>= 2;
+    }
+    while (bit) {
+      if (v >= res + bit) {
+        v -= res + bit;
+        res = (res >> 1) + bit;
+      } else {
+        res >>= 1;
+      }
+      bit >>= 2;
+    }
+    return res;
+  }
+
+  uint16_t rmsLimit_;
+  uint16_t killLimit_;
+  unsigned postTrip_;
+  unsigned window_;
+  /// Number of samples in the window (up to window_).
+  unsigned filled_{0};
+  /// Sum of squares of the samples in the window.
+  uint64_t sumSquares_{0};
+  uint16_t peak_{0};
+  bool needRescan_{false};
+  /// Where the next sample goes in ring_.
+  unsigned head_{0};
+  /// How many more samples to wait for before taking the snapshot.
+  unsigned pendingPost_{0};
+  /// Trip details for the snapshot in progress.
+  struct {
+    uint8_t reason;
+    uint16_t window;
+    uint16_t rms;
+    uint16_t peak;
+  } pending_;
+  Sample ring_[RING_SIZE];
+  Capture capture_;
+};
+
+}  // namespace bracz_custom
+
+#endif  // _BRACZ_CUSTOM_SHORTDETECTIONFILTER_HXX_
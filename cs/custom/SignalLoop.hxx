@@ -36,6 +36,8 @@
 #ifndef _BRACZ_CUSTOM_SIGNALLOOP_HXX_
 #define _BRACZ_CUSTOM_SIGNALLOOP_HXX_
 
+#include <vector>
+
 #include "utils/Singleton.hxx"
 #include "utils/BusMaster.hxx"
 #include "openlcb/EventHandlerTemplates.hxx"
@@ -65,6 +67,8 @@ class SignalLoopInterface : public Singleton<SignalLoopInterface> {
 enum SignalPriorities {
   // When an aspect needs to be modified due to an event.
   LIVE_UPDATE,
+  // Repeating a recently changed aspect for reliability.
+  ASPECT_REPEAT,
   // Polling button states.
   BUTTON_POLL,
   // Background refreshes of displays.
@@ -82,6 +86,7 @@ enum SignalPriorities {
 /// then no token will pass through to the next level.
 static constexpr Fixed16 SIGNAL_PRIORITIES[SignalPriorities::NUM_PRIORITIES] = {
     {Fixed16::FROM_DOUBLE, 0.8},  // live update
+    {Fixed16::FROM_DOUBLE, 0.8},  // aspect repeat
     {Fixed16::FROM_DOUBLE, 0.8},  // button poll
     {Fixed16::FROM_DOUBLE, 0.8},  // display refresh
     {1, 0},                       // aspect refresh
@@ -147,6 +152,22 @@ class SignalLoop : public StateFlowBase,
    * a refresh cycle. */
   static const int REFRESH_DELAY_MSEC = 700;
 
+  /** How many (address, aspect) pairs fit into one SCMD_MULTI_ASPECT
+   * packet. The receivers have a 32-byte packet buffer, which includes the
+   * length and command bytes. */
+  static const unsigned MAX_ASPECT_PAIRS = 15;
+
+  /** After a live update, the new aspect is sent this many more times. */
+  static const unsigned LIVE_REPEAT_COUNT = 2;
+  /** Minimum time between the repeats of a changed aspect. */
+  static const unsigned REPEAT_DELAY_MSEC = 50;
+  /** A signal whose aspect was not sent for this long gets a scheduled
+   * refresh. Below this age signals are only refreshed when the bus would
+   * otherwise be idle. */
+  static const unsigned STALE_BUDGET_MSEC = 3000;
+  /** How often we look for signals that need a repeat or refresh. */
+  static const unsigned REFRESH_TICK_MSEC = 50;
+
   SignalLoop(SignalPacketBaseInterface* bus, openlcb::Node* node,
              uint64_t event_base, int num_signals)
       : StateFlowBase(node->iface()),
@@ -159,6 +180,14 @@ class SignalLoop : public StateFlowBase,
         go_sleep_(0),
         waiting_(0),
         paused_(0),
+        multiAspect_(0),
+        liveScheduled_(0),
+        refreshScheduled_(0),
+        dirty_((num_signals + 31) / 32, 0),
+        schedule_(num_signals),
+        liveUpdater_(this),
+        refresher_(this),
+        refreshTicker_(node->iface()->executor()->active_timers(), this),
         timer_(this),
         bootSender_(node->iface()->executor()->active_timers(), this),
         busMaster_(node->iface(), bus, /*idle=*/this, 3)
@@ -173,11 +202,12 @@ class SignalLoop : public StateFlowBase,
     lastUpdateTime_ = os_get_time_monotonic();
     busMaster_.set_policy((unsigned)SignalPriorities::NUM_PRIORITIES,
                           SIGNAL_PRIORITIES);
-    busMaster_.schedule_activity(this, SignalPriorities::ASPECT_REFRESH);
+    refreshTicker_.start(MSEC_TO_NSEC(REFRESH_TICK_MSEC));
     bootSender_.ensure_started();
   }
 
   ~SignalLoop() {
+    refreshTicker_.cancel();
     bootSender_.stop_timer();
     free(backingStore_);
   }
@@ -198,6 +228,39 @@ class SignalLoop : public StateFlowBase,
     bus_->send(b);
   }
 
+  /// Fills in the header of a broadcast packet carrying the aspects of
+  /// multiple signals. Use add_aspect_pair() to add the signals.
+  void prep_multi_aspect_packet(Buffer<SignalPacket>* b) {
+    auto& s = b->data()->payload_;
+    s.clear();
+    s.push_back(0);  // broadcast address
+    s.push_back(2);  // len
+    s.push_back(SCMD_MULTI_ASPECT);
+  }
+
+  /// Appends the current address and aspect of a signal to a packet that was
+  /// prepared by prep_multi_aspect_packet.
+  /// @param signal index of the signal in the backing store.
+  /// @return false if the packet is full and the signal was not added.
+  bool add_aspect_pair(Buffer<SignalPacket>* b, unsigned signal) {
+    auto& s = b->data()->payload_;
+    if (s[1] >= 2 + 2 * MAX_ASPECT_PAIRS) {
+      return false;
+    }
+    s.push_back(backingStore_[signal << 1]);
+    s.push_back(backingStore_[(signal << 1) + 1]);
+    s[1] += 2;
+    return true;
+  }
+
+  /// Selects whether refreshes and live updates go out as SCMD_MULTI_ASPECT
+  /// broadcast packets (true) or one SCMD_ASPECT packet per signal (false,
+  /// default). All devices on the loop have to understand SCMD_MULTI_ASPECT
+  /// before this can be turned on.
+  void set_multi_aspect(bool enabled) {
+    multiAspect_ = enabled ? 1 : 0;
+  }
+
   Action refresh() {
     lastUpdateTime_ += MSEC_TO_NSEC(REFRESH_DELAY_MSEC);
     long long next_refresh_time = lastUpdateTime_ - os_get_time_monotonic();
@@ -232,9 +295,85 @@ class SignalLoop : public StateFlowBase,
     if (nextSignal_ >= numSignals_) {
       nextSignal_ = 0;
     }
-    prep_update_packet(packet, backingStore_[nextSignal_ << 1],
-                       backingStore_[(nextSignal_ << 1) + 1]);
-    busMaster_.schedule_activity(this, SignalPriorities::ASPECT_REFRESH);
+    uint32_t now = now_msec();
+    if (!multiAspect_ || !backingStore_[nextSignal_ << 1]) {
+      // Address zero is a broadcast aspect, it cannot be a pair.
+      prep_update_packet(packet, backingStore_[nextSignal_ << 1],
+                         backingStore_[(nextSignal_ << 1) + 1]);
+      mark_refreshed(nextSignal_, now);
+      ++nextSignal_;
+    } else {
+      prep_multi_aspect_packet(packet);
+      while (nextSignal_ < numSignals_) {
+        if (backingStore_[nextSignal_ << 1]) {
+          if (!add_aspect_pair(packet, nextSignal_)) {
+            break;
+          }
+          mark_refreshed(nextSignal_, now);
+        }
+        ++nextSignal_;
+      }
+    }
+  }
+
+  /// Called periodically. Schedules the refresher activity if there is any
+  /// signal whose repeat or refresh is due.
+  void refresh_tick() {
+    if (paused_ || refreshScheduled_) {
+      return;
+    }
+    uint32_t now = now_msec();
+    for (unsigned i = 0; i < numSignals_; ++i) {
+      if (is_due(i, now)) {
+        schedule_refresher(now);
+        return;
+      }
+    }
+  }
+
+  /// Renders a packet with the signals whose repeat or refresh is due.
+  void fill_refresh_packet(SignalBus::Packet* packet) {
+    refreshScheduled_ = 0;
+    uint32_t now = now_msec();
+    auto& s = packet->data()->payload_;
+    s.clear();
+    if (multiAspect_) {
+      prep_multi_aspect_packet(packet);
+      for (unsigned i = 0; i < numSignals_; ++i) {
+        if (!backingStore_[i << 1] || !is_due(i, now)) {
+          continue;
+        }
+        if (!add_aspect_pair(packet, i)) {
+          break;
+        }
+        mark_sent(i, now);
+      }
+      if (s[1] == 2) {
+        s.clear();
+      }
+    }
+    if (s.empty()) {
+      for (unsigned i = 0; i < numSignals_; ++i) {
+        if (is_due(i, now)) {
+          prep_update_packet(packet, backingStore_[i << 1],
+                             backingStore_[(i << 1) + 1]);
+          mark_sent(i, now);
+          break;
+        }
+      }
+    }
+    if (s.empty()) {
+      // Nothing became due since the scheduling; we still owe the bus master
+      // a packet.
+      fill_packet(packet);
+      return;
+    }
+    for (unsigned i = 0; i < numSignals_; ++i) {
+      if (is_due(i, now)) {
+        schedule_refresher(now);
+        return;
+      }
+    }
   }
   
   Action fill_packet() {
@@ -247,12 +386,65 @@ class SignalLoop : public StateFlowBase,
   }
 
   /// Called by ByteRangeEventC when an event changes one of the entries in the
-  /// backing store.
+  /// backing store. The signal is only marked dirty here; the packet is
+  /// rendered when the bus master has a free buffer, so multiple changes to
+  /// the same signal in the meantime are coalesced into one update.
   void notify_changed(unsigned offset) override {
-    auto* b = bus_->alloc();  // sync alloc -- not very nice.
-    send_update(b, backingStore_[offset & ~1], backingStore_[offset | 1]);
+    unsigned signal = offset >> 1;
+    dirty_[signal >> 5] |= 1u << (signal & 31);
     lastUpdateTime_ = os_get_time_monotonic();
     go_sleep_ = 1;
+    if (!liveScheduled_) {
+      liveScheduled_ = 1;
+      busMaster_.schedule_activity(&liveUpdater_,
+                                   SignalPriorities::LIVE_UPDATE);
+    }
+  }
+
+  /// Renders the next packet from the queue of changed signals.
+  void fill_live_packet(SignalBus::Packet* packet) {
+    auto& s = packet->data()->payload_;
+    s.clear();
+    if (multiAspect_) {
+      prep_multi_aspect_packet(packet);
+      for (unsigned i = 0; i < numSignals_; ++i) {
+        if (!dirty_[i >> 5]) {
+          i |= 31;
+          continue;
+        }
+        if (!is_dirty(i) || !backingStore_[i << 1]) {
+          continue;
+        }
+        if (!add_aspect_pair(packet, i)) {
+          break;
+        }
+        clear_dirty(i);
+        mark_changed_sent(i);
+      }
+      if (s[1] == 2) {
+        // Only broadcast-addressed signals were dirty.
+        s.clear();
+      }
+    }
+    if (s.empty()) {
+      for (unsigned i = 0; i < numSignals_; ++i) {
+        if (is_dirty(i)) {
+          clear_dirty(i);
+          prep_update_packet(packet, backingStore_[i << 1],
+                             backingStore_[(i << 1) + 1]);
+          mark_changed_sent(i);
+          break;
+        }
+      }
+    }
+    for (uint32_t d : dirty_) {
+      if (d) {
+        busMaster_.schedule_activity(&liveUpdater_,
+                                     SignalPriorities::LIVE_UPDATE);
+        return;
+      }
+    }
+    liveScheduled_ = 0;
   }
 
   void enable_loop() OVERRIDE {
@@ -274,6 +466,116 @@ class SignalLoop : public StateFlowBase,
   }
 
  private:
+  /// Bus activity that sends out the queued aspect changes.
+  class LiveUpdater : public SignalBus::Activity {
+   public:
+    LiveUpdater(SignalLoop* parent) : parent_(parent) {}
+
+    void fill_packet(SignalBus::Packet* packet) override {
+      parent_->fill_live_packet(packet);
+    }
+
+   private:
+    SignalLoop* parent_;
+  };
+
+  /// Bus activity that sends the repeats and the refreshes that are due.
+  class Refresher : public SignalBus::Activity {
+   public:
+    Refresher(SignalLoop* parent) : parent_(parent) {}
+
+    void fill_packet(SignalBus::Packet* packet) override {
+      parent_->fill_refresh_packet(packet);
+    }
+
+   private:
+    SignalLoop* parent_;
+  };
+
+  /// Periodically calls refresh_tick().
+  class RefreshTicker : public ::Timer {
+   public:
+    RefreshTicker(ActiveTimers* timers, SignalLoop* parent)
+        : ::Timer(timers), parent_(parent) {}
+
+    long long timeout() override {
+      parent_->refresh_tick();
+      return RESTART;
+    }
+
+   private:
+    SignalLoop* parent_;
+  };
+
+  /// Per-signal state for the refresh scheduling.
+  struct SignalSchedule {
+    /// When the aspect of this signal was last sent to the bus.
+    uint32_t last_sent_msec = 0;
+    /// How many more times a recently changed aspect needs to be sent.
+    uint8_t repeats_left = 0;
+  };
+
+  static uint32_t now_msec() {
+    return os_get_time_monotonic() / 1000000;
+  }
+
+  /// @return true if the signal is in use and its repeat or refresh is due.
+  bool is_due(unsigned signal, uint32_t now) {
+    if (signal > 0 && !backingStore_[signal << 1]) {
+      return false;
+    }
+    uint32_t age = now - schedule_[signal].last_sent_msec;
+    if (schedule_[signal].repeats_left) {
+      return age >= REPEAT_DELAY_MSEC;
+    }
+    return age >= STALE_BUDGET_MSEC;
+  }
+
+  /// Records that the aspect of a signal was sent to the bus.
+  void mark_sent(unsigned signal, uint32_t now) {
+    schedule_[signal].last_sent_msec = now;
+    if (schedule_[signal].repeats_left) {
+      --schedule_[signal].repeats_left;
+    }
+  }
+
+  /// Records an idle refresh of a signal. These do not count as repeats,
+  /// because they are not spaced apart in time.
+  void mark_refreshed(unsigned signal, uint32_t now) {
+    if (!schedule_[signal].repeats_left) {
+      schedule_[signal].last_sent_msec = now;
+    }
+  }
+
+  /// Records that a new aspect of a signal was sent to the bus for the first
+  /// time.
+  void mark_changed_sent(unsigned signal) {
+    schedule_[signal].last_sent_msec = now_msec();
+    schedule_[signal].repeats_left = LIVE_REPEAT_COUNT;
+  }
+
+  /// Puts the refresher into the bus master. Pending repeats use a higher
+  /// priority than plain refreshes.
+  void schedule_refresher(uint32_t now) {
+    unsigned prio = SignalPriorities::ASPECT_REFRESH;
+    for (unsigned i = 0; i < numSignals_; ++i) {
+      if (schedule_[i].repeats_left && is_due(i, now)) {
+        prio = SignalPriorities::ASPECT_REPEAT;
+        break;
+      }
+    }
+    refreshScheduled_ = 1;
+    busMaster_.schedule_activity(&refresher_, prio);
+  }
+
+  bool is_dirty(unsigned signal) {
+    return dirty_[signal >> 5] & (1u << (signal & 31));
+  }
+
+  void clear_dirty(unsigned signal) {
+    dirty_[signal >> 5] &= ~(1u << (signal & 31));
+  }
+
   long long lastUpdateTime_;
   SignalPacketBaseInterface* bus_;
   uint8_t* backingStore_;
@@ -283,6 +585,18 @@ class SignalLoop : public StateFlowBase,
   unsigned go_sleep_ : 1;  // 1 if there was an update from the changed callback
   unsigned waiting_ : 1;  // 1 during sleep until next refresh
   unsigned paused_ : 1;
+  unsigned multiAspect_ : 1;  // 1 if we send SCMD_MULTI_ASPECT packets
+  unsigned liveScheduled_ : 1;  // 1 if liveUpdater_ is in the bus master
+  unsigned refreshScheduled_ : 1;  // 1 if refresher_ is in the bus master
+
+  /// One bit per signal, set if the signal changed since its last live
+  /// update.
+  std::vector<uint32_t> dirty_;
+  /// Refresh state for each signal.
+  std::vector<SignalSchedule> schedule_;
+  LiveUpdater liveUpdater_;
+  Refresher refresher_;
+  RefreshTicker refreshTicker_;
 
   BarrierNotifiable n_;
   StateFlowTimer timer_;
@@ -35,6 +35,10 @@
 #ifndef _BRACZ_CUSTOM_SPEEDFEEDBACKCONTROLLER_HXX_
 #define _BRACZ_CUSTOM_SPEEDFEEDBACKCONTROLLER_HXX_
 
+#include <stdint.h>
+
+#include <algorithm>
+
 #include "openlcb/ConfigRepresentation.hxx"
 #include "utils/ConfigUpdateListener.hxx"
 #include "utils/Ewma.hxx"
@@ -62,22 +66,360 @@ CDI_GROUP_ENTRY(
     Description("Minimum power value that the motor needs to turn."));
 CDI_GROUP_END();
 
+/// Selects the regulator algorithm. This is a separate group from
+/// FeedbackParams so that existing configuration layouts stay valid.
+CDI_GROUP(FeedbackMode, Name("Load control mode"));
+CDI_GROUP_ENTRY(
+    algorithm, openlcb::Uint8ConfigEntry, Name("Regulator"), Min(0), Max(1),
+    Default(0),
+    Description(
+        "0 = step adjustment: the output changes by the (clamped) error every "
+        "cycle. 1 = PI controller: adjustment is the proportional gain (16 = "
+        "1/16 power step per measurement unit), integration is the integral "
+        "time in cycles, maximum adjustment limits the output change per "
+        "cycle."));
+CDI_GROUP_ENTRY(
+    autotune, openlcb::Uint8ConfigEntry, Name("Auto-tune"), Min(0), Max(1),
+    Default(0),
+    Description(
+        "Write 1 to measure the step response of the motor the next time the "
+        "train is moving. The measured parameters are written to the load "
+        "control settings and the PI controller is selected. Reads 0 when "
+        "done."));
+CDI_GROUP_END();
+
+/// Fixed-point PI regulator with output clamping and slew rate limit. Uses
+/// no floating point math.
+class FixedPointPi {
+ public:
+  /// Sets the tuning parameters.
+  /// @param kp proportional gain in 1/256 output units per measurement unit.
+  /// @param ti integral time in ticks. 0 turns off the integral term.
+  /// @param max_step maximum output change per tick. 0 = unlimited.
+  /// @param min_out minimum output when the desired value is non-zero.
+  void set_params(uint8_t kp, uint8_t ti, uint8_t max_step, uint8_t min_out) {
+    kp_ = kp;
+    ti_ = ti;
+    maxStep_ = max_step;
+    minOut_ = min_out;
+  }
+
+  /// Restarts the regulation from a given state.
+  /// @param measurement current measured value.
+  /// @param output the output value currently applied.
+  void reset(uint16_t measurement, uint8_t output) {
+    filtered_ = int32_t(measurement) << FILTER_SHIFT;
+    integral_ = ti_ ? int32_t(output) << 8 : 0;
+    integralRem_ = 0;
+    lastOutput_ = output;
+  }
+
+  /// Runs one regulation step.
+  /// @param desired target measurement value. 0 turns the output off.
+  /// @param measurement latest measured value.
+  /// @return output value (0..255).
+  uint8_t tick(uint16_t desired, uint16_t measurement) {
+    filtered_ += ((int32_t(measurement) << FILTER_SHIFT) - filtered_) / 2;
+    if (!desired) {
+      integral_ = 0;
+      integralRem_ = 0;
+      lastOutput_ = 0;
+      return 0;
+    }
+    int32_t err = int32_t(desired) - filtered();
+    int32_t p = err * kp_;
+    int32_t integral = integral_;
+    int32_t rem = integralRem_;
+    if (ti_) {
+      // The remainder of the division is carried to the next tick, otherwise
+      // small errors with a long integral time would never integrate.
+      rem += p;
+      integral += rem / ti_;
+      rem %= ti_;
+    }
+    int32_t u = (p + integral) / 256;
+
+    int32_t lo = minOut_;
+    int32_t hi = 255;
+    if (maxStep_) {
+      lo = std::max(lo, int32_t(lastOutput_) - maxStep_);
+      hi = std::min(hi, int32_t(lastOutput_) + maxStep_);
+      hi = std::max(hi, lo);
+    }
+    int32_t out = std::min(std::max(u, lo), hi);
+    if (out != u && ti_) {
+      // Anti-windup: the integral tracks what the output could actually do.
+      integral = out * 256 - p;
+      rem = 0;
+    }
+    integral_ = integral;
+    integralRem_ = rem;
+    lastOutput_ = out;
+    return out;
+  }
+
+  /// @return the low-pass filtered measurement.
+  uint16_t filtered() const {
+    return filtered_ >> FILTER_SHIFT;
+  }
+
+ private:
+  /// Fractional bits of the measurement filter state.
+  static constexpr unsigned FILTER_SHIFT = 4;
+
+  /// Measurement low-pass filter state.
+  int32_t filtered_{0};
+  /// Integral term, in 1/256 output units.
+  int32_t integral_{0};
+  /// Part of the integral not yet added to integral_, in 1/(256 * ti_)
+  /// output units.
+  int32_t integralRem_{0};
+  uint8_t kp_{16};
+  uint8_t ti_{20};
+  uint8_t maxStep_{16};
+  uint8_t minOut_{0};
+  uint8_t lastOutput_{0};
+};
+
+/// Measures the open-loop step response of the motor and derives PI
+/// parameters from it (SIMC rules for a first order plant with dead time).
+///
+/// Holds the output at a base power until the measurement settles, then
+/// raises it by STEP_POWER and records the response.
+class FeedbackAutoTuner {
+ public:
+  /// Ticks to hold the base power before the step.
+  static constexpr unsigned SETTLE_TICKS = 8;
+  /// Ticks to record after the step.
+  static constexpr unsigned STEP_TICKS = 48;
+  /// Size of the output step.
+  static constexpr unsigned STEP_POWER = 32;
+  /// Smallest measurement change that counts as a response.
+  static constexpr int32_t MIN_RESPONSE = 8;
+
+  enum State : uint8_t {
+    IDLE,
+    SETTLE,
+    STEP,
+    DONE,
+    FAILED,
+  };
+
+  /// Starts a measurement.
+  /// @param base_power output to hold before the step.
+  void start(uint8_t base_power) {
+    base_ = std::min(unsigned(base_power), 255 - STEP_POWER);
+    state_ = SETTLE;
+    count_ = 0;
+    baseSum_ = 0;
+  }
+
+  /// Stops the measurement without a result.
+  void abort() {
+    state_ = IDLE;
+  }
+
+  State state() const {
+    return state_;
+  }
+
+  /// @return true if the measurement is in progress.
+  bool running() const {
+    return state_ == SETTLE || state_ == STEP;
+  }
+
+  /// Feeds one measurement.
+  /// @return the output value to apply until the next tick.
+  uint8_t tick(uint16_t measurement) {
+    switch (state_) {
+      case SETTLE:
+        if (count_ >= SETTLE_TICKS - 4) {
+          baseSum_ += measurement;
+        }
+        if (++count_ < SETTLE_TICKS) {
+          return base_;
+        }
+        state_ = STEP;
+        count_ = 0;
+        return base_ + STEP_POWER;
+      case STEP:
+        samples_[count_++] = measurement;
+        if (count_ >= STEP_TICKS) {
+          evaluate();
+        }
+        return base_ + STEP_POWER;
+      default:
+        return base_;
+    }
+  }
+
+  /// Results, valid in state DONE. Same units as FixedPointPi::set_params.
+  uint8_t kp() const {
+    return kp_;
+  }
+  uint8_t ti() const {
+    return ti_;
+  }
+  uint8_t max_step() const {
+    return maxStep_;
+  }
+
+ private:
+  static uint8_t clip(int32_t v, int32_t lo) {
+    return std::min(std::max(v, lo), int32_t(255));
+  }
+
+  void evaluate() {
+    int32_t y0 = baseSum_ / 4;
+    int32_t y1 = 0;
+    for (unsigned i = STEP_TICKS - 4; i < STEP_TICKS; ++i) {
+      y1 += samples_[i];
+    }
+    y1 /= 4;
+    int32_t dy = y1 - y0;
+    if (dy < MIN_RESPONSE) {
+      state_ = FAILED;
+      return;
+    }
+    // Dead time: first sample above 10% of the response. Time constant:
+    // from there until 63% of the response.
+    int32_t dead = -1;
+    int32_t t63 = STEP_TICKS - 1;
+    for (unsigned i = 0; i < STEP_TICKS; ++i) {
+      int32_t d = int32_t(samples_[i]) - y0;
+      if (dead < 0 && d * 10 > dy) {
+        dead = i;
+      }
+      if (d * 1000 >= dy * 632) {
+        t63 = i;
+        break;
+      }
+    }
+    if (dead < 0) {
+      dead = t63;
+    }
+    int32_t tau = t63 + 1 - dead;
+    // Closed loop time constant. Twice the dead time leaves margin for the
+    // measurement filter and the sampling delay.
+    int32_t tc = std::max(2 * dead, int32_t(2));
+    kp_ = clip(256 * tau * int32_t(STEP_POWER) / (dy * (dead + tc)), 1);
+    ti_ = clip(std::min(tau, 4 * (tc + dead)), 1);
+    // Allow the full output range to be traversed in about two settling
+    // times.
+    maxStep_ = clip(256 / (2 * (tau + dead)), 4);
+    state_ = DONE;
+  }
+
+  uint16_t samples_[STEP_TICKS];
+  int32_t baseSum_{0};
+  uint8_t count_{0};
+  uint8_t base_{0};
+  uint8_t kp_{0};
+  uint8_t ti_{0};
+  uint8_t maxStep_{0};
+  State state_{IDLE};
+};
+
 class SpeedFeedbackController : private DefaultConfigUpdateListener {
  public:
-  SpeedFeedbackController(FeedbackParams par) : par_(par), flushState_(1) {}
+  /// Constructor for the step adjustment regulator only.
+  SpeedFeedbackController(FeedbackParams par)
+      : par_(par),
+        mode_(0),
+        hasMode_(0),
+        usePi_(0),
+        tuneRequested_(0),
+        flushState_(1),
+        savePending_(0),
+        saveParams_(0) {}
 
-  void reset_to_zero() { flushState_ = 1; }
+  /// Constructor with selectable regulator and auto-tuning.
+  SpeedFeedbackController(FeedbackParams par, FeedbackMode mode)
+      : par_(par),
+        mode_(mode),
+        hasMode_(1),
+        usePi_(0),
+        tuneRequested_(0),
+        flushState_(1),
+        savePending_(0),
+        saveParams_(0) {}
+
+  void reset_to_zero() {
+    flushState_ = 1;
+    tuner_.abort();
+  }
 
   void set_desired_rate(uint16_t rate) { desiredRate_ = rate; }
 
   uint8_t measure_tick(uint16_t measurement) {
+    uint8_t newValue;
+    uint16_t filtered;
     if (flushState_) {
       flushState_ = 0;
       measEwma_.reset_state(measurement);
+      pi_.reset(measurement, 0);
       lastOutputValue_ = 0;
+    }
+    if (!desiredRate_) {
+      tuner_.abort();
+    } else if (tuneRequested_ && !tuner_.running()) {
+      tuner_.start(std::max(lastOutputValue_, minPower_));
+    }
+    if (tuner_.running()) {
+      newValue = tuner_.tick(measurement);
+      if (!tuner_.running()) {
+        finish_tuning();
+        pi_.reset(measurement, newValue);
+      }
+      filtered = measurement;
+    } else if (usePi_) {
+      newValue = pi_.tick(desiredRate_, measurement);
+      filtered = pi_.filtered();
     } else {
-      measEwma_.add_value(measurement);
+      newValue = step_tick(measurement);
+      filtered = measEwma_.avg();
+    }
+    lastOutputValue_ = newValue;
+
+    debugValue_ = (uint64_t(desiredRate_) << 40) |
+                  (uint64_t(lastOutputValue_) << 32) |
+                  (uint64_t(filtered) << 16) | (uint64_t(measurement));
+
+    return newValue;
+  }
+
+  uint64_t debug_value() { return debugValue_; }
+
+  /// @return true if auto-tuning finished and save_tuning() needs to be
+  /// called.
+  bool save_pending() { return savePending_; }
+
+  /// Writes the auto-tuning results to the config file. The file writes are
+  /// slow, so this must not be called from the PWM cycle. Does nothing if no
+  /// save is pending.
+  void save_tuning() {
+    if (!savePending_) {
+      return;
+    }
+    savePending_ = 0;
+    if (configFd_ < 0) {
+      return;
     }
+    if (saveParams_) {
+      saveParams_ = 0;
+      par_.adjust_param().write(configFd_, adjustParam_);
+      par_.integrate().write(configFd_, integrate_);
+      par_.max_adjust().write(configFd_, maxDiff_);
+      mode_.algorithm().write(configFd_, 1);
+    }
+    mode_.autotune().write(configFd_, 0);
+  }
+
+ private:
+  /// Original regulator: moves the output by the scaled and clamped error
+  /// every tick.
+  uint8_t step_tick(uint16_t measurement) {
+    measEwma_.add_value(measurement);
     // Observed difference
     float diff = desiredRate_ - measEwma_.avg();
     diff *= adjustParam_;
@@ -96,27 +438,47 @@ class SpeedFeedbackController : private DefaultConfigUpdateListener {
     if (newValue < 0 || !desiredRate_) newValue = 0;
     if (newValue > 255) newValue = 255;
     if (newValue < minPower_ && desiredRate_) newValue = minPower_;
-    lastOutputValue_ = newValue;
-
-    debugValue_ = (uint64_t(desiredRate_) << 40) |
-                  (uint64_t(lastOutputValue_) << 32) |
-                  (uint64_t(measEwma_.avg()) << 16) | (uint64_t(measurement));
-
     return newValue;
   }
 
-  uint64_t debug_value() { return debugValue_; }
+  /// Switches to the PI regulator with the auto-tuning results. On failure
+  /// keeps the existing parameters. The configuration gets updated later by
+  /// save_tuning().
+  void finish_tuning() {
+    tuneRequested_ = 0;
+    if (tuner_.state() == FeedbackAutoTuner::DONE) {
+      adjustParam_ = tuner_.kp();
+      integrate_ = tuner_.ti();
+      maxDiff_ = tuner_.max_step();
+      usePi_ = 1;
+      pi_.set_params(adjustParam_, integrate_, maxDiff_, minPower_);
+      saveParams_ = 1;
+    }
+    savePending_ = 1;
+    tuner_.abort();
+  }
 
- private:
   UpdateAction apply_configuration(int fd, bool initial_load,
                                    BarrierNotifiable *done) override {
     AutoNotify an(done);
-    float raw_alpha = 256 - par_.integrate().read(fd);
+    configFd_ = fd;
+    integrate_ = par_.integrate().read(fd);
+    float raw_alpha = 256 - integrate_;
     raw_alpha /= 256;
     measEwma_.set_alpha(raw_alpha);
     maxDiff_ = par_.max_adjust().read(fd);
     adjustParam_ = par_.adjust_param().read(fd);
     minPower_ = par_.min_power().read(fd);
+    pi_.set_params(adjustParam_, integrate_, maxDiff_, minPower_);
+    if (hasMode_) {
+      uint8_t new_pi = mode_.algorithm().read(fd) == 1 ? 1 : 0;
+      if (new_pi && !usePi_) {
+        // Bumpless switchover from the step regulator.
+        pi_.reset(measEwma_.avg(), lastOutputValue_);
+      }
+      usePi_ = new_pi;
+      tuneRequested_ = mode_.autotune().read(fd) == 1 ? 1 : 0;
+    }
     return UPDATED;
   }
 
@@ -130,10 +492,22 @@ class SpeedFeedbackController : private DefaultConfigUpdateListener {
     par_.adjust_param().write(fd, par_.adjust_param_options().defaultvalue());
     par_.max_adjust().write(fd, par_.max_adjust_options().defaultvalue());
     par_.min_power().write(fd, par_.min_power_options().defaultvalue());
+    if (hasMode_) {
+      mode_.algorithm().write(fd, mode_.algorithm_options().defaultvalue());
+      mode_.autotune().write(fd, mode_.autotune_options().defaultvalue());
+    }
   }
 
   /// Configuration parameters.
   FeedbackParams par_;
+  /// Regulator selection. Valid only if hasMode_ is set.
+  FeedbackMode mode_;
+  /// Fixed-point regulator, used when usePi_ is set.
+  FixedPointPi pi_;
+  /// Step response measurement in progress.
+  FeedbackAutoTuner tuner_;
+  /// Config file descriptor, saved for writing back auto-tune results.
+  int configFd_{-1};
   /// Stores the EWMA of the measured values.
   AbsEwma measEwma_{0.8};
   // alpha value of the integrating component. alpha = 0 turns of integrating,
@@ -148,13 +522,25 @@ class SpeedFeedbackController : private DefaultConfigUpdateListener {
   uint8_t adjustParam_{16};
   /// Config: minimum output power.
   uint8_t minPower_{0};
+  /// Config: integration parameter (EWMA or integral time).
+  uint8_t integrate_{20};
   uint64_t debugValue_{0};
   /// What is the desired value of the measured values.
   uint16_t desiredRate_{0};
   /// What value did we output last time.
   uint8_t lastOutputValue_{0};
+  /// 1 if we were constructed with a FeedbackMode.
+  uint8_t hasMode_ : 1;
+  /// 1 if the PI regulator is selected.
+  uint8_t usePi_ : 1;
+  /// 1 if auto-tuning was requested via the config.
+  uint8_t tuneRequested_ : 1;
   /// Requests zeroing the internal state.
   uint8_t flushState_ : 1;
+  /// 1 if auto-tuning finished and the config needs to be updated.
+  uint8_t savePending_ : 1;
+  /// 1 if the config update includes the tuned parameters.
+  uint8_t saveParams_ : 1;
 };
 
 #endif  // _BRACZ_CUSTOM_SPEEDFEEDBACKCONTROLLER_HXX_
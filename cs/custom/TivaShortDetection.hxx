@@ -47,26 +47,14 @@
 
 #include "executor/StateFlow.hxx"
 #include "openlcb/EventHandlerTemplates.hxx"
+#include "openlcb/MemoryConfig.hxx"
 #include "openlcb/TractionDefs.hxx"
 #include "utils/logging.h"
 #include "commandstation/dcc_control.hxx"
+#include "custom/ShortDetectionFilter.hxx"
+#include "custom/TrackShortDetection.hxx"
 #include "DccHardware.hxx"
 
-static const auto SHUTDOWN_CURRENT_AMPS = 1.5;
-// ADC value at which we turn off the output.
-static const unsigned SHUTDOWN_LIMIT =
-    (SHUTDOWN_CURRENT_AMPS * 0.2 / 3.3) * 0xfff;
-
-static const auto KILL_CURRENT_AMPS = 4.0;
-// ADC value at which we turn off the output.
-static const unsigned KILL_LIMIT = (KILL_CURRENT_AMPS * 0.2 / 3.3) * 0xfff;
-
-// We try this many times to reenable after a short.
-static const unsigned OVERCURRENT_RETRY = 3;
-static const long long OVERCURRENT_RETRY_DELAY = MSEC_TO_NSEC(300);
-
-static const uint64_t EVENT_CS_DETECTED_SHORT = UINT64_C(0x0501010114FF0000) | 0x18;
-
 template <class HW>
 class TivaShortDetectionModule;
 
@@ -132,115 +120,20 @@ class ADCFlowBase : public StateFlowBase {
     return sample(adc_value[0]);
   }
 
+  /// Called with every ADC reading, from the state flow after the conversion
+  /// interrupt. Timestamps taken here lag the end of the conversion by the
+  /// interrupt and executor latency.
   virtual Action sample(uint32_t adc_value) = 0;
 
   long long period_;
 };
 
 template <class HW>
-class TivaShortDetectionModule : public ADCFlowBase<HW> {
+class TivaShortDetectionModule
+    : public TrackShortDetectionModule<ADCFlowBase<HW>> {
  public:
   TivaShortDetectionModule(openlcb::Node* node)
-      : ADCFlowBase<HW>(node->iface(), MSEC_TO_NSEC(1)),
-        num_disable_tries_(0),
-        num_overcurrent_tests_(0),
-        node_(node) {
-    next_report_ = 0;
-  }
-
-  ~TivaShortDetectionModule() {}
-
- private:
-  typedef StateFlowBase::Action Action;
-  using StateFlowBase::call_immediately;
-  using StateFlowBase::sleep_and_call;
-
-  /// @return the currently active output channel.
-  DccOutput *current_output()
-  {
-    return get_dcc_output(DccOutput::TRACK);
-  }
-  
-  Action sample(uint32_t adc_value) OVERRIDE {
-    current_output()->clear_disable_output_for_reason(
-            DccOutput::DisableReason::INITIALIZATION_PENDING);
-    if (adc_value > KILL_LIMIT) {
-      current_output()->disable_output_for_reason(
-          DccOutput::DisableReason::SHORTED);
-      LOG(INFO, "kill value: %04" PRIx32, adc_value);
-      return call_immediately(STATE(shorted));
-    }
-    if (adc_value > SHUTDOWN_LIMIT) {
-      if (++num_overcurrent_tests_ >= 5 || adc_value > KILL_LIMIT) {
-        current_output()->disable_output_for_reason(
-            DccOutput::DisableReason::SHORTED);
-        LOG(INFO, "%s value: %04" PRIx32,
-            adc_value <= KILL_LIMIT ? "disable" : "kill", adc_value);
-        ++num_disable_tries_;
-        if (num_disable_tries_ < OVERCURRENT_RETRY) {
-          return call_immediately(STATE(retry_wait));
-        } else {
-          return call_immediately(STATE(shorted));
-        }
-      } else {
-        LOG(INFO, "overcurrent value: %04" PRIx32, adc_value);
-        // If we measured an overcurrent situation, we start another conversion
-        // really soon.
-        return this->start_after(MSEC_TO_NSEC(1));
-        // return call_immediately(STATE(start_conversion));
-      }
-    } else {
-      num_overcurrent_tests_ = 0;
-    }
-    if (os_get_time_monotonic() > next_report_) {
-      LOG(INFO, "  adc value: %04" PRIx32, adc_value);
-      next_report_ = os_get_time_monotonic() + MSEC_TO_NSEC(250);
-    }
-    return call_immediately(STATE(start_timer));
-  }
-
-  Action shorted() {
-    num_disable_tries_ = 0;
-    LOG(INFO, "short detected");
-    return this->allocate_and_call(node_->iface()->global_message_write_flow(), STATE(send_short_message));
-  }
-
-  Action send_short_message() {
-    auto* b = this->get_allocation_result(
-        node_->iface()->global_message_write_flow());
-    b->data()->reset(openlcb::Defs::MTI_EVENT_REPORT, node_->node_id(),
-                     openlcb::eventid_to_buffer(
-                         openlcb::Defs::EMERGENCY_OFF_EVENT));
-    node_->iface()->global_message_write_flow()->send(b);
-
-    return this->allocate_and_call(node_->iface()->global_message_write_flow(), STATE(send_short_report2));
-  }
-
-  Action send_short_report2() {
-    auto* b = this->get_allocation_result(
-        node_->iface()->global_message_write_flow());
-    b->data()->reset(openlcb::Defs::MTI_EVENT_REPORT, node_->node_id(),
-                     openlcb::eventid_to_buffer(EVENT_CS_DETECTED_SHORT));
-    node_->iface()->global_message_write_flow()->send(b);
-    
-    return call_immediately(STATE(start_timer));
-  }
-
-  Action retry_wait() {
-    return sleep_and_call(&this->timer_, OVERCURRENT_RETRY_DELAY,
-                          STATE(retry_enable));
-  }
-
-  Action retry_enable() {
-    current_output()->clear_disable_output_for_reason(
-            DccOutput::DisableReason::SHORTED);
-    return call_immediately(STATE(start_timer));
-  }
-
-  uint8_t num_disable_tries_;
-  uint8_t num_overcurrent_tests_;
-  long long next_report_;
-  openlcb::Node* node_;
+      : TrackShortDetectionModule<ADCFlowBase<HW>>(node) {}
 };
 
 template <class HW>
@@ -254,6 +147,15 @@ class AccessoryOvercurrentMeasurement : public ADCFlowBase<HW> {
     num_uv_ = 0;
   }
 
+  /// The filter makes no trip decisions here, only records the waveform.
+  typedef bracz_custom::ShortDetectionFilter<> Filter;
+
+  /// @return a read-only memory space that exports the Filter::Capture
+  /// structure of the last trip.
+  openlcb::MemorySpace* capture_space() {
+    return &captureSpace_;
+  }
+
  private:
   typedef StateFlowBase::Action Action;
   using StateFlowBase::call_immediately;
@@ -268,9 +170,11 @@ class AccessoryOvercurrentMeasurement : public ADCFlowBase<HW> {
       set_voltage();
     }
     long long now = os_get_time_monotonic();
+    filter_.add(adc_value, now / 1000);
     if (adc_value >= HW::SHORT_LIMIT) {
       if (num_short_++ > HW::SHORT_COUNT) {
         HW::ACC_ENABLE_Pin::set(false);
+        filter_.trigger_capture(Filter::KILL);
         LOG(INFO, "acc short value: %04" PRIx32, adc_value);
         return call_immediately(STATE(shorted));
       } else {
@@ -282,6 +186,7 @@ class AccessoryOvercurrentMeasurement : public ADCFlowBase<HW> {
     if (adc_value >= HW::OVERCURRENT_LIMIT) {
       if (now - last_time_not_overcurrent_ > HW::OVERCURRENT_TIME) {
         HW::ACC_ENABLE_Pin::set(false);
+        filter_.trigger_capture(Filter::OVERCURRENT);
         LOG(INFO, "acc overcurrent value: %04" PRIx32, adc_value);
         return call_immediately(STATE(overcurrent));
       }
@@ -386,6 +291,9 @@ class AccessoryOvercurrentMeasurement : public ADCFlowBase<HW> {
   unsigned is_voltage_ : 1;
   unsigned count_report_;
   openlcb::Node* node_;
+  Filter filter_{8, 0xffff, 0xffff};
+  openlcb::ReadOnlyMemoryBlock captureSpace_{&filter_.capture(),
+                                             sizeof(Filter::Capture)};
 };
 
 template <class HW>
@@ -0,0 +1,207 @@
+/** \copyright
+ * Copyright (c) 2014, Balazs Racz
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are  permitted provided that the following conditions are met:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ *  - Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * \file TrackShortDetection.hxx
+ *
+ * Hardware-independent state flow that turns off the track output on a short
+ * circuit, based on the current samples of an ADC flow.
+ *
+ * @author Balazs Racz
+ * @date 19 Oct 2026
+ */
+
+#ifndef _BRACZ_CUSTOM_TRACKSHORTDETECTION_HXX_
+#define _BRACZ_CUSTOM_TRACKSHORTDETECTION_HXX_
+
+#include "executor/StateFlow.hxx"
+#include "openlcb/Defs.hxx"
+#include "openlcb/If.hxx"
+#include "openlcb/MemoryConfig.hxx"
+#include "openlcb/Node.hxx"
+#include "utils/logging.h"
+#include "dcc/DccOutput.hxx"
+#include "custom/ShortDetectionFilter.hxx"
+
+static const auto SHUTDOWN_CURRENT_AMPS = 1.5;
+// ADC value at which we turn off the output.
+static const unsigned SHUTDOWN_LIMIT =
+    (SHUTDOWN_CURRENT_AMPS * 0.2 / 3.3) * 0xfff;
+
+static const auto KILL_CURRENT_AMPS = 4.0;
+// ADC value at which we turn off the output.
+static const unsigned KILL_LIMIT = (KILL_CURRENT_AMPS * 0.2 / 3.3) * 0xfff;
+
+// How many 1 msec samples the track current RMS is computed over.
+static const unsigned SHORT_FILTER_WINDOW = 5;
+
+// We try this many times to reenable after a short.
+static const unsigned OVERCURRENT_RETRY = 3;
+static const long long OVERCURRENT_RETRY_DELAY = MSEC_TO_NSEC(300);
+
+static const uint64_t EVENT_CS_DETECTED_SHORT = UINT64_C(0x0501010114FF0000) | 0x18;
+
+/// Decides from the track current samples when to turn off the track output,
+/// retries turning it back on after an overcurrent, and reports a short to
+/// the network.
+///
+/// @param Base is the flow that takes the ADC samples. It has to provide a
+/// constructor (Service*, long long period), start_timer() and
+/// start_after(period) to schedule the next conversion, a StateFlowTimer
+/// timer_, and call the virtual Action sample(uint32_t adc_value) with every
+/// reading.
+template <class Base>
+class TrackShortDetectionModule : public Base {
+ public:
+  TrackShortDetectionModule(openlcb::Node* node)
+      : Base(node->iface(), MSEC_TO_NSEC(1)),
+        num_disable_tries_(0),
+        node_(node) {
+    next_report_ = 0;
+  }
+
+  typedef bracz_custom::ShortDetectionFilter<> Filter;
+
+  /// Changes how many samples the overcurrent RMS is computed over.
+  void set_filter_window(unsigned window) {
+    filter_.set_window(window);
+  }
+
+  /// @return a read-only memory space that exports the Filter::Capture
+  /// structure of the last trip.
+  openlcb::MemorySpace* capture_space() {
+    return &captureSpace_;
+  }
+
+ private:
+  typedef StateFlowBase::Action Action;
+  using StateFlowBase::call_immediately;
+  using StateFlowBase::sleep_and_call;
+
+  /// @return the currently active output channel.
+  DccOutput *current_output()
+  {
+    return get_dcc_output(DccOutput::TRACK);
+  }
+
+  Action sample(uint32_t adc_value) OVERRIDE {
+    current_output()->clear_disable_output_for_reason(
+            DccOutput::DisableReason::INITIALIZATION_PENDING);
+    if (current_output()->get_disable_output_reasons() &
+        (uint8_t)DccOutput::DisableReason::SHORTED) {
+      // The output is off after a short; there is nothing to decide until
+      // someone turns it back on. The samples still complete the capture of
+      // the trip.
+      filter_.record(adc_value, os_get_time_monotonic() / 1000);
+      return call_immediately(STATE(start_timer));
+    }
+    auto result = filter_.add(adc_value, os_get_time_monotonic() / 1000);
+    if (result == Filter::KILL) {
+      current_output()->disable_output_for_reason(
+          DccOutput::DisableReason::SHORTED);
+      LOG(INFO, "kill value: %04" PRIx32, adc_value);
+      return call_immediately(STATE(shorted));
+    }
+    if (result == Filter::OVERCURRENT) {
+      current_output()->disable_output_for_reason(
+          DccOutput::DisableReason::SHORTED);
+      LOG(INFO, "disable rms: %04x peak: %04x", filter_.rms(),
+          filter_.peak());
+      ++num_disable_tries_;
+      if (num_disable_tries_ < OVERCURRENT_RETRY) {
+        return call_immediately(STATE(retry_wait));
+      } else {
+        return call_immediately(STATE(shorted));
+      }
+    }
+    if (adc_value > SHUTDOWN_LIMIT) {
+      LOG(INFO, "overcurrent value: %04" PRIx32, adc_value);
+      // If we measured an overcurrent situation, we start another conversion
+      // really soon.
+      return this->start_after(MSEC_TO_NSEC(1));
+    }
+    if (os_get_time_monotonic() > next_report_) {
+      LOG(INFO, "  adc value: %04" PRIx32 " rms: %04x", adc_value,
+          filter_.rms());
+      next_report_ = os_get_time_monotonic() + MSEC_TO_NSEC(250);
+    }
+    return call_immediately(STATE(start_timer));
+  }
+
+  Action shorted() {
+    num_disable_tries_ = 0;
+    // Samples from before the output was turned off must not count when it
+    // gets turned back on.
+    filter_.clear_window();
+    LOG(INFO, "short detected");
+    return this->allocate_and_call(node_->iface()->global_message_write_flow(), STATE(send_short_message));
+  }
+
+  Action send_short_message() {
+    auto* b = this->get_allocation_result(
+        node_->iface()->global_message_write_flow());
+    b->data()->reset(openlcb::Defs::MTI_EVENT_REPORT, node_->node_id(),
+                     openlcb::eventid_to_buffer(
+                         openlcb::Defs::EMERGENCY_OFF_EVENT));
+    node_->iface()->global_message_write_flow()->send(b);
+
+    return this->allocate_and_call(node_->iface()->global_message_write_flow(), STATE(send_short_report2));
+  }
+
+  Action send_short_report2() {
+    auto* b = this->get_allocation_result(
+        node_->iface()->global_message_write_flow());
+    b->data()->reset(openlcb::Defs::MTI_EVENT_REPORT, node_->node_id(),
+                     openlcb::eventid_to_buffer(EVENT_CS_DETECTED_SHORT));
+    node_->iface()->global_message_write_flow()->send(b);
+    
+    return call_immediately(STATE(start_timer));
+  }
+
+  Action retry_wait() {
+    return sleep_and_call(&this->timer_, OVERCURRENT_RETRY_DELAY,
+                          STATE(retry_enable));
+  }
+
+  Action retry_enable() {
+    // No samples were taken while waiting; the capture ends here, so that it
+    // does not contain samples from after the re-enable.
+    filter_.finish_capture();
+    // Samples from before the output was turned off must not count.
+    filter_.clear_window();
+    current_output()->clear_disable_output_for_reason(
+            DccOutput::DisableReason::SHORTED);
+    return call_immediately(STATE(start_timer));
+  }
+
+  uint8_t num_disable_tries_;
+  long long next_report_;
+  openlcb::Node* node_;
+  Filter filter_{SHORT_FILTER_WINDOW, SHUTDOWN_LIMIT, KILL_LIMIT};
+  openlcb::ReadOnlyMemoryBlock captureSpace_{&filter_.capture(),
+                                             sizeof(Filter::Capture)};
+};
+
+#endif  // _BRACZ_CUSTOM_TRACKSHORTDETECTION_HXX_
@@ -35,6 +35,8 @@
 #include "logic/OlcbBindings.hxx"
 #include "logic/OlcbBindingsImpl.hxx"
 
+#include <algorithm>
+
 namespace logic {
 
 OlcbVariableFactory::~OlcbVariableFactory() {}
@@ -53,6 +55,84 @@ OlcbVariableFactory::UpdateAction OlcbVariableFactory::apply_configuration(
   }
 }
 
+constexpr unsigned OlcbVariableFactory::kQueryBurst;
+
+void OlcbVariableFactory::write_and_wait(openlcb::Defs::MTI mti,
+                                         uint64_t event_id) {
+  helper_.set_wait_for_local_loopback(true);
+  helper_.WriteAsync(node_, mti, openlcb::WriteHelper::global(),
+                     openlcb::eventid_to_buffer(event_id), bn_.reset(&sn_));
+  sn_.wait_for_notification();
+}
+
+void OlcbVariableFactory::send_event_report(uint64_t event_id) {
+  if (async_writes_) {
+    outbox_.push_back(event_id);
+    deliver_locally(event_id);
+    return;
+  }
+  write_and_wait(openlcb::Defs::MTI_EVENT_REPORT, event_id);
+}
+
+void OlcbVariableFactory::deliver_locally(uint64_t event_id) {
+  for (OlcbBoolVariable* v : bool_vars_) {
+    v->deliver_locally(event_id);
+  }
+  for (OlcbIntVariable* v : int_vars_) {
+    v->deliver_locally(event_id);
+  }
+}
+
+void OlcbVariableFactory::send_query(openlcb::Defs::MTI mti,
+                                     uint64_t event_id) {
+  if (bulk_queries_) {
+    query_outbox_.emplace_back(mti, event_id);
+    return;
+  }
+  write_and_wait(mti, event_id);
+}
+
+void OlcbVariableFactory::flush_queries() {
+  // Nothing is queued unless bulk queries are enabled.
+  if (query_outbox_.empty()) return;
+  auto* flow = node_->iface()->global_message_write_flow();
+  for (size_t i = 0; i < query_outbox_.size(); i += kQueryBurst) {
+    size_t end = std::min(query_outbox_.size(), i + kQueryBurst);
+    bn_.reset(&sn_);
+    for (size_t j = i; j < end; ++j) {
+      auto* b = flow->alloc();
+      b->data()->reset(query_outbox_[j].first, node_->node_id(),
+                       openlcb::eventid_to_buffer(query_outbox_[j].second));
+      // Replies from local variables will be in before we continue.
+      b->data()->set_flag_dst(openlcb::GenMessage::WAIT_FOR_LOCAL_LOOPBACK);
+      b->set_done(bn_.new_child());
+      flow->send(b);
+    }
+    bn_.notify();
+    sn_.wait_for_notification();
+  }
+  query_outbox_.clear();
+}
+
+void OlcbVariableFactory::flush_outbox() {
+  if (outbox_.empty()) return;
+  auto* flow = node_->iface()->global_message_write_flow();
+  bn_.reset(&sn_);
+  for (uint64_t event_id : outbox_) {
+    auto* b = flow->alloc();
+    b->data()->reset(openlcb::Defs::MTI_EVENT_REPORT, node_->node_id(),
+                     openlcb::eventid_to_buffer(event_id));
+    // The loopback has to be done before the next tick can write the
+    // variables again, else it would overwrite the newer state.
+    b->data()->set_flag_dst(openlcb::GenMessage::WAIT_FOR_LOCAL_LOOPBACK);
+    b->set_done(bn_.new_child());
+    flow->send(b);
+  }
+  bn_.notify();
+  sn_.wait_for_notification();
+  outbox_.clear();
+}
+
 void OlcbVariableFactory::factory_reset(int fd) {
   for (unsigned bl = 0; bl < cfg_.blocks().num_repeats(); ++bl) {
     const auto& block = cfg_.blocks().entry(bl);
@@ -35,6 +35,9 @@
 #ifndef _LOGIC_OLCBBINDINGS_HXX_
 #define _LOGIC_OLCBBINDINGS_HXX_
 
+#include <utility>
+#include <vector>
+
 #include "logic/Variable.hxx"
 #include "logic/OlcbBindingsConfig.hxx"
 #include "logic/Runner.hxx"
@@ -44,6 +47,9 @@
 
 namespace logic {
 
+class OlcbBoolVariable;
+class OlcbIntVariable;
+
 class OlcbVariableFactory : public VariableFactory,
                             public DefaultConfigUpdateListener {
  public:
@@ -83,11 +89,67 @@ class OlcbVariableFactory : public VariableFactory,
   openlcb::Node* node() {
     return node_;
   }
+
+  /// Selects the output mode of variable writes. In synchronous mode (the
+  /// default) every write blocks the VM until the event report has gone
+  /// through local loopback. In asynchronous mode the event reports are
+  /// collected in an outbox and sent out in one burst by flush_outbox(); the
+  /// other variables of this factory bound to the same event see the new
+  /// state right away, as they would in synchronous mode.
+  /// @param async true to enable asynchronous mode.
+  void set_async_writes(bool async) {
+    async_writes_ = async;
+  }
+
+  /// Sends out all event reports collected in asynchronous mode in one
+  /// burst. Blocks until the burst has gone through local loopback, so that
+  /// no report of this tick is delivered after the writes of the next
+  /// one. Called by the runner after every tick.
+  void flush_outbox();
+
+  /// Selects how newly created variables query their state from the bus. By
+  /// default every query waits for local loopback before the next one is
+  /// sent. With bulk queries the queries are only queued, and
+  /// flush_queries() sends them in pipelined bursts.
+  /// @param bulk true to enable bulk queries.
+  void set_bulk_queries(bool bulk) {
+    bulk_queries_ = bulk;
+  }
+
+  /// Sends all queued state queries, in bursts of kQueryBurst messages. Blocks
+  /// until the last burst has gone through local loopback. Called by the
+  /// runner after compiling.
+  void flush_queries();
   
  private:
   friend class OlcbBoolVariable;
   friend class OlcbIntVariable;
-  
+
+  /// Sends an event report from a variable write, or records it in the
+  /// outbox in asynchronous mode.
+  /// @param event_id the event to report.
+  void send_event_report(uint64_t event_id);
+
+  /// Applies an event report of an asynchronous write to the variables of
+  /// this factory right away, without waiting for the loopback.
+  /// @param event_id the reported event.
+  void deliver_locally(uint64_t event_id);
+
+  /// Sends a state query for a newly created variable, or queues it when
+  /// bulk queries are enabled.
+  /// @param mti is the identify producer or identify consumer MTI.
+  /// @param event_id the event to query.
+  void send_query(openlcb::Defs::MTI mti, uint64_t event_id);
+
+  /// Sends a global event message and blocks until it has gone through local
+  /// loopback.
+  /// @param mti what message to send.
+  /// @param event_id payload of the message.
+  void write_and_wait(openlcb::Defs::MTI mti, uint64_t event_id);
+
+  /// How many queued queries may be in flight at the same time.
+  static constexpr unsigned kQueryBurst = 32;
+
   /// Node object that will be used to communicate with the OpenLCB bus.
   openlcb::Node* node_;
 
@@ -105,6 +167,22 @@ class OlcbVariableFactory : public VariableFactory,
   /// File descriptor of the CDI config file where our data resides.
   int config_fd_{-1};
 
+  /// true if variable writes should not wait for the bus.
+  bool async_writes_{false};
+  /// Event reports waiting for flush_outbox() in asynchronous mode.
+  std::vector<uint64_t> outbox_;
+  /// Every live boolean variable of this factory. Maintained by the
+  /// variables themselves.
+  std::vector<OlcbBoolVariable*> bool_vars_;
+  /// Every live int variable of this factory. Maintained by the variables
+  /// themselves.
+  std::vector<OlcbIntVariable*> int_vars_;
+
+  /// true if variable creation should not wait for the state queries.
+  bool bulk_queries_{false};
+  /// State queries waiting for flush_queries().
+  std::vector<std::pair<openlcb::Defs::MTI, uint64_t>> query_outbox_;
+
   Runner runner_{this};
 };
 }  // namespace logic
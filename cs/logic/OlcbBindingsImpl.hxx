@@ -38,6 +38,8 @@
 
 #include "logic/OlcbBindings.hxx"
 
+#include <algorithm>
+
 #include "openlcb/EventHandlerTemplates.hxx"
 
 namespace logic {
@@ -53,13 +55,16 @@ class OlcbBoolVariable : public Variable, private openlcb::BitEventInterface {
         state_(false),
         state_known_(false),
         parent_(parent) {
+    parent_->bool_vars_.push_back(this);
     // This will ensure that all local variables have replied to this query
-    // before continuing. 
-    parent_->helper_.set_wait_for_local_loopback(true);
-    pc_.SendQueryProducer(&parent_->helper_, parent_->bn_.reset(&parent_->sn_));
-    parent_->sn_.wait_for_notification();
-    pc_.SendQueryConsumer(&parent_->helper_, parent_->bn_.reset(&parent_->sn_));
-    parent_->sn_.wait_for_notification();
+    // before continuing (or before the bulk flush completes).
+    parent_->send_query(openlcb::Defs::MTI_PRODUCER_IDENTIFY, event_on);
+    parent_->send_query(openlcb::Defs::MTI_CONSUMER_IDENTIFY, event_on);
+  }
+
+  ~OlcbBoolVariable() {
+    auto& v = parent_->bool_vars_;
+    v.erase(std::remove(v.begin(), v.end(), this), v.end());
   }
 
   int max_state() override {
@@ -67,6 +72,17 @@ class OlcbBoolVariable : public Variable, private openlcb::BitEventInterface {
     return 1;
   }
 
+  /// Takes the state from an event report of this node that is not yet
+  /// looped back.
+  /// @param event_id the reported event.
+  void deliver_locally(uint64_t event_id) {
+    if (event_id == event_on()) {
+      set_state(true);
+    } else if (event_id == event_off()) {
+      set_state(false);
+    }
+  }
+
   int read(const VariableFactory* parent, unsigned arg) override {
     return state_ ? 1 : 0;
   }
@@ -78,9 +94,7 @@ class OlcbBoolVariable : public Variable, private openlcb::BitEventInterface {
     if (!state_ && value) need_update = true;
     state_ = value ? true : false;
     if (need_update) {
-      parent_->helper_.set_wait_for_local_loopback(true);
-      pc_.SendEventReport(&parent_->helper_, parent_->bn_.reset(&parent_->sn_));
-      parent_->sn_.wait_for_notification();
+      parent_->send_event_report(state_ ? event_on() : event_off());
     }
   }
 
@@ -136,13 +150,16 @@ class OlcbIntVariable : public Variable, private openlcb::SimpleEventHandler {
     if (((int)state_) != value) need_update = true;
     state_ = value;
     if (need_update) {
-      parent_->helper_.set_wait_for_local_loopback(true);
-      parent_->helper_.WriteAsync(
-          node(), openlcb::Defs::MTI_EVENT_REPORT,
-          openlcb::WriteHelper::global(),
-          openlcb::eventid_to_buffer(event_base_ + state_),
-          parent_->bn_.reset(&parent_->sn_));
-      parent_->sn_.wait_for_notification();
+      parent_->send_event_report(event_base_ + state_);
+    }
+  }
+
+  /// Takes the state from an event report of this node that is not yet
+  /// looped back.
+  /// @param event_id the reported event.
+  void deliver_locally(uint64_t event_id) {
+    if (decode_event(event_id, &state_)) {
+      state_known_ = true;
     }
   }
 
@@ -163,6 +180,7 @@ class OlcbIntVariable : public Variable, private openlcb::SimpleEventHandler {
         state_(0),
         num_states_(num_states),
         parent_(parent) {
+    parent_->int_vars_.push_back(this);
     uint64_t reg_event = event_base_;
     unsigned mask = openlcb::EventRegistry::align_mask(&reg_event, num_states_);
     openlcb::EventRegistry::instance()->register_handler(
@@ -182,6 +200,8 @@ class OlcbIntVariable : public Variable, private openlcb::SimpleEventHandler {
 
   ~OlcbIntVariable() {
     openlcb::EventRegistry::instance()->unregister_handler(this);
+    auto& v = parent_->int_vars_;
+    v.erase(std::remove(v.begin(), v.end(), this), v.end());
   }
 
   void handle_event_report(const openlcb::EventRegistryEntry &entry,
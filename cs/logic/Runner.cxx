@@ -154,6 +154,7 @@ void Runner::single_step() {
       }
     }
   }
+  variable_factory_->flush_outbox();
 }
 
 void Runner::compile(Notifiable* done) {
@@ -221,6 +222,8 @@ void Runner::compile_impl(Notifiable* done) {
       bl.body().status().write(fd, status);
     }
   }
+  variable_factory_->flush_queries();
+  variable_factory_->flush_outbox();
 }
 
 
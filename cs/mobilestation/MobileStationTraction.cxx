@@ -39,6 +39,8 @@
 
 #include <inttypes.h>
 
+#include <memory>
+
 #include "commandstation/TrainDb.hxx"
 #include "openlcb/Defs.hxx"
 #include "openlcb/EventHandlerTemplates.hxx"
@@ -48,6 +50,7 @@
 #include "openlcb/TractionDefs.hxx"
 #include "openlcb/Velocity.hxx"
 #include "openlcb/WriteHelper.hxx"
+#include "os/os.h"
 #include "utils/constants.hxx"
 
 #include "utils/CanIf.hxx"
@@ -56,23 +59,288 @@ namespace mobilestation {
 
 DECLARE_CONST(mobile_station_train_count);
 
+/// Converts a speed to the MobileStation representation: speed step in the
+/// low 7 bits, bit 7 set for reverse.
+static uint8_t speed_to_mosta(openlcb::Velocity v) {
+  uint8_t speed = v.mph();
+  if (speed > 127) speed = 127;
+  if (v.direction() == openlcb::Velocity::REVERSE) {
+    speed |= 0x80;
+  }
+  return speed;
+}
+
+/// Last known state of a train, so that get queries from the MobileStation
+/// can be answered without a round trip to the train node.
+struct TrainState {
+  /// How long a learned value is trusted. Commands sent by other throttles to
+  /// a train node that is not local to us are not always visible.
+  static constexpr long long MAX_AGE_NSEC = MSEC_TO_NSEC(3000);
+  /// Functions above this number are always queried from the train node.
+  static constexpr unsigned NUM_FN = 32;
+
+  /// Forgets everything. Used when the train ID is assigned to a different
+  /// train node.
+  void reset(openlcb::NodeID node) {
+    *this = TrainState();
+    node_ = node;
+  }
+
+  /// @return true if the speed is known, and fills in *speed in MobileStation
+  /// format.
+  bool get_speed(uint8_t* speed) {
+    if (!speedPending_ &&
+        (!speedTime_ ||
+         os_get_time_monotonic() - speedTime_ > MAX_AGE_NSEC)) {
+      return false;
+    }
+    *speed = speed_;
+    return true;
+  }
+
+  /// Records the current speed (in MobileStation format).
+  void set_speed(uint8_t speed) {
+    speed_ = speed;
+    speedTime_ = os_get_time_monotonic();
+  }
+
+  /// @return true if the function value is known, and fills in *value with
+  /// 0 or 1.
+  bool get_fn(unsigned fn, uint8_t* value) {
+    if (fn >= NUM_FN || !fn_fresh() || !(fnKnown_ & (1U << fn))) {
+      return false;
+    }
+    *value = (fnValue_ >> fn) & 1;
+    return true;
+  }
+
+  /// Records the current value of a function.
+  void set_fn(unsigned fn, bool value) {
+    if (fn >= NUM_FN) {
+      return;
+    }
+    if (!fn_fresh()) {
+      fnKnown_ = 0;
+    }
+    fnKnown_ |= 1U << fn;
+    if (value) {
+      fnValue_ |= 1U << fn;
+    } else {
+      fnValue_ &= ~(1U << fn);
+    }
+    fnTime_ = os_get_time_monotonic();
+  }
+
+  /// Train node this state belongs to; 0 if the slot is not in use.
+  openlcb::NodeID node_{0};
+  /// Speed in MobileStation format.
+  uint8_t speed_{0};
+  /// True if speed_ came from the MobileStation and was not yet sent to the
+  /// train node.
+  bool speedPending_{false};
+  /// When speed_ was last updated, or 0 if it is unknown.
+  long long speedTime_{0};
+  /// When a speed command was last sent to the train node.
+  long long lastSpeedSent_{0};
+  /// Bit N is set if the value of function N is known.
+  uint32_t fnKnown_{0};
+  /// Bit N is the value of function N.
+  uint32_t fnValue_{0};
+  /// When a function value was last updated.
+  long long fnTime_{0};
+
+ private:
+  bool fn_fresh() {
+    return fnTime_ && os_get_time_monotonic() - fnTime_ <= MAX_AGE_NSEC;
+  }
+};
+
+/// Sends the speed commands from the MobileStation to the train nodes. When
+/// the knob is turned, the MobileStation sends a frame for every step; these
+/// are merged so that a train node gets at most one speed command per
+/// SPEED_INTERVAL_MSEC, always with the latest value.
+class SpeedSetFlow : public StateFlowBase {
+ public:
+  enum {
+    /// Minimum time between two speed commands to the same train.
+    SPEED_INTERVAL_MSEC = 50,
+  };
+
+  /// @param trains is the array of MAX_TRAINS train states.
+  SpeedSetFlow(MobileStationTraction* s, TrainState* trains, unsigned count)
+      : StateFlowBase(s), trains_(trains), count_(count), timer_(this) {}
+
+  ~SpeedSetFlow() {
+    set_terminated();
+    timer_.cancel();
+  }
+
+  MobileStationTraction* service() {
+    return static_cast<MobileStationTraction*>(StateFlowBase::service());
+  }
+
+  /// Call after setting speedPending_ on a train.
+  void wakeup() {
+    if (is_terminated()) {
+      start_flow(STATE(scan));
+    } else if (sleeping_) {
+      sleeping_ = false;
+      timer_.ensure_triggered();
+    }
+  }
+
+ private:
+  Action scan() {
+    sleeping_ = false;
+    long long now = os_get_time_monotonic();
+    long long next_due = 0;
+    for (unsigned i = 0; i < count_; ++i) {
+      if (!trains_[i].speedPending_) continue;
+      long long due =
+          trains_[i].lastSpeedSent_ + MSEC_TO_NSEC(SPEED_INTERVAL_MSEC);
+      if (due <= now) {
+        trainId_ = i;
+        return allocate_and_call(
+            service()->nmranet_if()->addressed_message_write_flow(),
+            STATE(send_speed));
+      }
+      if (!next_due || due < next_due) {
+        next_due = due;
+      }
+    }
+    if (next_due) {
+      sleeping_ = true;
+      return sleep_and_call(&timer_, next_due - now, STATE(scan));
+    }
+    return exit();
+  }
+
+  Action send_speed() {
+    auto* b = get_allocation_result(
+        service()->nmranet_if()->addressed_message_write_flow());
+    TrainState* st = &trains_[trainId_];
+    if (!st->speedPending_) {
+      // An emergency stop cancelled the speed while we were waiting for the
+      // buffer.
+      b->unref();
+      return call_immediately(STATE(scan));
+    }
+    // Frames that arrived while we were waiting for the buffer are merged
+    // here, we only send the latest value.
+    openlcb::Velocity v;
+    v.set_mph(st->speed_ & 0x7F);
+    if (st->speed_ & 0x80) {
+      v.reverse();
+    }
+    b->data()->src.id = service()->node()->node_id();
+    b->data()->src.alias = 0;
+    b->data()->dst.id = st->node_;
+    b->data()->dst.alias = 0;
+    b->data()->mti = openlcb::Defs::MTI_TRACTION_CONTROL_COMMAND;
+    b->data()->payload = openlcb::TractionDefs::speed_set_payload(v);
+    st->speedPending_ = false;
+    st->lastSpeedSent_ = os_get_time_monotonic();
+    service()->nmranet_if()->addressed_message_write_flow()->send(b);
+    return call_immediately(STATE(scan));
+  }
+
+  TrainState* trains_;
+  unsigned count_;
+  StateFlowTimer timer_;
+  /// Train we are sending the speed of.
+  unsigned trainId_;
+  /// True if the flow is waiting for timer_.
+  bool sleeping_{false};
+};
+
+/// Keeps the train states up to date from traction commands that other
+/// throttles send to the train nodes, and from the commands that train nodes
+/// forward to their listeners.
+class TractionSnooper : public openlcb::IncomingMessageStateFlow {
+ public:
+  TractionSnooper(MobileStationTraction* s, TrainState* trains, unsigned count)
+      : IncomingMessageStateFlow(s->nmranet_if()),
+        parent_(s),
+        trains_(trains),
+        count_(count) {
+    iface()->dispatcher()->register_handler(
+        this, openlcb::Defs::MTI_TRACTION_CONTROL_COMMAND,
+        openlcb::Defs::MTI_EXACT);
+  }
+
+  ~TractionSnooper() {
+    iface()->dispatcher()->unregister_handler(
+        this, openlcb::Defs::MTI_TRACTION_CONTROL_COMMAND,
+        openlcb::Defs::MTI_EXACT);
+  }
+
+  Action entry() override {
+    const openlcb::Payload& p = nmsg()->payload;
+    if (p.empty()) {
+      return release_and_exit();
+    }
+    uint8_t cmd = p[0];
+    openlcb::NodeID train;
+    if (cmd & openlcb::TractionDefs::REQ_LISTENER) {
+      train = nmsg()->src.id;
+    } else if (nmsg()->src.id == parent_->node()->node_id()) {
+      // Our own command; the state was updated when we sent it.
+      return release_and_exit();
+    } else {
+      train = nmsg()->dst.id;
+    }
+    if (!train) {
+      return release_and_exit();
+    }
+    for (unsigned i = 0; i < count_; ++i) {
+      if (trains_[i].node_ == train) {
+        update(&trains_[i], cmd & openlcb::TractionDefs::REQ_MASK, p);
+      }
+    }
+    return release_and_exit();
+  }
+
+ private:
+  /// Applies a traction command to a train state.
+  void update(TrainState* st, uint8_t cmd, const openlcb::Payload& p) {
+    uint8_t speed;
+    switch (cmd) {
+      case openlcb::TractionDefs::REQ_SET_SPEED:
+        // A pending speed from the MobileStation will override this anyway.
+        if (p.size() >= 3 && !st->speedPending_) {
+          st->set_speed(speed_to_mosta(openlcb::fp16_to_speed(p.data() + 1)));
+        }
+        break;
+      case openlcb::TractionDefs::REQ_EMERGENCY_STOP:
+        if (!st->speedPending_ && st->get_speed(&speed)) {
+          // Keeps the direction.
+          st->set_speed(speed & 0x80);
+        }
+        break;
+      case openlcb::TractionDefs::REQ_SET_FN:
+        if (p.size() >= 6) {
+          unsigned fn = (uint8_t(p[1]) << 16) | (uint8_t(p[2]) << 8) |
+                        uint8_t(p[3]);
+          st->set_fn(fn, p[4] || p[5]);
+        }
+        break;
+    }
+  }
+
+  MobileStationTraction* parent_;
+  TrainState* trains_;
+  unsigned count_;
+};
+
 class TractionImpl : public IncomingFrameFlow {
  public:
-  TractionImpl(MobileStationTraction* s)
+  TractionImpl(MobileStationTraction* s, TrainState* trains,
+               SpeedSetFlow* speed_flow)
       : IncomingFrameFlow(s),
         tractionClient_(service()->nmranet_if(), service()->node()),
-        timer_(this) {
-    service()->mosta_if()->frame_dispatcher()->register_handler(
-        this, TRACTION_SET_ID, TRACTION_SET_MASK);
-    service()->mosta_if()->frame_dispatcher()->register_handler(
-        this, TRACTION_ESTOP_ID, TRACTION_ESTOP_MASK);
-  }
-  ~TractionImpl() {
-    service()->mosta_if()->frame_dispatcher()->unregister_handler(
-        this, TRACTION_SET_ID, TRACTION_SET_MASK);
-    service()->mosta_if()->frame_dispatcher()->unregister_handler(
-        this, TRACTION_ESTOP_ID, TRACTION_ESTOP_MASK);
-  }
+        timer_(this),
+        trains_(trains),
+        speedFlow_(speed_flow) {}
 
   MobileStationTraction* service() {
     return static_cast<MobileStationTraction*>(IncomingFrameFlow::service());
@@ -92,6 +360,7 @@ class TractionImpl : public IncomingFrameFlow {
     TRACTION_SET_MOTOR_FN =
         1,  // used as data[0] for traction get/set commands.
     TRACTION_TIMEOUT_MSEC = 500,
+    MAX_TRAINS = TRACTION_SET_TRAIN_MASK + 1,
   };
 
  private:
@@ -103,15 +372,7 @@ class TractionImpl : public IncomingFrameFlow {
   Action entry() OVERRIDE {
     uint32_t can_id = message()->data()->id();
 
-    if ((can_id & TRACTION_ESTOP_MASK) == (TRACTION_ESTOP_ID & TRACTION_ESTOP_MASK)) {
-      if (frame().can_dlc == 3 && frame().data[0] == 1 &&
-          frame().data[1] == 0) {
-        //&& lastEstopState_ != frame().data[2]) {
-        service()->set_estop_state(MobileStationTraction::ESTOP_FROM_MOSTA,
-                                   frame().data[2]);
-        return release_and_exit();
-      }
-    } else if ((can_id & TRACTION_SET_MASK) == (TRACTION_SET_ID & TRACTION_SET_MASK)) {
+    if ((can_id & TRACTION_SET_MASK) == (TRACTION_SET_ID & TRACTION_SET_MASK)) {
       if (!service()->train_db()->is_train_id_known(train_id())) {
         return release_and_exit();
       }
@@ -119,58 +380,68 @@ class TractionImpl : public IncomingFrameFlow {
       if ((frame().can_dlc == 3 &&  // set any parameter
            frame().data[1] == 0) ||
           need_response()) {
-        return allocate_and_call(
-            service()->nmranet_if()->global_message_write_flow(),
-            STATE(send_write_query));
+        auto entry = service()->train_db()->get_entry(train_id());
+        if (!entry) {
+          LOG(VERBOSE, "unknown train");
+          return release_and_exit();
+        }
+        state_ = &trains_[train_id()];
+        if (state_->node_ != entry->get_traction_node()) {
+          state_->reset(entry->get_traction_node());
+        }
+        return call_immediately(STATE(try_local));
       }
       LOG(VERBOSE, "nothing to do. dlc %u, data[0] %u, data[1] %u",
           frame().can_dlc, frame().data[0], frame().data[1]);
     } else {
-      LOG_ERROR("unexpected command 0x%08" PRIx32 " masked 0x%08" PRIx32 " compare 0x%08x", can_id, (can_id & TRACTION_ESTOP_MASK), TRACTION_ESTOP_ID);
+      LOG_ERROR("unexpected command 0x%08" PRIx32 " masked 0x%08" PRIx32 " compare 0x%08x", can_id, (can_id & TRACTION_SET_MASK), TRACTION_SET_ID);
     }
     return release_and_exit();
   }
 
+  /// Handles the set speed and the get commands that do not need the train
+  /// node.
+  Action try_local() {
+    if (frame().can_dlc == 3 && frame().data[0] == TRACTION_SET_MOTOR_FN) {
+      // We are doing a set speed. It is sent by speedFlow_.
+      state_->set_speed(frame().data[2]);
+      state_->speedPending_ = true;
+      speedFlow_->wakeup();
+      if (need_response()) {
+        responseByte_ = frame().data[2];
+        return allocate_and_call(service()->mosta_if()->frame_write_flow(),
+                                 STATE(send_response));
+      }
+      return release_and_exit();
+    }
+    if (frame().can_dlc == 2 &&
+        (frame().data[0] == TRACTION_SET_MOTOR_FN
+             ? state_->get_speed(&responseByte_)
+             : state_->get_fn(frame().data[0] - 2, &responseByte_))) {
+      return allocate_and_call(service()->mosta_if()->frame_write_flow(),
+                               STATE(send_response));
+    }
+    return allocate_and_call(
+        service()->nmranet_if()->global_message_write_flow(),
+        STATE(send_write_query));
+  }
+
   Action send_write_query() {
     auto* b = get_allocation_result(
         service()->nmranet_if()->addressed_message_write_flow());
 
-    unsigned train_id = this->train_id();
-    auto entry = service()->train_db()->get_entry(train_id);
-    if (!entry) {
-      LOG(VERBOSE, "unknown train");
-      // we don't know, sorry.
-      b->unref();
-      return release_and_exit();
-    }
-
     b->data()->src.id = service()->node()->node_id();
     b->data()->src.alias = 0;
-    b->data()->dst.id = entry->get_traction_node();
+    b->data()->dst.id = state_->node_;
     b->data()->dst.alias = 0;
     b->data()->mti = openlcb::Defs::MTI_TRACTION_CONTROL_COMMAND;
 
-    if (frame().can_dlc == 3 && frame().data[0] == TRACTION_SET_MOTOR_FN) {
-      // We are doing a set speed.
-      openlcb::Velocity v;
-      v.set_mph(frame().data[2] & 0x7F);
-      if (frame().data[2] & 0x80) {
-        v.reverse();
-      }
-      b->data()->payload = openlcb::TractionDefs::speed_set_payload(v);
-      service()->nmranet_if()->addressed_message_write_flow()->send(b);
-      if (need_response()) {
-        responseByte_ = frame().data[2];
-        return allocate_and_call(service()->mosta_if()->frame_write_flow(),
-                                 STATE(send_response));
-      } else {
-        return release_and_exit();
-      }
-    } else if (frame().can_dlc == 3) {
+    if (frame().can_dlc == 3) {
       // We are doing a set function.
       unsigned fn_address = frame().data[0] - 2;
       b->data()->payload =
           openlcb::TractionDefs::fn_set_payload(fn_address, frame().data[2]);
+      state_->set_fn(fn_address, frame().data[2]);
       service()->nmranet_if()->addressed_message_write_flow()->send(b);
       if (need_response()) {
         responseByte_ = frame().data[2];
@@ -217,13 +488,11 @@ class TractionImpl : public IncomingFrameFlow {
       rb->unref();
       return release_and_exit();
     }
-    uint8_t speed = v_sp.mph();
-    if (speed > 127) speed = 127;
-    if (v_sp.direction() == openlcb::Velocity::REVERSE) {
-      speed |= 0x80;
-    }
-    responseByte_ = speed;
+    responseByte_ = speed_to_mosta(v_sp);
     rb->unref();
+    if (!state_->speedPending_) {
+      state_->set_speed(responseByte_);
+    }
 
     return allocate_and_call(service()->mosta_if()->frame_write_flow(),
                              STATE(send_response));
@@ -244,6 +513,7 @@ class TractionImpl : public IncomingFrameFlow {
     }
     responseByte_ = fn_value ? 1 : 0;
     rb->unref();
+    state_->set_fn(fn_num, fn_value);
     return allocate_and_call(service()->mosta_if()->frame_write_flow(),
                              STATE(send_response));
   }
@@ -282,8 +552,81 @@ class TractionImpl : public IncomingFrameFlow {
   StateFlowTimer timer_;
   // The third byte of the Mosta response.
   uint8_t responseByte_;
+  // Mirrored state of the trains, indexed by MobileStation train ID.
+  TrainState* trains_;
+  // State of the train in the current message.
+  TrainState* state_;
+  SpeedSetFlow* speedFlow_;
+};
+
+
+/// Receives the traction frames from the MobileStation and distributes them
+/// among NUM_FLOWS handler flows. A get query waiting for a train node only
+/// holds up the trains that share its flow. The frames of one train always
+/// go to the same flow, so they are processed in order.
+class TractionRouter : public FlowInterface<Buffer<CanHubData>> {
+ public:
+  enum {
+    NUM_FLOWS = 4,
+  };
+
+  TractionRouter(MobileStationTraction* s, TrainState* trains,
+                 SpeedSetFlow* speed_flow)
+      : service_(s) {
+    for (auto& h : handlers_) {
+      h.reset(new TractionImpl(s, trains, speed_flow));
+    }
+    service_->mosta_if()->frame_dispatcher()->register_handler(
+        this, TractionImpl::TRACTION_SET_ID, TractionImpl::TRACTION_SET_MASK);
+  }
+
+  ~TractionRouter() {
+    service_->mosta_if()->frame_dispatcher()->unregister_handler(
+        this, TractionImpl::TRACTION_SET_ID, TractionImpl::TRACTION_SET_MASK);
+  }
+
+  void send(Buffer<CanHubData>* b, unsigned priority) override {
+    unsigned train_id = (b->data()->id() >>
+                         TractionImpl::TRACTION_SET_TRAIN_SHIFT) &
+                        TractionImpl::TRACTION_SET_TRAIN_MASK;
+    handlers_[train_id % NUM_FLOWS]->send(b, priority);
+  }
+
+ private:
+  MobileStationTraction* service_;
+  std::unique_ptr<TractionImpl> handlers_[NUM_FLOWS];
 };
 
+/// Handles the emergency stop frames from the MobileStation directly when
+/// the dispatcher delivers them, so that they are never queued behind
+/// traction requests. The dispatcher runs on the same executor as the rest
+/// of the service.
+class MostaEstopHandler : public FlowInterface<Buffer<CanHubData>> {
+ public:
+  MostaEstopHandler(MobileStationTraction* s) : service_(s) {
+    service_->mosta_if()->frame_dispatcher()->register_handler(
+        this, TractionImpl::TRACTION_ESTOP_ID,
+        TractionImpl::TRACTION_ESTOP_MASK);
+  }
+
+  ~MostaEstopHandler() {
+    service_->mosta_if()->frame_dispatcher()->unregister_handler(
+        this, TractionImpl::TRACTION_ESTOP_ID,
+        TractionImpl::TRACTION_ESTOP_MASK);
+  }
+
+  void send(Buffer<CanHubData>* b, unsigned priority) override {
+    const struct can_frame& f = b->data()->frame();
+    if (f.can_dlc == 3 && f.data[0] == 1 && f.data[1] == 0) {
+      service_->set_estop_state(MobileStationTraction::ESTOP_FROM_MOSTA,
+                                f.data[2]);
+    }
+    b->unref();
+  }
+
+ private:
+  MobileStationTraction* service_;
+};
 
 class TrackPowerOnOffBit : public openlcb::BitEventInterface {
  public:
@@ -309,11 +652,19 @@ class TrackPowerOnOffBit : public openlcb::BitEventInterface {
 
 struct MobileStationTraction::Impl {
   Impl(MobileStationTraction* parent)
-      : handler_(parent)
+      : speedFlow_(parent, trains_, TractionImpl::MAX_TRAINS)
+      , snooper_(parent, trains_, TractionImpl::MAX_TRAINS)
+      , estopHandler_(parent)
+      , router_(parent, trains_, &speedFlow_)
       , lcb_power_bit_(parent)
       , lcb_power_bit_consumer_(&lcb_power_bit_) {}
   ~Impl() {}
-  TractionImpl handler_;   //< The implementation flow.
+  /// Last known state of the trains, indexed by MobileStation train ID.
+  TrainState trains_[TractionImpl::MAX_TRAINS];
+  SpeedSetFlow speedFlow_;  //< Sends speed commands to the trains.
+  TractionSnooper snooper_;  //< Updates trains_ from the OpenLCB bus.
+  MostaEstopHandler estopHandler_;  //< Emergency stop from the MoSta.
+  TractionRouter router_;  //< The implementation flows.
   TrackPowerOnOffBit lcb_power_bit_;
   openlcb::BitEventConsumer lcb_power_bit_consumer_;
 };
@@ -322,6 +673,14 @@ void MobileStationTraction::set_estop_state(EstopSource source,
                                             bool is_stopped) {
   // We set the stored state for that source.
   update_estop_bit(source, is_stopped);
+  if (is_stopped) {
+    // The trains stop without a traction command that we could see. Speed
+    // changes not sent yet must not restart them either.
+    for (TrainState& st : impl_->trains_) {
+      st.speedTime_ = 0;
+      st.speedPending_ = false;
+    }
+  }
   EstopSource bit;
   bool last_state;
   bit = ESTOP_FROM_MOSTA;
@@ -35,82 +35,284 @@
 
 #include "server/LayoutState.hxx"
 
+#include <algorithm>
+
+#include "executor/Executor.hxx"
 #include "utils/logging.h"
 #include "openlcb/Defs.hxx"
 #include "os/os.h"
 
 namespace server {
-void TimestampedState::Touch(uint64_t new_ts) {
-  vector<Closure> listeners_to_call;
+
+bool WaiterRegistry::fire_locked(StateWaiter* waiters) {
+  if (!waiters) return false;
+  while (waiters) {
+    StateWaiter* w = waiters;
+    waiters = w->next;
+    w->next = fired_;
+    fired_ = w;
+  }
+  if (dispatch_scheduled_) return false;
+  if (executor_) {
+    dispatch_scheduled_ = true;
+    executor_->add(this);
+    return false;
+  }
+  return true;
+}
+
+void WaiterRegistry::dispatch() {
+  StateWaiter* w;
   {
-    AtomicHolder l(this);
-    if (new_ts > ts_usec) {
-      ts_usec = new_ts;
-      listeners_to_call.swap(listeners);
-    }
+    AtomicHolder l(&lock_);
+    w = fired_;
+    fired_ = nullptr;
+    dispatch_scheduled_ = false;
   }
-  for (auto& l : listeners_to_call) {
-    l();
+  while (w) {
+    // The owner may reuse the waiter as soon as it is notified.
+    StateWaiter* next = w->next;
+    w->next = nullptr;
+    w->done->notify();
+    w = next;
   }
 }
 
-void TimestampedState::AddListener(uint64_t last_timestamp, Closure done) {
-  bool call = false;
+void WaiterRegistry::set_executor(ExecutorBase* e) {
+  AtomicHolder l(&lock_);
+  executor_ = e;
+}
+
+void TimestampedState::Touch(uint64_t new_ts) {
+  WaiterRegistry* r = registry_;
+  bool dispatch;
+  {
+    AtomicHolder l(r->lock());
+    if (new_ts <= ts_usec) return;
+    ts_usec = new_ts;
+    dispatch = r->fire_locked(waiters_);
+    waiters_ = nullptr;
+  }
+  if (dispatch) r->dispatch();
+}
+
+void TimestampedState::AddWaiter(uint64_t last_timestamp, StateWaiter* waiter,
+                                 Notifiable* done) {
+  WaiterRegistry* r = registry_;
+  waiter->done = done;
   {
-    AtomicHolder l(this);
+    AtomicHolder l(r->lock());
     if (ts_usec <= last_timestamp) {
-      listeners.push_back(done);
-    } else {
-      call = true;
+      waiter->next = waiters_;
+      waiters_ = waiter;
+      return;
     }
   }
-  if (call) {
-    done();
+  done->notify();
+}
+
+bool LokState::GetFn(int fn_id, FnState* fn) const {
+  if (fn_id < 0 || fn_id >= kMaxFn || !(fn_exists & (1ULL << fn_id))) {
+    return false;
+  }
+  fn->value = (fn_on >> fn_id) & 1;
+  fn->ts_usec = fn_ts[fn_index(fn_id)];
+  return true;
+}
+
+void LokState::AddFn(int fn_id) {
+  HASSERT(fn_id >= 0 && fn_id < kMaxFn);
+  if (fn_exists & (1ULL << fn_id)) return;
+  fn_ts.insert(fn_ts.begin() + fn_index(fn_id), 0);
+  fn_exists |= 1ULL << fn_id;
+}
+
+bool LokState::SetFn(int fn_id, bool on, uint64_t ts) {
+  AddFn(fn_id);
+  uint64_t bit = 1ULL << fn_id;
+  if (((fn_on & bit) != 0) == on) return false;
+  if (on) {
+    fn_on |= bit;
+  } else {
+    fn_on &= ~bit;
   }
+  fn_ts[fn_index(fn_id)] = ts;
+  return true;
+}
+
+void LayoutState::set_notify_executor(ExecutorBase* executor) {
+  waiters_.set_executor(executor);
+}
+
+void LayoutState::TouchAllLoks(uint64_t ts) {
+  for (unsigned id = 0; id < num_loks_; ++id) {
+    if (loks_[id].exists) loks_[id].Touch(ts);
+  }
+  Touch(ts);
 }
 
 void LayoutState::PopulateLokState(int id, TrainControlResponse* resp) {
-  LayoutState* db = this;
-  LayoutState::loks_t::const_iterator it = db->loks.find(id);
-  if (it == db->loks.end()) {
+  const LokState* st = GetLok(id);
+  if (!st) {
     LOG(WARNING, "Requested state of lok %d  which does not exist.", id);
     return;
   }
   LokStateProto* lok = resp->add_lokstate();
-  const LokState& lst = *it->second;
+  const LokState& lst = *st;
   lok->set_id(id);
   lok->set_dir(lst.speed_and_dir.dir);
   lok->set_speed(lst.speed_and_dir.speed);
   lok->set_speed_ts(lst.speed_and_dir.ts_usec);
   lok->set_ts(lst.ts_usec);
-  for (LokState::fn_t::const_iterator it = lst.fn.begin();
-       it != lst.fn.end();
-       ++it) {
+  for (uint64_t bits = lst.fn_exists; bits; bits &= bits - 1) {
+    int fn_id = __builtin_ctzll(bits);
+    FnState fst;
+    lst.GetFn(fn_id, &fst);
     LokStateProto_Function* fn = lok->add_function();
-    fn->set_id(it->first);
-    fn->set_value(it->second->value);
-    fn->set_ts(it->second->ts_usec);
+    fn->set_id(fn_id);
+    fn->set_value(fst.value);
+    fn->set_ts(fst.ts_usec);
   }
 }
 
 void LayoutState::PopulateAllLokState(TrainControlResponse* resp) {
-  LayoutState* db = this;
-  for (LayoutState::loks_t::const_iterator it = db->loks.begin();
-       it != db->loks.end();
-       ++it) {
-    PopulateLokState(it->first, resp);
+  for (unsigned id = 0; id < num_loks_; ++id) {
+    if (loks_[id].exists) PopulateLokState(id, resp);
+  }
+}
+
+constexpr int LokState::kMaxFn;
+constexpr unsigned LayoutState::kJournalSize;
+
+LokState* LayoutState::CreateLok(int id) {
+  if (id < 0 || (unsigned)id >= num_loks_) {
+    LOG(WARNING, "Lok id %d is not in the lokdb.", id);
+    return nullptr;
   }
+  loks_[id].exists = true;
+  return &loks_[id];
+}
+
+void LayoutState::SetSpeed(int id, int dir, int speed, uint64_t ts) {
+  LokState* st = CreateLok(id);
+  if (!st) return;
+  SpeedAndDirState* sst = &st->speed_and_dir;
+  if (dir == sst->dir && speed == sst->speed) return;
+  sst->dir = dir;
+  sst->speed = speed;
+  sst->Touch(ts);
+  st->Touch(ts);
+  Touch(ts);
+  RecordChange({0, ts, Change::SPEED, id, 0, dir, speed});
+}
+
+void LayoutState::SetFn(int id, int fn_id, int value, uint64_t ts) {
+  LokState* st = CreateLok(id);
+  if (!st) return;
+  if (fn_id < 0 || fn_id >= LokState::kMaxFn) {
+    LOG(WARNING, "Lok %d function id %d out of range.", id, fn_id);
+    return;
+  }
+  // Functions are kept as on/off; any nonzero value from the MCU is on.
+  bool on = value != 0;
+  if (!st->SetFn(fn_id, on, ts)) return;
+  st->Touch(ts);
+  Touch(ts);
+  RecordChange({0, ts, Change::FN, id, fn_id, 0, on ? 1 : 0});
+}
+
+void LayoutState::SetStop(bool value, uint64_t ts) {
+  if (value == stop) return;
+  stop = value;
+  TouchAllLoks(ts);
+  RecordChange({0, ts, Change::STOP, 0, 0, 0, value ? 1 : 0});
+}
+
+void LayoutState::RecordChange(Change c) {
+  ChangeListener* l;
+  {
+    AtomicHolder h(&journal_lock_);
+    c.seq = ++last_seq_;
+    journal_.push_back(c);
+    if (journal_.size() > kJournalSize) {
+      journal_.pop_front();
+    }
+    l = change_listeners_;
+    change_listeners_ = nullptr;
+  }
+  while (l) {
+    // The owner may reuse the listener as soon as it is notified.
+    ChangeListener* next = l->next;
+    l->next = nullptr;
+    l->done->notify();
+    l = next;
+  }
+}
+
+uint64_t LayoutState::last_seq() {
+  AtomicHolder l(&journal_lock_);
+  return last_seq_;
+}
+
+bool LayoutState::GetChangesSince(uint64_t seq, vector<Change>* changes) {
+  AtomicHolder l(&journal_lock_);
+  if (seq > last_seq_) return false;
+  if (seq == last_seq_) return true;
+  if (journal_.empty() || journal_.front().seq > seq + 1) return false;
+  changes->insert(changes->end(), journal_.end() - (last_seq_ - seq),
+                  journal_.end());
+  return true;
+}
+
+void LayoutState::AddChangeListener(uint64_t seq, ChangeListener* listener,
+                                    Notifiable* done) {
+  listener->done = done;
+  {
+    AtomicHolder l(&journal_lock_);
+    if (last_seq_ <= seq) {
+      listener->next = change_listeners_;
+      change_listeners_ = listener;
+      return;
+    }
+  }
+  done->notify();
+}
+
+bool LayoutState::RemoveChangeListener(ChangeListener* listener) {
+  AtomicHolder l(&journal_lock_);
+  for (ChangeListener** pl = &change_listeners_; *pl; pl = &(*pl)->next) {
+    if (*pl == listener) {
+      *pl = listener->next;
+      listener->next = nullptr;
+      return true;
+    }
+  }
+  return false;
 }
 
 void LayoutState::ZeroLayoutState(const TrainControlResponse_LokDb& lokdb) {
+  HASSERT(!loks_);
+  int max_id = -1;
   for (const auto& lok : lokdb.lok()) {
-    LokState*& st = loks[lok.id()];
-    if (!st) st = new LokState;
+    max_id = std::max(max_id, (int)lok.id());
+  }
+  num_loks_ = max_id + 1;
+  loks_.reset(new LokState[num_loks_]);
+  for (unsigned id = 0; id < num_loks_; ++id) {
+    loks_[id].Init(&waiters_);
+  }
+  for (const auto& lok : lokdb.lok()) {
+    LokState* st = CreateLok(lok.id());
+    if (!st) continue;
     for (const auto& fn : lok.function()) {
-      st->fn[fn.id()] = new FnState;
+      if (fn.id() < 0 || fn.id() >= LokState::kMaxFn) {
+        LOG(WARNING, "Lok %d function id %d out of range.", lok.id(),
+            fn.id());
+        continue;
+      }
+      st->AddFn(fn.id());
     }
   }
 }
 
-
 }  // namespace server
@@ -37,91 +37,250 @@
 #define _SERVER_LAYOUTSTATE_HXX_
 
 #include <stdint.h>
+#include <deque>
 #include <functional>
+#include <memory>
 
 #include "utils/Singleton.hxx"
 #include "utils/Atomic.hxx"
+#include "executor/Executor.hxx"
+#include "executor/Notifiable.hxx"
 #include "server/train_control.pb.h"
 
 namespace server {
 
 using Closure = std::function<void()>;
 
-struct TimestampedState : private Atomic {
-  TimestampedState()
-      : ts_usec(0) {}
+// Registration for waiting on a TimestampedState. It is an intrusive list
+// entry, so registering does not allocate. Owned by the caller, who must
+// keep it alive until done is notified.
+struct StateWaiter {
+  StateWaiter* next{nullptr};
+  Notifiable* done{nullptr};
+};
+
+// Dispatches the woken up waiters of the TimestampedState objects of one
+// LayoutState. The waiting lists themselves are in the state objects, guarded
+// by the lock of the registry. All waiters woken up until the notify executor
+// gets to run are notified in one batch, outside of the lock.
+class WaiterRegistry : public Executable {
+ public:
+  // Moves a list of waiters to the fired list. Called with lock() held.
+  // Returns true if the caller has to call dispatch() after releasing the
+  // lock.
+  bool fire_locked(StateWaiter* waiters);
+
+  // Notifies every fired waiter. Must not be called with lock() held.
+  void dispatch();
+
+  void run() OVERRIDE { dispatch(); }
+
+  Atomic* lock() { return &lock_; }
+
+  // Sets the executor on which waiters are notified. If not set, waiters are
+  // notified at the end of Touch().
+  void set_executor(ExecutorBase* e);
+
+ private:
+  Atomic lock_;
+  StateWaiter* fired_{nullptr};
+  bool dispatch_scheduled_{false};
+  ExecutorBase* executor_{nullptr};
+};
+
+// The timestamp serves as the generation counter: a waiter registers with
+// the last timestamp it has seen and is woken once the state advances past
+// it.
+struct TimestampedState {
+  TimestampedState(WaiterRegistry* registry = nullptr)
+      : ts_usec(0), registry_(registry) {}
+
+  // Sets the registry dispatching the waiters. Must be called before the
+  // first Touch or AddWaiter if the constructor got no registry.
+  void set_registry(WaiterRegistry* registry) { registry_ = registry; }
 
   // Last modified.
   uint64_t ts_usec;
-  // Listeners. They are all self-owning callbacks or externally owned
-  // callbacks. Only called at the next change in state.
-  vector<Closure> listeners;
 
-  // Updates timestamp (if advanced) and calls any listener if needed.
+  // Updates timestamp (if advanced) and wakes up any waiters if needed.
   void Touch(uint64_t new_ts);
 
-  // Calls done closure when ts_usec > last_timestamp. Might call done
-  // synchronously.
-  void AddListener(uint64_t last_timestamp, Closure done);
+  // Notifies done when ts_usec > last_timestamp. Might notify synchronously.
+  // Only notified at the next change in state.
+  void AddWaiter(uint64_t last_timestamp, StateWaiter* waiter,
+                 Notifiable* done);
 
  private:
+  // Dispatches the waiters of this state. Owned by the LayoutState.
+  WaiterRegistry* registry_;
+  // Waiting for the next change of this state. Guarded by the lock of
+  // registry_.
+  StateWaiter* waiters_{nullptr};
+
   DISALLOW_COPY_AND_ASSIGN(TimestampedState);
 };
 
-struct FnState : TimestampedState {
+// State of one function, as returned by LokState::GetFn.
+struct FnState {
   FnState()
-      : value(0) {}
+      : value(0), ts_usec(0) {}
   // 0: off, 1: on
   int value;
+  // Last modified.
+  uint64_t ts_usec;
 };
 
 struct SpeedAndDirState : TimestampedState {
   SpeedAndDirState()
       : dir(1), speed(0) {}
   // +1: forward, -1: backward.
-  int dir;
+  int8_t dir;
   // 0..127
-  int speed;
+  uint8_t speed;
 };
 
+// One loco record of the LayoutState table. Functions are kept in bitmaps;
+// only their timestamps take memory per function.
 struct LokState : TimestampedState {
-  typedef map<int, FnState*> fn_t;
-  // function id -> value mapping.
-  fn_t fn;
+  // Function ids have to be below this.
+  static constexpr int kMaxFn = 64;
+
+  // Sets the registry of this state and its sub-states.
+  void Init(WaiterRegistry* registry) {
+    set_registry(registry);
+    speed_and_dir.set_registry(registry);
+  }
+
+  // Fills in *fn with the state of function fn_id. Returns false if the
+  // function does not exist. Functions that were never set are off with
+  // timestamp 0.
+  bool GetFn(int fn_id, FnState* fn) const;
+
+  // Makes function fn_id exist. fn_id has to be in range.
+  void AddFn(int fn_id);
+
+  // Sets function fn_id on or off; it is added if it did not exist. Returns
+  // false (and changes nothing) if the function already had that value.
+  bool SetFn(int fn_id, bool on, uint64_t ts);
+
+  // True if this lok id is in use.
+  bool exists{false};
+  // Bit i is set if function i exists.
+  uint64_t fn_exists{0};
+  // Bit i is set if function i is on.
+  uint64_t fn_on{0};
+  // Last modified time of each existing function, in the order of their
+  // ids: entry k belongs to the k-th set bit of fn_exists.
+  vector<uint64_t> fn_ts;
   SpeedAndDirState speed_and_dir;
 
-  const FnState* GetFn(int fn_id) const {
-    fn_t::const_iterator it = fn.find(fn_id);
-    if (it == fn.end()) return NULL;
-    return it->second;
+ private:
+  // Index of function fn_id in fn_ts.
+  unsigned fn_index(int fn_id) const {
+    return __builtin_popcountll(fn_exists & ((1ULL << fn_id) - 1));
   }
 };
 
 struct LayoutState : TimestampedState, public Singleton<LayoutState> {
   LayoutState()
-      : stop(true) {}
-  typedef map<int, LokState*> loks_t;
-  loks_t loks;
+      : TimestampedState(&waiters_), stop(true) {}
   // true: emergency stopped. false: power on.
   bool stop;
 
-  void TouchAllLoks(uint64_t ts) {
-    for (const auto& e : loks) {
-      e.second->Touch(ts);
-    }
-    Touch(ts);
-  }
+  // One entry of the change journal that is streamed to subscribers.
+  struct Change {
+    enum Type { SPEED, FN, STOP };
+    // Sequence number, starting at 1, incremented by one for every change.
+    uint64_t seq;
+    uint64_t ts_usec;
+    Type type;
+    // Lok id for SPEED and FN.
+    int id;
+    // Function id for FN.
+    int fn_id;
+    // +1 / -1 for SPEED.
+    int dir;
+    // Speed for SPEED, function value for FN, stop for STOP.
+    int value;
+  };
+
+  // How many changes are kept for subscribers to resume from.
+  static constexpr unsigned kJournalSize = 256;
+
+  void TouchAllLoks(uint64_t ts);
 
   // Returns the lok entry for that id, or null if it does not exist.
-  LokState* GetLok(int id) const {
-    loks_t::const_iterator it = loks.find(id);
-    if (it == loks.end()) return NULL;
-    return it->second;
+  LokState* GetLok(int id) {
+    if (id < 0 || (unsigned)id >= num_loks_ || !loks_[id].exists) {
+      return nullptr;
+    }
+    return &loks_[id];
   }
 
+  // Sets the executor on which the waiters of this state and all lok states
+  // are notified. All waiters woken up until the executor gets to run are
+  // notified in one batch. If not set, waiters are notified at the end of
+  // Touch().
+  void set_notify_executor(ExecutorBase* executor);
+
+  // Updates the state of a lok as reported by the layout. Touches the
+  // timestamps and records a change only if the value differs.
+  void SetSpeed(int id, int dir, int speed, uint64_t ts);
+  void SetFn(int id, int fn_id, int value, uint64_t ts);
+  void SetStop(bool value, uint64_t ts);
+
+  // Sequence number of the last change recorded, 0 if there was none.
+  uint64_t last_seq();
+
+  // Appends to *changes all journal entries with sequence number greater
+  // than seq. Returns false if some of these are not in the journal anymore
+  // (or seq is in the future); then the caller needs a full snapshot.
+  bool GetChangesSince(uint64_t seq, vector<Change>* changes);
+
+  // Registration for AddChangeListener. An intrusive list entry owned by
+  // the caller, who must keep it alive until done is notified or the
+  // listener is removed.
+  struct ChangeListener {
+    ChangeListener* next{nullptr};
+    Notifiable* done{nullptr};
+  };
+
+  // Notifies done when a change with sequence number greater than seq is
+  // recorded. Might notify synchronously.
+  void AddChangeListener(uint64_t seq, ChangeListener* listener,
+                         Notifiable* done);
+
+  // Unregisters a listener. Returns false if it was not registered (anymore),
+  // i.e. done was already notified.
+  bool RemoveChangeListener(ChangeListener* listener);
+
+  // Allocates the lok table for the ids of the lokdb and creates the loks
+  // and functions listed there. Must be called once, before any lok state is
+  // set; lok ids above the highest id in the lokdb are ignored.
   void ZeroLayoutState(const TrainControlResponse_LokDb& lokdb);
   void PopulateAllLokState(TrainControlResponse* resp);
   void PopulateLokState(int id, TrainControlResponse* resp);
+
+ private:
+  // Returns the lok entry for that id, marking it as existing. Returns null
+  // if the id is not in the table.
+  LokState* CreateLok(int id);
+
+  // Assigns the next sequence number to c and adds it to the journal.
+  void RecordChange(Change c);
+
+  // Waiters of this and all lok states. Declared before the states, so that
+  // it outlives them.
+  WaiterRegistry waiters_;
+  // Indexed by lok id, num_loks_ entries. Sized from the lokdb.
+  std::unique_ptr<LokState[]> loks_;
+  unsigned num_loks_{0};
+
+  // Protects the journal fields below.
+  Atomic journal_lock_;
+  std::deque<Change> journal_;
+  uint64_t last_seq_{0};
+  ChangeListener* change_listeners_{nullptr};
 };
 
 } // namespace server
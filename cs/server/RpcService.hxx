@@ -89,6 +89,19 @@ class RpcService : public Service {
       return allocate_and_call(service()->reply_target(), STATE(render_reply));
     }
 
+    /** Sends back the current response to the caller as one message of a
+        stream, clears it and then continues with c. The buffer is allocated
+        synchronously, so that a streaming flow never waits in the allocator
+        queue of the reply target, and its owner can always stop it. */
+    Action stream_reply(Callback c) {
+      message()->data()->response.set_id(message()->data()->request.id());
+      auto* b = service()->reply_target()->alloc();
+      message()->data()->response.SerializeToString(b->data());
+      service()->reply_target()->send(b);
+      message()->data()->response.clear_response();
+      return call_immediately(c);
+    }
+
    private:
     Action render_reply() {
       auto* b = get_allocation_result(service()->reply_target());
@@ -34,8 +34,10 @@
 
 #include "server/TrainControlService.hxx"
 
+#include <algorithm>
 #include <set>
 #include <functional>
+#include <vector>
 #include <google/protobuf/text_format.h>
 
 #include "server/LayoutState.hxx"
@@ -45,6 +47,7 @@
 #include "mobilestation/PacketDefs.hxx"
 #include "src/usb_proto.h"
 #include "utils/Clock.hxx"
+#include "utils/StringPrintf.hxx"
 
 using openlcb::DatagramService;
 using openlcb::DatagramClient;
@@ -62,7 +65,21 @@ TrainControlService::TrainControlService(ExecutorBase* e)
     : RpcService(e, create_handler_factory()),
       handler_factory_(RpcService::impl()) {}
 
-TrainControlService::~TrainControlService() {}
+TrainControlService::~TrainControlService() {
+  if (!impl_) return;
+  // The DoSubscribe flows refer to impl_; they have to exit first. A
+  // subscriber either waits for a change, which end_subscriptions cancels, or
+  // is runnable and exits at its next state; it never waits for anything
+  // else. So a few executor rounds are enough.
+  static constexpr unsigned kMaxShutdownRounds = 100;
+  bool done = false;
+  for (unsigned round = 0; !done; ++round) {
+    if (round >= kMaxShutdownRounds) {
+      DIE("TrainControlService: subscriber flows did not exit.");
+    }
+    executor()->sync_run([this, &done]() { done = end_subscriptions(); });
+  }
+}
 
 class HostServer;
 typedef StateFlow<Buffer<string>, QList<1> > PacketQueueFlow;
@@ -110,10 +127,7 @@ class LayoutStateListener : public HostPacketHandlerInterface {
     if (PMATCH(kERStopPayload, packet, 0x4008, 0x0900, 3)) {
       bool value = packet[8];
       LOG(INFO, "estop override %d", value);
-      if (value != state->stop) {
-        state->stop = value;
-        state->TouchAllLoks(ts);
-      }
+      state->SetStop(value, ts);
       return;
     }
 
@@ -124,29 +138,12 @@ class LayoutStateListener : public HostPacketHandlerInterface {
       int lokid = packet[3] >> 2;
       int fnid = packet[6];
       int fnvalue = packet[8];
-      LokState*& st = state->loks[lokid];
-      if (!st) st = new LokState;
       if (fnid == 1) {  // speed set
-        SpeedAndDirState* sst = &st->speed_and_dir;
         int dir = 1;
         if (fnvalue & 0x80) dir = -1;
-        int speed = fnvalue & 0x7f;
-        if (dir != sst->dir || speed != sst->speed) {
-          sst->dir = dir;
-          sst->speed = speed;
-          sst->Touch(ts);
-          st->Touch(ts);
-          state->Touch(ts);
-        }
+        state->SetSpeed(lokid, dir, fnvalue & 0x7f, ts);
       } else {
-        FnState*& fst = st->fn[fnid];
-        if (!fst) fst = new FnState;
-        if (fst->value != fnvalue) {
-          fst->value = fnvalue;
-          fst->Touch(ts);
-          st->Touch(ts);
-          state->Touch(ts);
-        }
+        state->SetFn(lokid, fnid, fnvalue, ts);
       }
       return;
     }
@@ -171,6 +168,8 @@ class PrintLogentries : public HostPacketHandlerInterface {
   }
 };
 
+class ServerFlow;
+
 struct TrainControlService::Impl {
   DatagramService* dg_service() { return dg_service_; }
   Node* node() { return node_; }
@@ -193,6 +192,11 @@ struct TrainControlService::Impl {
   Node* node_;
   std::unique_ptr<HostServer> datagram_handler_;
   std::unique_ptr<PacketQueueFlow> host_queue_;
+  /// Flows serving a DoSubscribe request. Only accessed on the service's
+  /// executor.
+  std::vector<ServerFlow*> subscribers_;
+  /// Set when the service shuts down; the subscriber flows exit.
+  bool shutdown_{false};
 };
 
 void TrainControlService::TEST_inject_clock(Clock* clock) {
@@ -401,20 +405,70 @@ class ServerFlow : public RpcService::ImplFlowBase,
 
   openlcb::If* iface() { return dg_service()->iface(); }
 
+  /// Outcome of starting the processing of one (sub-)request.
+  enum RequestResult {
+    /// The response is filled in.
+    REQUEST_DONE,
+    /// The response will be filled in when the MCU answers the packet sent.
+    REQUEST_PENDING,
+    /// The request has to wait until all pending responses arrived; nothing
+    /// was done yet, the request has to be started again.
+    REQUEST_BARRIER,
+    /// The request is not supported.
+    REQUEST_FAILED
+  };
+
+  /// A response packet we are waiting for from the MCU.
+  struct PendingResponse {
+    std::function<bool(const string&)> filter;
+    std::function<void(const string&, TrainControlResponse*)> fill;
+    TrainControlResponse* response;
+    /// The matched response packet, or nullptr if not arrived yet.
+    Buffer<string>* packet;
+  };
+
   void packet_arrived(Buffer<string>* b) OVERRIDE {
-    if (packet_filter_(*b->data())) {
-      response_packet_ = b;
-      service()->impl()->datagram_handler()->remove_handler(this);
-      this->notify();
-    } else {
-      b->unref();
+    bool wakeup = false;
+    {
+      AtomicHolder h(&lock_);
+      for (auto& p : pending_) {
+        if (!p.packet && p.filter(*b->data())) {
+          p.packet = b;
+          b = nullptr;
+          if (--num_outstanding_ == 0 && waiting_) {
+            waiting_ = false;
+            wakeup = true;
+          }
+          break;
+        }
+      }
     }
+    if (b) b->unref();
+    if (wakeup) this->notify();
   }
 
   static bool PacketTypeFilter(uint8_t value, const string& p) {
     return p[0] == value;
   }
 
+  // Adds a pending response. The first incoming packet that matches filter
+  // and no earlier pending response will be given to fill.
+  void expect_response(
+      std::function<bool(const string&)> filter,
+      std::function<void(const string&, TrainControlResponse*)> fill,
+      TrainControlResponse* response) {
+    bool first = pending_.empty();
+    {
+      AtomicHolder h(&lock_);
+      pending_.push_back({std::move(filter), std::move(fill), response,
+                          nullptr});
+      ++num_outstanding_;
+    }
+    if (first) {
+      service()->impl()->datagram_handler()->add_handler(this);
+    }
+  }
+
   // Class C has to have the following public members:
   //
   //  - staic int kAcceptResponseCode: incoming packet[0] will be checked
@@ -422,14 +476,13 @@ class ServerFlow : public RpcService::ImplFlowBase,
   //
   //  - static void FillResponse(const Packet&, TrainControlResponse*);
   template <class C>
-  void add_callback() {
-    packet_filter_ =
+  void add_callback(TrainControlResponse* response) {
+    expect_response(
         std::bind(&ServerFlow::PacketTypeFilter, C::accept_response_type::value,
-                  std::placeholders::_1);
-    fill_response_ = std::bind(&C::FillResponse, &impl()->layout_state_,
-                               std::placeholders::_1, std::placeholders::_2);
-    response_packet_ = nullptr;
-    service()->impl()->datagram_handler()->add_handler(this);
+                  std::placeholders::_1),
+        std::bind(&C::FillResponse, &impl()->layout_state_,
+                  std::placeholders::_1, std::placeholders::_2),
+        response);
   }
 
   static bool CanPacketFilter(Packet sent, int match_len,
@@ -448,21 +501,56 @@ class ServerFlow : public RpcService::ImplFlowBase,
   }
 
   template <class C>
-  void add_cancallback(const Packet& sent_packet, int match_len) {
+  void add_cancallback(const Packet& sent_packet, int match_len,
+                       TrainControlResponse* response) {
     HASSERT(sent_packet.size() >= 6);
-    packet_filter_ = std::bind(&ServerFlow::CanPacketFilter, sent_packet,
-                               match_len, std::placeholders::_1);
-    fill_response_ = std::bind(&C::FillResponse, &impl()->layout_state_,
-                               std::placeholders::_1, std::placeholders::_2);
-    response_packet_ = nullptr;
-    service()->impl()->datagram_handler()->add_handler(this);
-  }
-
-  Action response_arrived() {
-    fill_response_(*response_packet_->data(),
-                   message()->data()->response.mutable_response());
-    response_packet_->unref();
-    response_packet_ = nullptr;
+    expect_response(
+        std::bind(&ServerFlow::CanPacketFilter, sent_packet, match_len,
+                  std::placeholders::_1),
+        std::bind(&C::FillResponse, &impl()->layout_state_,
+                  std::placeholders::_1, std::placeholders::_2),
+        response);
+  }
+
+  /// Waits until every pending response has arrived, then fills them in.
+  Action wait_for_responses() {
+    {
+      AtomicHolder h(&lock_);
+      if (num_outstanding_) {
+        waiting_ = true;
+        return wait_and_call(STATE(responses_arrived));
+      }
+    }
+    return call_immediately(STATE(responses_arrived));
+  }
+
+  Action responses_arrived() {
+    std::vector<PendingResponse> arrived;
+    {
+      AtomicHolder h(&lock_);
+      arrived.swap(pending_);
+    }
+    if (!arrived.empty()) {
+      service()->impl()->datagram_handler()->remove_handler(this);
+    }
+    for (auto& p : arrived) {
+      p.fill(*p.packet->data(), p.response);
+      p.packet->unref();
+    }
+    if (!batch_error_.empty()) {
+      return batch_failed();
+    }
+    if (message()->data()->request.request().has_dobatch()) {
+      return call_immediately(STATE(run_batch));
+    }
+    return reply();
+  }
+
+  /// Finishes a DoBatch request whose entry batch_index_ failed. The
+  /// responses of the entries before it are returned as well.
+  Action batch_failed() {
+    message()->data()->response.set_failed(true);
+    message()->data()->response.set_error_detail(batch_error_);
     return reply();
   }
 
@@ -472,18 +560,16 @@ class ServerFlow : public RpcService::ImplFlowBase,
     impl()->host_queue()->send(b);
   }
 
-  Action state_changed() { return reply(); }
-
-  void state_changed_callback(LayoutState* state,
-                              TrainControlResponse* response,
-                              TimestampedState* ts) {
+  Action state_changed() {
+    TrainControlResponse* response =
+        message()->data()->response.mutable_response();
     TrainControlResponse::WaitForChangeResponse* r =
         response->mutable_waitforchangeresponse();
-    r->set_timestamp(ts->ts_usec);
+    r->set_timestamp(waited_state_->ts_usec);
     TrainControlResponse::EmergencyStop* args =
         response->mutable_emergencystop();
-    args->set_stop(state->stop);
-    this->notify();
+    args->set_stop(impl()->layout_state_.stop);
+    return reply();
   }
 
   Action entry() OVERRIDE {
@@ -494,15 +580,181 @@ class ServerFlow : public RpcService::ImplFlowBase,
     LOG(INFO, "request come: %s", debug_req.c_str());
     TrainControlResponse* response =
         message()->data()->response.mutable_response();
+    if (request->has_dobatch()) {
+      batch_index_ = 0;
+      return call_immediately(STATE(run_batch));
+    } else if (request->has_dosubscribe()) {
+      // An impossible sequence number forces a snapshot.
+      subscription_seq_ = request->dosubscribe().has_resume_seq()
+                              ? request->dosubscribe().resume_seq()
+                              : UINT64_MAX;
+      impl()->subscribers_.push_back(this);
+      return call_immediately(STATE(send_changes));
+    } else if (request->has_dowaitforchange()) {
+      const TrainControlRequest::DoWaitForChange& args =
+          request->dowaitforchange();
+      TimestampedState* st;
+      TrainControlResponse::WaitForChangeResponse* r =
+          response->mutable_waitforchangeresponse();
+      if (args.has_id()) {
+        r->set_id(args.id());
+        st = impl()->layout_state_.GetLok(args.id());
+      } else {
+        st = &impl()->layout_state_;
+      }
+      if (!st) {
+        LOG(WARNING, "Requested wait for timestamp but nonexistant state.");
+        message()->data()->response.clear_response();
+        message()->data()->response.set_failed(true);
+        message()->data()->response.set_error_detail(
+            "error: unknown state in wait for change.");
+        return reply();
+      }
+      waited_state_ = st;
+      st->AddWaiter(args.timestamp(), &state_waiter_, this);
+      return wait_and_call(STATE(state_changed));
+    }
+    switch (start_request(request, response)) {
+      case REQUEST_DONE:
+        return reply();
+      case REQUEST_PENDING:
+      case REQUEST_BARRIER:
+        return wait_for_responses();
+      case REQUEST_FAILED:
+        break;
+    }
+    message()->data()->response.set_failed(true);
+    message()->data()->response.set_error_detail("unimplemented command");
+    return reply();
+  }
+
+  /// Starts the entries of a DoBatch request from batch_index_ on. Requests
+  /// to the MCU are sent without waiting for the previous response; we only
+  /// stop at barriers and at the end of the batch.
+  Action run_batch() {
+    const TrainControlRequest::DoBatch& batch =
+        message()->data()->request.request().dobatch();
+    TrainControlResponse::Batch* batch_response =
+        message()->data()->response.mutable_response()->mutable_batch();
+    for (; batch_index_ < batch.request_size(); ++batch_index_) {
+      const TrainControlRequest& request = batch.request(batch_index_);
+      if (batch_response->response_size() <= batch_index_) {
+        batch_response->add_response();
+      }
+      TrainControlResponse* response =
+          batch_response->mutable_response(batch_index_);
+      RequestResult result = REQUEST_FAILED;
+      bool allowed = !request.has_dobatch() &&
+                     !request.has_dowaitforchange() &&
+                     !request.has_dosubscribe();
+      if (allowed) {
+        result = start_request(&request, response);
+      }
+      if (result == REQUEST_BARRIER) {
+        return wait_for_responses();
+      } else if (result == REQUEST_FAILED) {
+        LOG(WARNING, "Batch entry %d failed.", batch_index_);
+        batch_response->mutable_response()->RemoveLast();
+        batch_error_ =
+            allowed ? StringPrintf("unimplemented command in batch entry %d",
+                                   batch_index_)
+                    : StringPrintf("command not allowed in batch entry %d",
+                                   batch_index_);
+        // The entries already sent still get their responses.
+        if (!pending_.empty()) {
+          return wait_for_responses();
+        }
+        return batch_failed();
+      }
+    }
+    if (!pending_.empty()) {
+      return wait_for_responses();
+    }
+    return reply();
+  }
+
+  /// Sends the layout state changes after subscription_seq_ to the
+  /// subscriber, or a full snapshot if those changes are not available
+  /// anymore. The snapshot may already contain some changes after its
+  /// snapshot_seq; since changes carry absolute values, replaying them is
+  /// harmless.
+  Action send_changes() {
+    if (impl()->shutdown_) return end_subscription();
+    LayoutState* st = &impl()->layout_state_;
+    TrainControlResponse* response =
+        message()->data()->response.mutable_response();
+    std::vector<LayoutState::Change> changes;
+    if (!st->GetChangesSince(subscription_seq_, &changes)) {
+      subscription_seq_ = st->last_seq();
+      response->set_snapshot_seq(subscription_seq_);
+      st->PopulateAllLokState(response);
+      response->mutable_emergencystop()->set_stop(st->stop);
+    }
+    for (const auto& c : changes) {
+      TrainControlResponse::Change* r = response->add_change();
+      r->set_seq(c.seq);
+      r->set_ts(c.ts_usec);
+      switch (c.type) {
+        case LayoutState::Change::SPEED:
+          r->set_id(c.id);
+          r->set_dir(c.dir);
+          r->set_speed(c.value);
+          break;
+        case LayoutState::Change::FN:
+          r->set_id(c.id);
+          r->set_fn_id(c.fn_id);
+          r->set_value(c.value);
+          break;
+        case LayoutState::Change::STOP:
+          r->set_stop(c.value);
+          break;
+      }
+      subscription_seq_ = c.seq;
+    }
+    return stream_reply(STATE(wait_for_changes));
+  }
+
+  Action wait_for_changes() {
+    if (impl()->shutdown_) return end_subscription();
+    impl()->layout_state_.AddChangeListener(subscription_seq_,
+                                            &change_listener_, this);
+    return wait_and_call(STATE(send_changes));
+  }
+
+  /// Terminates the stream of a DoSubscribe request and deletes *this.
+  Action end_subscription() {
+    auto& subscribers = impl()->subscribers_;
+    subscribers.erase(
+        std::remove(subscribers.begin(), subscribers.end(), this),
+        subscribers.end());
+    message()->unref();
+    return delete_this();
+  }
+
+ public:
+  /// Called on shutdown (with impl()->shutdown_ set). If the flow is waiting
+  /// for a change, wakes it up so that it exits; otherwise it exits by
+  /// itself when it is done sending the current response.
+  void cancel_subscription() {
+    if (impl()->layout_state_.RemoveChangeListener(&change_listener_)) {
+      notify();
+    }
+  }
+
+ private:
+  /// Executes a single request, filling in *response either immediately or
+  /// when the answer from the MCU arrives.
+  RequestResult start_request(const TrainControlRequest* request,
+                              TrainControlResponse* response) {
     if (request->has_doping()) {
-      add_callback<PingResponseFn>();
+      add_callback<PingResponseFn>(response);
 
       Packet pkt;
       pkt.push_back(CMD_PING);
       pkt.push_back(request->doping().value() & 255);
       send_packet(std::move(pkt));
       LOG(INFO, "Sent ping packet value=%d", request->doping().value());
-      return wait_and_call(STATE(response_arrived));
+      return REQUEST_PENDING;
     } else if (request->has_dosendrawcanpacket()) {
       Packet pkt;
       const TrainControlRequest::DoSendRawCanPacket& args =
@@ -517,12 +769,12 @@ class ServerFlow : public RpcService::ImplFlowBase,
       }
       LOG(INFO, "Requested sending CAN packet.");
       if (args.wait()) {
-        add_cancallback<ResponseCanPacketFn>(pkt, 0);
+        add_cancallback<ResponseCanPacketFn>(pkt, 0, response);
         send_packet(std::move(pkt));
-        return wait_and_call(STATE(response_arrived));
+        return REQUEST_PENDING;
       } else {
         send_packet(std::move(pkt));
-        return reply();
+        return REQUEST_DONE;
       }
     } else if (request->has_dosetspeed()) {
       Packet pkt;
@@ -547,9 +799,9 @@ class ServerFlow : public RpcService::ImplFlowBase,
         pkt.push_back(0);
         LOG(INFO, "Requested speed of train %d.", args.id());
       }
-      add_cancallback<SpeedFn>(pkt, 2);
+      add_cancallback<SpeedFn>(pkt, 2, response);
       send_packet(std::move(pkt));
-      return wait_and_call(STATE(response_arrived));
+      return REQUEST_PENDING;
     } else if (request->has_dosetaccessory()) {
       Packet pkt;
       const TrainControlRequest::DoSetAccessory& args =
@@ -573,9 +825,9 @@ class ServerFlow : public RpcService::ImplFlowBase,
         LOG(INFO, "Getting train %d accessory %d", args.train_id(),
             args.accessory_id());
       }
-      add_cancallback<AccessoryFn>(pkt, 2);
+      add_cancallback<AccessoryFn>(pkt, 2, response);
       send_packet(std::move(pkt));
-      return wait_and_call(STATE(response_arrived));
+      return REQUEST_PENDING;
     } else if (request->has_dosetemergencystop()) {
       Packet pkt;
       const TrainControlRequest::DoSetEmergencyStop& args =
@@ -593,95 +845,64 @@ class ServerFlow : public RpcService::ImplFlowBase,
         LOG(INFO, "Emergency %s", (args.stop() ? "stop." : "start."));
         response->mutable_emergencystop()->set_stop(args.stop());
         uint64_t ts_usec = impl()->clock_->get_time_nsec() / 1000;
-        impl()->layout_state_.stop = args.stop() ? 1 : 0;
-        impl()->layout_state_.TouchAllLoks(ts_usec);
+        impl()->layout_state_.SetStop(args.stop(), ts_usec);
         TrainControlResponse::WaitForChangeResponse* ts =
             response->mutable_waitforchangeresponse();
         ts->set_timestamp(ts_usec);
         send_packet(std::move(pkt));
-        return reply();
+        return REQUEST_DONE;
       } else {
         pkt.push_back(2);  // Len;
         pkt.push_back(1);
         pkt.push_back(0);  // unknown;
         LOG(INFO, "Getting emergency stop status.");
-        add_cancallback<EmergencyStopFn>(pkt, 2);
+        add_cancallback<EmergencyStopFn>(pkt, 2, response);
         send_packet(std::move(pkt));
-        return wait_and_call(STATE(response_arrived));
+        return REQUEST_PENDING;
       }
     } else if (request->has_dogetlokdb()) {
       *response = impl()->lokdb_response_;
-      return reply();
+      return REQUEST_DONE;
     } else if (request->has_dogetlokstate()) {
+      // The state has to reflect all commands sent before.
+      if (!pending_.empty()) return REQUEST_BARRIER;
       if (request->dogetlokstate().has_id()) {
         impl()->layout_state_.PopulateLokState(request->dogetlokstate().id(),
                                                response);
       } else {
         impl()->layout_state_.PopulateAllLokState(response);
       }
-      return reply();
-    } else if (request->has_dowaitforchange()) {
-      const TrainControlRequest::DoWaitForChange& args =
-          request->dowaitforchange();
-      TimestampedState* st;
-      TrainControlResponse::WaitForChangeResponse* r =
-          response->mutable_waitforchangeresponse();
-      if (args.has_id()) {
-        r->set_id(args.id());
-        st = impl()->layout_state_.GetLok(args.id());
-      } else {
-        st = &impl()->layout_state_;
-      }
-      if (!st) {
-        LOG(WARNING, "Requested wait for timestamp but nonexistant state.");
-        message()->data()->response.clear_response();
-        message()->data()->response.set_failed(true);
-        message()->data()->response.set_error_detail(
-            "error: unknown state in wait for change.");
-        return reply();
-      }
-      st->AddListener(args.timestamp(),
-                      std::bind(&ServerFlow::state_changed_callback, this,
-                                &impl()->layout_state_, response, st));
-      return wait_and_call(STATE(state_changed));
+      return REQUEST_DONE;
     } /*else if (false) {
           // dosetlokstate?
           // doestoploco?
           // getorsetcv?
-        } else if (request->has_dowaitforchange()) {
-          const TrainControlRequest::DoWaitForChange& args =
-              request->dowaitforchange();
-          TimestampedState* st;
-          TrainControlResponse::WaitForChangeResponse* r =
-              response->mutable_waitforchangeresponse();
-          if (args.has_id()) {
-            r->set_id(args.id());
-            st = GetLayoutState()->GetLok(args.id());
-          } else {
-            st = GetLayoutState();
-          }
-          if (!st) {
-            LOG(WARNING) << "Requested wait for timestamp but nonexistant
-       state.";
-            rpc->set_status(RPC::APPLICATION_ERROR);
-            rpc->set_error_detail("error: unknown state in wait for change.");
-            done->Run();
-            return;
-          }
-          st->AddListener(args.timestamp(),
-                          NewCallback(&StateChangeCallback, st, r, done));
-                          }*/
-
-    message()->data()->response.set_failed(true);
-    message()->data()->response.set_error_detail("unimplemented command");
-    return reply();
+        }*/
+    return REQUEST_FAILED;
   }
 
  private:
-  std::function<bool(const string&)> packet_filter_;
-  std::function<void(const string&, TrainControlResponse*)> fill_response_;
+  /// Responses we are waiting for from the MCU. Guarded by lock_, since
+  /// packet_arrived is called from the datagram handler's flow.
+  std::vector<PendingResponse> pending_;
+  /// How many entries in pending_ have no packet yet.
+  unsigned num_outstanding_{0};
+  /// True if the flow is blocked in wait_for_responses.
+  bool waiting_{false};
+  /// Next entry to start in a DoBatch request.
+  int batch_index_{0};
+  /// Error of the failed entry of a DoBatch request; empty if none failed.
+  string batch_error_;
+  /// Last change sent to the subscriber of a DoSubscribe request.
+  uint64_t subscription_seq_{0};
+  /// Registration for the next change after subscription_seq_.
+  LayoutState::ChangeListener change_listener_;
+  /// Registration for DoWaitForChange.
+  StateWaiter state_waiter_;
+  /// The state the DoWaitForChange request is waiting on.
+  TimestampedState* waited_state_{nullptr};
+  Atomic lock_;
   string request_packet_;
-  Buffer<string>* response_packet_;
   DatagramClient* dg_client_;
 };
 
@@ -718,6 +939,7 @@ void TrainControlService::initialize(openlcb::DatagramService* dg_service,
   impl_->datagram_handler_->add_handler(&impl_->state_listener_);
   impl_->datagram_handler_->add_handler(&impl_->log_output_);
   impl_->host_queue_.reset(new HostPacketQueue(this));
+  impl_->layout_state_.set_notify_executor(executor());
 
   // Parse lokdb.
   HASSERT(::google::protobuf::TextFormat::ParseFromString(
@@ -734,6 +956,15 @@ void TrainControlService::initialize(openlcb::DatagramService* dg_service,
   }
 }
 
+bool TrainControlService::end_subscriptions() {
+  impl_->shutdown_ = true;
+  // cancel_subscription does not modify the list.
+  for (ServerFlow* f : impl_->subscribers_) {
+    f->cancel_subscription();
+  }
+  return impl_->subscribers_.empty();
+}
+
 RpcServiceInterface* TrainControlService::create_handler_factory() {
   return new RpcServiceFlowFactory<ServerFlow>(this);
 }
@@ -62,6 +62,10 @@ class TrainControlService : public RpcService {
   // trick to hide the actual implementation class in the .cc file.
   RpcServiceInterface* create_handler_factory();
 
+  // Makes the DoSubscribe flows exit. Returns true if none is left. Must be
+  // called on the executor.
+  bool end_subscriptions();
+
   std::unique_ptr<Impl> impl_;
   std::unique_ptr<RpcServiceInterface> handler_factory_;
 };
@@ -16,7 +16,7 @@
 #include <google/protobuf/port_def.inc>
 extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_LokStateProto_train_5fcontrol_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_LokStateProto_Function_train_5fcontrol_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<18> scc_info_TrainControlRequest_train_5fcontrol_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<19> scc_info_TrainControlRequest_train_5fcontrol_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TrainControlRequest_DoChangeSavedState_train_5fcontrol_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TrainControlRequest_DoDropState_train_5fcontrol_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TrainControlRequest_DoEStopLoco_train_5fcontrol_2eproto;
@@ -33,9 +33,11 @@ extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID:
 extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TrainControlRequest_DoSetAccessory_train_5fcontrol_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TrainControlRequest_DoSetEmergencyStop_train_5fcontrol_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TrainControlRequest_DoSetSpeed_train_5fcontrol_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TrainControlRequest_DoSubscribe_train_5fcontrol_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TrainControlRequest_DoWaitForChange_train_5fcontrol_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<14> scc_info_TrainControlResponse_train_5fcontrol_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<15> scc_info_TrainControlResponse_train_5fcontrol_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TrainControlResponse_Accessory_train_5fcontrol_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TrainControlResponse_Change_train_5fcontrol_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TrainControlResponse_CurrentAddress_train_5fcontrol_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TrainControlResponse_Cv_train_5fcontrol_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_train_5fcontrol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TrainControlResponse_EmergencyStop_train_5fcontrol_2eproto;
@@ -127,6 +129,14 @@ class TrainControlRequest_DoWaitForChangeDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TrainControlRequest_DoWaitForChange> _instance;
 } _TrainControlRequest_DoWaitForChange_default_instance_;
+class TrainControlRequest_DoBatchDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TrainControlRequest_DoBatch> _instance;
+} _TrainControlRequest_DoBatch_default_instance_;
+class TrainControlRequest_DoSubscribeDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TrainControlRequest_DoSubscribe> _instance;
+} _TrainControlRequest_DoSubscribe_default_instance_;
 class TrainControlRequestDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TrainControlRequest> _instance;
@@ -191,6 +201,14 @@ class TrainControlResponse_WaitForChangeResponseDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TrainControlResponse_WaitForChangeResponse> _instance;
 } _TrainControlResponse_WaitForChangeResponse_default_instance_;
+class TrainControlResponse_BatchDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TrainControlResponse_Batch> _instance;
+} _TrainControlResponse_Batch_default_instance_;
+class TrainControlResponse_ChangeDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TrainControlResponse_Change> _instance;
+} _TrainControlResponse_Change_default_instance_;
 class TrainControlResponseDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TrainControlResponse> _instance;
@@ -271,11 +289,17 @@ static void InitDefaultsscc_info_TrainControlRequest_train_5fcontrol_2eproto() {
     new (ptr) ::server::TrainControlRequest();
     ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
   }
+  {
+    void* ptr = &::server::_TrainControlRequest_DoBatch_default_instance_;
+    new (ptr) ::server::TrainControlRequest_DoBatch();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
   ::server::TrainControlRequest::InitAsDefaultInstance();
+  ::server::TrainControlRequest_DoBatch::InitAsDefaultInstance();
 }
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<18> scc_info_TrainControlRequest_train_5fcontrol_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 18, 0, InitDefaultsscc_info_TrainControlRequest_train_5fcontrol_2eproto}, {
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<19> scc_info_TrainControlRequest_train_5fcontrol_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 19, 0, InitDefaultsscc_info_TrainControlRequest_train_5fcontrol_2eproto}, {
       &scc_info_TrainControlRequest_DoSetSpeed_train_5fcontrol_2eproto.base,
       &scc_info_TrainControlRequest_DoSetAccessory_train_5fcontrol_2eproto.base,
       &scc_info_TrainControlRequest_DoSetEmergencyStop_train_5fcontrol_2eproto.base,
@@ -293,7 +317,8 @@ static void InitDefaultsscc_info_TrainControlRequest_train_5fcontrol_2eproto() {
       &scc_info_TrainControlRequest_DoPicMisc_train_5fcontrol_2eproto.base,
       &scc_info_TrainControlRequest_DoReflashPic_train_5fcontrol_2eproto.base,
       &scc_info_TrainControlRequest_DoGetOrSetCV_train_5fcontrol_2eproto.base,
-      &scc_info_TrainControlRequest_DoWaitForChange_train_5fcontrol_2eproto.base,}};
+      &scc_info_TrainControlRequest_DoWaitForChange_train_5fcontrol_2eproto.base,
+      &scc_info_TrainControlRequest_DoSubscribe_train_5fcontrol_2eproto.base,}};
 
 static void InitDefaultsscc_info_TrainControlRequest_DoChangeSavedState_train_5fcontrol_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
@@ -519,6 +544,20 @@ static void InitDefaultsscc_info_TrainControlRequest_DoSetSpeed_train_5fcontrol_
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TrainControlRequest_DoSetSpeed_train_5fcontrol_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TrainControlRequest_DoSetSpeed_train_5fcontrol_2eproto}, {}};
 
+static void InitDefaultsscc_info_TrainControlRequest_DoSubscribe_train_5fcontrol_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::server::_TrainControlRequest_DoSubscribe_default_instance_;
+    new (ptr) ::server::TrainControlRequest_DoSubscribe();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::server::TrainControlRequest_DoSubscribe::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TrainControlRequest_DoSubscribe_train_5fcontrol_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TrainControlRequest_DoSubscribe_train_5fcontrol_2eproto}, {}};
+
 static void InitDefaultsscc_info_TrainControlRequest_DoWaitForChange_train_5fcontrol_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -541,11 +580,17 @@ static void InitDefaultsscc_info_TrainControlResponse_train_5fcontrol_2eproto()
     new (ptr) ::server::TrainControlResponse();
     ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
   }
+  {
+    void* ptr = &::server::_TrainControlResponse_Batch_default_instance_;
+    new (ptr) ::server::TrainControlResponse_Batch();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
   ::server::TrainControlResponse::InitAsDefaultInstance();
+  ::server::TrainControlResponse_Batch::InitAsDefaultInstance();
 }
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<14> scc_info_TrainControlResponse_train_5fcontrol_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 14, 0, InitDefaultsscc_info_TrainControlResponse_train_5fcontrol_2eproto}, {
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<15> scc_info_TrainControlResponse_train_5fcontrol_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 15, 0, InitDefaultsscc_info_TrainControlResponse_train_5fcontrol_2eproto}, {
       &scc_info_TrainControlResponse_Speed_train_5fcontrol_2eproto.base,
       &scc_info_TrainControlResponse_Accessory_train_5fcontrol_2eproto.base,
       &scc_info_TrainControlResponse_EmergencyStop_train_5fcontrol_2eproto.base,
@@ -559,7 +604,8 @@ static void InitDefaultsscc_info_TrainControlResponse_train_5fcontrol_2eproto()
       &scc_info_TrainControlResponse_PicMisc_train_5fcontrol_2eproto.base,
       &scc_info_TrainControlResponse_ReflashPic_train_5fcontrol_2eproto.base,
       &scc_info_TrainControlResponse_Cv_train_5fcontrol_2eproto.base,
-      &scc_info_TrainControlResponse_WaitForChangeResponse_train_5fcontrol_2eproto.base,}};
+      &scc_info_TrainControlResponse_WaitForChangeResponse_train_5fcontrol_2eproto.base,
+      &scc_info_TrainControlResponse_Change_train_5fcontrol_2eproto.base,}};
 
 static void InitDefaultsscc_info_TrainControlResponse_Accessory_train_5fcontrol_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
@@ -575,6 +621,20 @@ static void InitDefaultsscc_info_TrainControlResponse_Accessory_train_5fcontrol_
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TrainControlResponse_Accessory_train_5fcontrol_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TrainControlResponse_Accessory_train_5fcontrol_2eproto}, {}};
 
+static void InitDefaultsscc_info_TrainControlResponse_Change_train_5fcontrol_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::server::_TrainControlResponse_Change_default_instance_;
+    new (ptr) ::server::TrainControlResponse_Change();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::server::TrainControlResponse_Change::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TrainControlResponse_Change_train_5fcontrol_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TrainControlResponse_Change_train_5fcontrol_2eproto}, {}};
+
 static void InitDefaultsscc_info_TrainControlResponse_CurrentAddress_train_5fcontrol_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -773,7 +833,7 @@ static void InitDefaultsscc_info_TrainControlResponse_WaitForChangeResponse_trai
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_TrainControlResponse_WaitForChangeResponse_train_5fcontrol_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_TrainControlResponse_WaitForChangeResponse_train_5fcontrol_2eproto}, {}};
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_train_5fcontrol_2eproto[38];
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_train_5fcontrol_2eproto[42];
 static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_train_5fcontrol_2eproto = nullptr;
 static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_train_5fcontrol_2eproto = nullptr;
 
@@ -962,6 +1022,19 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_train_5fcontrol_2eproto::offse
   PROTOBUF_FIELD_OFFSET(::server::TrainControlRequest_DoWaitForChange, id_),
   1,
   0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlRequest_DoBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlRequest_DoBatch, request_),
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlRequest_DoSubscribe, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlRequest_DoSubscribe, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlRequest_DoSubscribe, resume_seq_),
+  0,
   PROTOBUF_FIELD_OFFSET(::server::TrainControlRequest, _has_bits_),
   PROTOBUF_FIELD_OFFSET(::server::TrainControlRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -985,6 +1058,8 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_train_5fcontrol_2eproto::offse
   PROTOBUF_FIELD_OFFSET(::server::TrainControlRequest, doreflashpic_),
   PROTOBUF_FIELD_OFFSET(::server::TrainControlRequest, dogetorsetcv_),
   PROTOBUF_FIELD_OFFSET(::server::TrainControlRequest, dowaitforchange_),
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlRequest, dobatch_),
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlRequest, dosubscribe_),
   0,
   1,
   2,
@@ -1003,6 +1078,8 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_train_5fcontrol_2eproto::offse
   15,
   16,
   17,
+  18,
+  19,
   PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse_Speed, _has_bits_),
   PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse_Speed, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -1144,6 +1221,33 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_train_5fcontrol_2eproto::offse
   PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse_WaitForChangeResponse, id_),
   1,
   0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse_Batch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse_Batch, response_),
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse_Change, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse_Change, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse_Change, seq_),
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse_Change, id_),
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse_Change, fn_id_),
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse_Change, value_),
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse_Change, dir_),
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse_Change, speed_),
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse_Change, stop_),
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse_Change, ts_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
   PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse, _has_bits_),
   PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -1163,6 +1267,9 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_train_5fcontrol_2eproto::offse
   PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse, reflashpic_),
   PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse, cv_),
   PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse, waitforchangeresponse_),
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse, batch_),
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse, change_),
+  PROTOBUF_FIELD_OFFSET(::server::TrainControlResponse, snapshot_seq_),
   0,
   1,
   2,
@@ -1177,6 +1284,9 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_train_5fcontrol_2eproto::offse
   10,
   11,
   12,
+  13,
+  ~0u,
+  14,
   PROTOBUF_FIELD_OFFSET(::server::TinyRpcRequest, _has_bits_),
   PROTOBUF_FIELD_OFFSET(::server::TinyRpcRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -1220,25 +1330,29 @@ static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOB
   { 158, -1, sizeof(::server::TrainControlRequest_DoReflashPic)},
   { 164, 172, sizeof(::server::TrainControlRequest_DoGetOrSetCV)},
   { 175, 182, sizeof(::server::TrainControlRequest_DoWaitForChange)},
-  { 184, 207, sizeof(::server::TrainControlRequest)},
-  { 225, 234, sizeof(::server::TrainControlResponse_Speed)},
-  { 238, 247, sizeof(::server::TrainControlResponse_Accessory)},
-  { 251, 257, sizeof(::server::TrainControlResponse_EmergencyStop)},
-  { 258, 265, sizeof(::server::TrainControlResponse_RpcResponse)},
-  { 267, 273, sizeof(::server::TrainControlResponse_Pong)},
-  { 274, 280, sizeof(::server::TrainControlResponse_CurrentAddress)},
-  { 281, -1, sizeof(::server::TrainControlResponse_RawCanPacket)},
-  { 287, 293, sizeof(::server::TrainControlResponse_ReflashAutomata)},
-  { 294, 301, sizeof(::server::TrainControlResponse_LokDb_Lok_Function)},
-  { 303, 312, sizeof(::server::TrainControlResponse_LokDb_Lok)},
-  { 316, -1, sizeof(::server::TrainControlResponse_LokDb)},
-  { 322, 332, sizeof(::server::TrainControlResponse_PicMisc)},
-  { 337, 343, sizeof(::server::TrainControlResponse_ReflashPic)},
-  { 344, 353, sizeof(::server::TrainControlResponse_Cv)},
-  { 357, 364, sizeof(::server::TrainControlResponse_WaitForChangeResponse)},
-  { 366, 385, sizeof(::server::TrainControlResponse)},
-  { 399, 406, sizeof(::server::TinyRpcRequest)},
-  { 408, 417, sizeof(::server::TinyRpcResponse)},
+  { 184, -1, sizeof(::server::TrainControlRequest_DoBatch)},
+  { 190, 196, sizeof(::server::TrainControlRequest_DoSubscribe)},
+  { 197, 222, sizeof(::server::TrainControlRequest)},
+  { 242, 251, sizeof(::server::TrainControlResponse_Speed)},
+  { 255, 264, sizeof(::server::TrainControlResponse_Accessory)},
+  { 268, 274, sizeof(::server::TrainControlResponse_EmergencyStop)},
+  { 275, 282, sizeof(::server::TrainControlResponse_RpcResponse)},
+  { 284, 290, sizeof(::server::TrainControlResponse_Pong)},
+  { 291, 297, sizeof(::server::TrainControlResponse_CurrentAddress)},
+  { 298, -1, sizeof(::server::TrainControlResponse_RawCanPacket)},
+  { 304, 310, sizeof(::server::TrainControlResponse_ReflashAutomata)},
+  { 311, 318, sizeof(::server::TrainControlResponse_LokDb_Lok_Function)},
+  { 320, 329, sizeof(::server::TrainControlResponse_LokDb_Lok)},
+  { 333, -1, sizeof(::server::TrainControlResponse_LokDb)},
+  { 339, 349, sizeof(::server::TrainControlResponse_PicMisc)},
+  { 354, 360, sizeof(::server::TrainControlResponse_ReflashPic)},
+  { 361, 370, sizeof(::server::TrainControlResponse_Cv)},
+  { 374, 381, sizeof(::server::TrainControlResponse_WaitForChangeResponse)},
+  { 383, -1, sizeof(::server::TrainControlResponse_Batch)},
+  { 389, 402, sizeof(::server::TrainControlResponse_Change)},
+  { 410, 432, sizeof(::server::TrainControlResponse)},
+  { 449, 456, sizeof(::server::TinyRpcRequest)},
+  { 458, 467, sizeof(::server::TinyRpcResponse)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
@@ -1261,6 +1375,8 @@ static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] =
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::server::_TrainControlRequest_DoReflashPic_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::server::_TrainControlRequest_DoGetOrSetCV_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::server::_TrainControlRequest_DoWaitForChange_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::server::_TrainControlRequest_DoBatch_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::server::_TrainControlRequest_DoSubscribe_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::server::_TrainControlRequest_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::server::_TrainControlResponse_Speed_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::server::_TrainControlResponse_Accessory_default_instance_),
@@ -1277,6 +1393,8 @@ static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] =
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::server::_TrainControlResponse_ReflashPic_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::server::_TrainControlResponse_Cv_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::server::_TrainControlResponse_WaitForChangeResponse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::server::_TrainControlResponse_Batch_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::server::_TrainControlResponse_Change_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::server::_TrainControlResponse_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::server::_TinyRpcRequest_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::server::_TinyRpcResponse_default_instance_),
@@ -1288,7 +1406,7 @@ const char descriptor_table_protodef_train_5fcontrol_2eproto[] PROTOBUF_SECTION_
   "peed\030\003 \001(\005\022\020\n\010speed_ts\030\t \001(\003\0220\n\010function"
   "\030\004 \003(\n2\036.server.LokStateProto.Function\022\n"
   "\n\002ts\030\007 \001(\003\0321\n\010Function\022\n\n\002id\030\005 \002(\005\022\r\n\005va"
-  "lue\030\006 \001(\005\022\n\n\002ts\030\010 \001(\003\"\250\020\n\023TrainControlRe"
+  "lue\030\006 \001(\005\022\n\n\002ts\030\010 \001(\003\"\370\021\n\023TrainControlRe"
   "quest\022:\n\ndosetspeed\030\001 \001(\n2&.server.Train"
   "ControlRequest.DoSetSpeed\022B\n\016dosetaccess"
   "ory\030\004 \001(\n2*.server.TrainControlRequest.D"
@@ -1318,83 +1436,95 @@ const char descriptor_table_protodef_train_5fcontrol_2eproto[] PROTOBUF_SECTION_
   "setcv\0304 \001(\n2(.server.TrainControlRequest"
   ".DoGetOrSetCV\022D\n\017dowaitforchange\0308 \001(\n2+"
   ".server.TrainControlRequest.DoWaitForCha"
-  "nge\0327\n\nDoSetSpeed\022\n\n\002id\030\002 \002(\005\022\016\n\003dir\030$ \001"
-  "(\005:\0011\022\r\n\005speed\030\003 \001(\005\032G\n\016DoSetAccessory\022\020"
-  "\n\010train_id\030\005 \002(\005\022\024\n\014accessory_id\030\006 \002(\005\022\r"
-  "\n\005value\030\007 \001(\005\032\"\n\022DoSetEmergencyStop\022\014\n\004s"
-  "top\030\t \001(\010\032b\n\005DoRpc\022\033\n\023destination_addres"
-  "s\030\021 \002(\005\022\017\n\007command\030\022 \002(\005\022\014\n\004arg1\030\023 \002(\005\022\014"
-  "\n\004arg2\030\024 \002(\005\022\017\n\007payload\030< \003(\005\032\032\n\006DoPing\022"
-  "\020\n\005value\030\026 \001(\005:\0010\032(\n\021DoGetOrSetAddress\022\023"
-  "\n\013new_address\030\030 \001(\005\032\r\n\013DoDropState\032|\n\022Do"
-  "ChangeSavedState\022\021\n\tclient_id\030\033 \002(\005\022\016\n\006o"
-  "ffset\030\034 \002(\005\022\021\n\tnew_value\030\035 \001(\005\022\026\n\013bits_t"
-  "o_set\030\036 \001(\005:\0010\022\030\n\rbits_to_clear\030\037 \001(\005:\0010"
-  "\032B\n\022DoSendRawCanPacket\022\023\n\004wait\030! \001(\010:\005fa"
-  "lse\022\t\n\001d\030\" \003(\005\022\014\n\004data\030# \001(\t\032l\n\021DoReflas"
-  "hAutomata\022\033\n\023destination_address\030% \002(\005\022\026"
-  "\n\016signal_address\030= \001(\005\022\024\n\006offset\030& \001(\005:\004"
-  "3328\022\014\n\004data\030\' \003(\005\032\014\n\nDoGetLokDb\032\033\n\rDoGe"
-  "tLokState\022\n\n\002id\030+ \001(\005\032\031\n\013DoEStopLoco\022\n\n\002"
-  "id\030. \002(\005\032%\n\tDoPicMisc\022\013\n\003cmd\0300 \002(\005\022\013\n\003ar"
-  "g\0301 \003(\005\032\034\n\014DoReflashPic\022\014\n\004data\0303 \003(\005\032\?\n"
-  "\014DoGetOrSetCV\022\024\n\010train_id\0305 \001(\005:\00263\022\n\n\002c"
-  "v\0306 \002(\005\022\r\n\005value\0307 \001(\005\0320\n\017DoWaitForChang"
-  "e\022\021\n\ttimestamp\0309 \002(\004\022\n\n\002id\030: \001(\005\"\212\r\n\024Tra"
-  "inControlResponse\0221\n\005speed\030\001 \001(\n2\".serve"
-  "r.TrainControlResponse.Speed\0229\n\taccessor"
-  "y\030\004 \001(\n2&.server.TrainControlResponse.Ac"
-  "cessory\022A\n\remergencystop\030\010 \001(\n2*.server."
-  "TrainControlResponse.EmergencyStop\022=\n\013rp"
-  "cresponse\030\020 \001(\n2(.server.TrainControlRes"
-  "ponse.RpcResponse\022/\n\004pong\030\023 \001(\n2!.server"
-  ".TrainControlResponse.Pong\022C\n\016currentadd"
-  "ress\030\025 \001(\n2+.server.TrainControlResponse"
-  ".CurrentAddress\022\?\n\014rawcanpacket\030\027 \001(\n2)."
-  "server.TrainControlResponse.RawCanPacket"
-  "\022E\n\017reflashautomata\030\033 \001(\n2,.server.Train"
-  "ControlResponse.ReflashAutomata\0221\n\005lokdb"
-  "\030\034 \001(\n2\".server.TrainControlResponse.Lok"
-  "Db\022\'\n\010lokstate\030$ \003(\0132\025.server.LokStatePr"
-  "oto\0225\n\007picmisc\030% \001(\n2$.server.TrainContr"
-  "olResponse.PicMisc\022;\n\nreflashpic\030+ \001(\n2\'"
-  ".server.TrainControlResponse.ReflashPic\022"
-  "+\n\002cv\030- \001(\n2\037.server.TrainControlRespons"
-  "e.Cv\022Q\n\025waitforchangeresponse\0304 \001(\n22.se"
-  "rver.TrainControlResponse.WaitForChangeR"
-  "esponse\032E\n\005Speed\022\n\n\002id\030\002 \002(\005\022\016\n\003dir\030\031 \001("
-  "\005:\0011\022\r\n\005speed\030\003 \002(\005\022\021\n\ttimestamp\0302 \001(\004\032U"
-  "\n\tAccessory\022\020\n\010train_id\030\005 \002(\005\022\024\n\014accesso"
-  "ry_id\030\006 \002(\005\022\r\n\005value\030\007 \002(\005\022\021\n\ttimestamp\030"
-  "3 \001(\004\032\035\n\rEmergencyStop\022\014\n\004stop\030\t \002(\010\0320\n\013"
-  "RpcResponse\022\017\n\007success\030\021 \002(\010\022\020\n\010response"
-  "\030\022 \002(\005\032\025\n\004Pong\022\r\n\005value\030\024 \002(\005\032!\n\016Current"
-  "Address\022\017\n\007address\030\026 \002(\005\032\034\n\014RawCanPacket"
-  "\022\014\n\004data\030\030 \003(\005\032 \n\017ReflashAutomata\022\r\n\005err"
-  "or\030\032 \001(\t\032\330\001\n\005LokDb\0223\n\003lok\030\035 \003(\n2&.server"
-  ".TrainControlResponse.LokDb.Lok\032\231\001\n\003Lok\022"
-  "\n\n\002id\030\036 \002(\005\022\014\n\004name\030\037 \001(\t\022\017\n\007address\030  \001"
-  "(\005\022A\n\010function\030! \003(\n2/.server.TrainContr"
-  "olResponse.LokDb.Lok.Function\032$\n\010Functio"
-  "n\022\n\n\002id\030\" \002(\005\022\014\n\004type\030# \001(\005\032T\n\007PicMisc\022\013"
-  "\n\003cmd\030& \002(\005\022\016\n\006status\030\' \002(\005\022\014\n\004arg1\030( \002("
-  "\005\022\014\n\004arg2\030) \002(\005\022\020\n\010more_arg\030* \003(\005\032\033\n\nRef"
-  "lashPic\022\r\n\005error\030, \001(\t\032E\n\002Cv\022\020\n\010train_id"
-  "\030. \002(\005\022\n\n\002cv\030/ \002(\005\022\022\n\nerror_code\0300 \001(\005\022\r"
-  "\n\005value\0301 \001(\005\0326\n\025WaitForChangeResponse\022\021"
-  "\n\ttimestamp\0305 \002(\004\022\n\n\002id\0306 \001(\005\"J\n\016TinyRpc"
-  "Request\022\n\n\002id\030\001 \002(\005\022,\n\007request\030\002 \002(\0132\033.s"
-  "erver.TrainControlRequest\"z\n\017TinyRpcResp"
-  "onse\022\n\n\002id\030\001 \002(\005\022.\n\010response\030\004 \001(\0132\034.ser"
-  "ver.TrainControlResponse\022\025\n\006failed\030\002 \001(\010"
-  ":\005false\022\024\n\014error_detail\030\003 \001(\t2b\n\023TrainCo"
-  "ntrolService\022K\n\014TrainControl\022\033.server.Tr"
-  "ainControlRequest\032\034.server.TrainControlR"
-  "esponse\"\000"
+  "nge\0224\n\007dobatch\030> \001(\n2#.server.TrainContr"
+  "olRequest.DoBatch\022<\n\013dosubscribe\030@ \001(\n2\'"
+  ".server.TrainControlRequest.DoSubscribe\032"
+  "7\n\nDoSetSpeed\022\n\n\002id\030\002 \002(\005\022\016\n\003dir\030$ \001(\005:\001"
+  "1\022\r\n\005speed\030\003 \001(\005\032G\n\016DoSetAccessory\022\020\n\010tr"
+  "ain_id\030\005 \002(\005\022\024\n\014accessory_id\030\006 \002(\005\022\r\n\005va"
+  "lue\030\007 \001(\005\032\"\n\022DoSetEmergencyStop\022\014\n\004stop\030"
+  "\t \001(\010\032b\n\005DoRpc\022\033\n\023destination_address\030\021 "
+  "\002(\005\022\017\n\007command\030\022 \002(\005\022\014\n\004arg1\030\023 \002(\005\022\014\n\004ar"
+  "g2\030\024 \002(\005\022\017\n\007payload\030< \003(\005\032\032\n\006DoPing\022\020\n\005v"
+  "alue\030\026 \001(\005:\0010\032(\n\021DoGetOrSetAddress\022\023\n\013ne"
+  "w_address\030\030 \001(\005\032\r\n\013DoDropState\032|\n\022DoChan"
+  "geSavedState\022\021\n\tclient_id\030\033 \002(\005\022\016\n\006offse"
+  "t\030\034 \002(\005\022\021\n\tnew_value\030\035 \001(\005\022\026\n\013bits_to_se"
+  "t\030\036 \001(\005:\0010\022\030\n\rbits_to_clear\030\037 \001(\005:\0010\032B\n\022"
+  "DoSendRawCanPacket\022\023\n\004wait\030! \001(\010:\005false\022"
+  "\t\n\001d\030\" \003(\005\022\014\n\004data\030# \001(\t\032l\n\021DoReflashAut"
+  "omata\022\033\n\023destination_address\030% \002(\005\022\026\n\016si"
+  "gnal_address\030= \001(\005\022\024\n\006offset\030& \001(\005:\0043328"
+  "\022\014\n\004data\030\' \003(\005\032\014\n\nDoGetLokDb\032\033\n\rDoGetLok"
+  "State\022\n\n\002id\030+ \001(\005\032\031\n\013DoEStopLoco\022\n\n\002id\030."
+  " \002(\005\032%\n\tDoPicMisc\022\013\n\003cmd\0300 \002(\005\022\013\n\003arg\0301 "
+  "\003(\005\032\034\n\014DoReflashPic\022\014\n\004data\0303 \003(\005\032\?\n\014DoG"
+  "etOrSetCV\022\024\n\010train_id\0305 \001(\005:\00263\022\n\n\002cv\0306 "
+  "\002(\005\022\r\n\005value\0307 \001(\005\0320\n\017DoWaitForChange\022\021\n"
+  "\ttimestamp\0309 \002(\004\022\n\n\002id\030: \001(\005\0327\n\007DoBatch\022"
+  ",\n\007request\030\? \003(\0132\033.server.TrainControlRe"
+  "quest\032!\n\013DoSubscribe\022\022\n\nresume_seq\030A \001(\004"
+  "\"\270\017\n\024TrainControlResponse\0221\n\005speed\030\001 \001(\n"
+  "2\".server.TrainControlResponse.Speed\0229\n\t"
+  "accessory\030\004 \001(\n2&.server.TrainControlRes"
+  "ponse.Accessory\022A\n\remergencystop\030\010 \001(\n2*"
+  ".server.TrainControlResponse.EmergencySt"
+  "op\022=\n\013rpcresponse\030\020 \001(\n2(.server.TrainCo"
+  "ntrolResponse.RpcResponse\022/\n\004pong\030\023 \001(\n2"
+  "!.server.TrainControlResponse.Pong\022C\n\016cu"
+  "rrentaddress\030\025 \001(\n2+.server.TrainControl"
+  "Response.CurrentAddress\022\?\n\014rawcanpacket\030"
+  "\027 \001(\n2).server.TrainControlResponse.RawC"
+  "anPacket\022E\n\017reflashautomata\030\033 \001(\n2,.serv"
+  "er.TrainControlResponse.ReflashAutomata\022"
+  "1\n\005lokdb\030\034 \001(\n2\".server.TrainControlResp"
+  "onse.LokDb\022\'\n\010lokstate\030$ \003(\0132\025.server.Lo"
+  "kStateProto\0225\n\007picmisc\030% \001(\n2$.server.Tr"
+  "ainControlResponse.PicMisc\022;\n\nreflashpic"
+  "\030+ \001(\n2\'.server.TrainControlResponse.Ref"
+  "lashPic\022+\n\002cv\030- \001(\n2\037.server.TrainContro"
+  "lResponse.Cv\022Q\n\025waitforchangeresponse\0304 "
+  "\001(\n22.server.TrainControlResponse.WaitFo"
+  "rChangeResponse\0221\n\005batch\0307 \001(\n2\".server."
+  "TrainControlResponse.Batch\0223\n\006change\0309 \003"
+  "(\n2#.server.TrainControlResponse.Change\022"
+  "\024\n\014snapshot_seq\030B \001(\004\032E\n\005Speed\022\n\n\002id\030\002 \002"
+  "(\005\022\016\n\003dir\030\031 \001(\005:\0011\022\r\n\005speed\030\003 \002(\005\022\021\n\ttim"
+  "estamp\0302 \001(\004\032U\n\tAccessory\022\020\n\010train_id\030\005 "
+  "\002(\005\022\024\n\014accessory_id\030\006 \002(\005\022\r\n\005value\030\007 \002(\005"
+  "\022\021\n\ttimestamp\0303 \001(\004\032\035\n\rEmergencyStop\022\014\n\004"
+  "stop\030\t \002(\010\0320\n\013RpcResponse\022\017\n\007success\030\021 \002"
+  "(\010\022\020\n\010response\030\022 \002(\005\032\025\n\004Pong\022\r\n\005value\030\024 "
+  "\002(\005\032!\n\016CurrentAddress\022\017\n\007address\030\026 \002(\005\032\034"
+  "\n\014RawCanPacket\022\014\n\004data\030\030 \003(\005\032 \n\017ReflashA"
+  "utomata\022\r\n\005error\030\032 \001(\t\032\330\001\n\005LokDb\0223\n\003lok\030"
+  "\035 \003(\n2&.server.TrainControlResponse.LokD"
+  "b.Lok\032\231\001\n\003Lok\022\n\n\002id\030\036 \002(\005\022\014\n\004name\030\037 \001(\t\022"
+  "\017\n\007address\030  \001(\005\022A\n\010function\030! \003(\n2/.ser"
+  "ver.TrainControlResponse.LokDb.Lok.Funct"
+  "ion\032$\n\010Function\022\n\n\002id\030\" \002(\005\022\014\n\004type\030# \001("
+  "\005\032T\n\007PicMisc\022\013\n\003cmd\030& \002(\005\022\016\n\006status\030\' \002("
+  "\005\022\014\n\004arg1\030( \002(\005\022\014\n\004arg2\030) \002(\005\022\020\n\010more_ar"
+  "g\030* \003(\005\032\033\n\nReflashPic\022\r\n\005error\030, \001(\t\032E\n\002"
+  "Cv\022\020\n\010train_id\030. \002(\005\022\n\n\002cv\030/ \002(\005\022\022\n\nerro"
+  "r_code\0300 \001(\005\022\r\n\005value\0301 \001(\005\0326\n\025WaitForCh"
+  "angeResponse\022\021\n\ttimestamp\0305 \002(\004\022\n\n\002id\0306 "
+  "\001(\005\0327\n\005Batch\022.\n\010response\0308 \003(\0132\034.server."
+  "TrainControlResponse\032u\n\006Change\022\013\n\003seq\030: "
+  "\002(\004\022\n\n\002id\030; \001(\005\022\r\n\005fn_id\030< \001(\005\022\r\n\005value\030"
+  "= \001(\005\022\013\n\003dir\030> \001(\005\022\r\n\005speed\030\? \001(\005\022\014\n\004sto"
+  "p\030@ \001(\010\022\n\n\002ts\030A \001(\004\"J\n\016TinyRpcRequest\022\n\n"
+  "\002id\030\001 \002(\005\022,\n\007request\030\002 \002(\0132\033.server.Trai"
+  "nControlRequest\"z\n\017TinyRpcResponse\022\n\n\002id"
+  "\030\001 \002(\005\022.\n\010response\030\004 \001(\0132\034.server.TrainC"
+  "ontrolResponse\022\025\n\006failed\030\002 \001(\010:\005false\022\024\n"
+  "\014error_detail\030\003 \001(\t2b\n\023TrainControlServi"
+  "ce\022K\n\014TrainControl\022\033.server.TrainControl"
+  "Request\032\034.server.TrainControlResponse\"\000"
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_train_5fcontrol_2eproto_deps[1] = {
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_train_5fcontrol_2eproto_sccs[38] = {
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_train_5fcontrol_2eproto_sccs[40] = {
   &scc_info_LokStateProto_train_5fcontrol_2eproto.base,
   &scc_info_LokStateProto_Function_train_5fcontrol_2eproto.base,
   &scc_info_TinyRpcRequest_train_5fcontrol_2eproto.base,
@@ -1416,9 +1546,11 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_tra
   &scc_info_TrainControlRequest_DoSetAccessory_train_5fcontrol_2eproto.base,
   &scc_info_TrainControlRequest_DoSetEmergencyStop_train_5fcontrol_2eproto.base,
   &scc_info_TrainControlRequest_DoSetSpeed_train_5fcontrol_2eproto.base,
+  &scc_info_TrainControlRequest_DoSubscribe_train_5fcontrol_2eproto.base,
   &scc_info_TrainControlRequest_DoWaitForChange_train_5fcontrol_2eproto.base,
   &scc_info_TrainControlResponse_train_5fcontrol_2eproto.base,
   &scc_info_TrainControlResponse_Accessory_train_5fcontrol_2eproto.base,
+  &scc_info_TrainControlResponse_Change_train_5fcontrol_2eproto.base,
   &scc_info_TrainControlResponse_CurrentAddress_train_5fcontrol_2eproto.base,
   &scc_info_TrainControlResponse_Cv_train_5fcontrol_2eproto.base,
   &scc_info_TrainControlResponse_EmergencyStop_train_5fcontrol_2eproto.base,
@@ -1436,10 +1568,10 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_tra
 };
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_train_5fcontrol_2eproto_once;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_train_5fcontrol_2eproto = {
-  false, false, descriptor_table_protodef_train_5fcontrol_2eproto, "train_control.proto", 4289,
-  &descriptor_table_train_5fcontrol_2eproto_once, descriptor_table_train_5fcontrol_2eproto_sccs, descriptor_table_train_5fcontrol_2eproto_deps, 38, 0,
+  false, false, descriptor_table_protodef_train_5fcontrol_2eproto, "train_control.proto", 4799,
+  &descriptor_table_train_5fcontrol_2eproto_once, descriptor_table_train_5fcontrol_2eproto_sccs, descriptor_table_train_5fcontrol_2eproto_deps, 40, 0,
   schemas, file_default_instances, TableStruct_train_5fcontrol_2eproto::offsets,
-  file_level_metadata_train_5fcontrol_2eproto, 38, file_level_enum_descriptors_train_5fcontrol_2eproto, file_level_service_descriptors_train_5fcontrol_2eproto,
+  file_level_metadata_train_5fcontrol_2eproto, 42, file_level_enum_descriptors_train_5fcontrol_2eproto, file_level_service_descriptors_train_5fcontrol_2eproto,
 };
 
 // Force running AddDescriptors() at dynamic initialization time.
@@ -6433,436 +6565,275 @@ void TrainControlRequest_DoWaitForChange::InternalSwap(TrainControlRequest_DoWai
 
 // ===================================================================
 
-void TrainControlRequest::InitAsDefaultInstance() {
-  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dosetspeed_ = const_cast< ::server::TrainControlRequest_DoSetSpeed*>(
-      ::server::TrainControlRequest_DoSetSpeed::internal_default_instance());
-  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dosetaccessory_ = const_cast< ::server::TrainControlRequest_DoSetAccessory*>(
-      ::server::TrainControlRequest_DoSetAccessory::internal_default_instance());
-  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dosetemergencystop_ = const_cast< ::server::TrainControlRequest_DoSetEmergencyStop*>(
-      ::server::TrainControlRequest_DoSetEmergencyStop::internal_default_instance());
-  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dorpc_ = const_cast< ::server::TrainControlRequest_DoRpc*>(
-      ::server::TrainControlRequest_DoRpc::internal_default_instance());
-  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->doping_ = const_cast< ::server::TrainControlRequest_DoPing*>(
-      ::server::TrainControlRequest_DoPing::internal_default_instance());
-  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dogetorsetaddress_ = const_cast< ::server::TrainControlRequest_DoGetOrSetAddress*>(
-      ::server::TrainControlRequest_DoGetOrSetAddress::internal_default_instance());
-  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dodropstate_ = const_cast< ::server::TrainControlRequest_DoDropState*>(
-      ::server::TrainControlRequest_DoDropState::internal_default_instance());
-  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dochangesavedstate_ = const_cast< ::server::TrainControlRequest_DoChangeSavedState*>(
-      ::server::TrainControlRequest_DoChangeSavedState::internal_default_instance());
-  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dosendrawcanpacket_ = const_cast< ::server::TrainControlRequest_DoSendRawCanPacket*>(
-      ::server::TrainControlRequest_DoSendRawCanPacket::internal_default_instance());
-  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->doreflashautomata_ = const_cast< ::server::TrainControlRequest_DoReflashAutomata*>(
-      ::server::TrainControlRequest_DoReflashAutomata::internal_default_instance());
-  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dogetlokdb_ = const_cast< ::server::TrainControlRequest_DoGetLokDb*>(
-      ::server::TrainControlRequest_DoGetLokDb::internal_default_instance());
-  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dogetlokstate_ = const_cast< ::server::TrainControlRequest_DoGetLokState*>(
-      ::server::TrainControlRequest_DoGetLokState::internal_default_instance());
-  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dosetlokstate_ = const_cast< ::server::LokStateProto*>(
-      ::server::LokStateProto::internal_default_instance());
-  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->doestoploco_ = const_cast< ::server::TrainControlRequest_DoEStopLoco*>(
-      ::server::TrainControlRequest_DoEStopLoco::internal_default_instance());
-  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dopicmisc_ = const_cast< ::server::TrainControlRequest_DoPicMisc*>(
-      ::server::TrainControlRequest_DoPicMisc::internal_default_instance());
-  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->doreflashpic_ = const_cast< ::server::TrainControlRequest_DoReflashPic*>(
-      ::server::TrainControlRequest_DoReflashPic::internal_default_instance());
-  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dogetorsetcv_ = const_cast< ::server::TrainControlRequest_DoGetOrSetCV*>(
-      ::server::TrainControlRequest_DoGetOrSetCV::internal_default_instance());
-  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dowaitforchange_ = const_cast< ::server::TrainControlRequest_DoWaitForChange*>(
-      ::server::TrainControlRequest_DoWaitForChange::internal_default_instance());
+void TrainControlRequest_DoBatch::InitAsDefaultInstance() {
 }
-class TrainControlRequest::_Internal {
+class TrainControlRequest_DoBatch::_Internal {
  public:
-  using HasBits = decltype(std::declval<TrainControlRequest>()._has_bits_);
-  static const ::server::TrainControlRequest_DoSetSpeed& dosetspeed(const TrainControlRequest* msg);
-  static void set_has_dosetspeed(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
-  static const ::server::TrainControlRequest_DoSetAccessory& dosetaccessory(const TrainControlRequest* msg);
-  static void set_has_dosetaccessory(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
-  }
-  static const ::server::TrainControlRequest_DoSetEmergencyStop& dosetemergencystop(const TrainControlRequest* msg);
-  static void set_has_dosetemergencystop(HasBits* has_bits) {
-    (*has_bits)[0] |= 4u;
-  }
-  static const ::server::TrainControlRequest_DoRpc& dorpc(const TrainControlRequest* msg);
-  static void set_has_dorpc(HasBits* has_bits) {
-    (*has_bits)[0] |= 8u;
-  }
-  static const ::server::TrainControlRequest_DoPing& doping(const TrainControlRequest* msg);
-  static void set_has_doping(HasBits* has_bits) {
-    (*has_bits)[0] |= 16u;
-  }
-  static const ::server::TrainControlRequest_DoGetOrSetAddress& dogetorsetaddress(const TrainControlRequest* msg);
-  static void set_has_dogetorsetaddress(HasBits* has_bits) {
-    (*has_bits)[0] |= 32u;
-  }
-  static const ::server::TrainControlRequest_DoDropState& dodropstate(const TrainControlRequest* msg);
-  static void set_has_dodropstate(HasBits* has_bits) {
-    (*has_bits)[0] |= 64u;
-  }
-  static const ::server::TrainControlRequest_DoChangeSavedState& dochangesavedstate(const TrainControlRequest* msg);
-  static void set_has_dochangesavedstate(HasBits* has_bits) {
-    (*has_bits)[0] |= 128u;
-  }
-  static const ::server::TrainControlRequest_DoSendRawCanPacket& dosendrawcanpacket(const TrainControlRequest* msg);
-  static void set_has_dosendrawcanpacket(HasBits* has_bits) {
-    (*has_bits)[0] |= 256u;
-  }
-  static const ::server::TrainControlRequest_DoReflashAutomata& doreflashautomata(const TrainControlRequest* msg);
-  static void set_has_doreflashautomata(HasBits* has_bits) {
-    (*has_bits)[0] |= 512u;
-  }
-  static const ::server::TrainControlRequest_DoGetLokDb& dogetlokdb(const TrainControlRequest* msg);
-  static void set_has_dogetlokdb(HasBits* has_bits) {
-    (*has_bits)[0] |= 1024u;
-  }
-  static const ::server::TrainControlRequest_DoGetLokState& dogetlokstate(const TrainControlRequest* msg);
-  static void set_has_dogetlokstate(HasBits* has_bits) {
-    (*has_bits)[0] |= 2048u;
-  }
-  static const ::server::LokStateProto& dosetlokstate(const TrainControlRequest* msg);
-  static void set_has_dosetlokstate(HasBits* has_bits) {
-    (*has_bits)[0] |= 4096u;
-  }
-  static const ::server::TrainControlRequest_DoEStopLoco& doestoploco(const TrainControlRequest* msg);
-  static void set_has_doestoploco(HasBits* has_bits) {
-    (*has_bits)[0] |= 8192u;
-  }
-  static const ::server::TrainControlRequest_DoPicMisc& dopicmisc(const TrainControlRequest* msg);
-  static void set_has_dopicmisc(HasBits* has_bits) {
-    (*has_bits)[0] |= 16384u;
-  }
-  static const ::server::TrainControlRequest_DoReflashPic& doreflashpic(const TrainControlRequest* msg);
-  static void set_has_doreflashpic(HasBits* has_bits) {
-    (*has_bits)[0] |= 32768u;
-  }
-  static const ::server::TrainControlRequest_DoGetOrSetCV& dogetorsetcv(const TrainControlRequest* msg);
-  static void set_has_dogetorsetcv(HasBits* has_bits) {
-    (*has_bits)[0] |= 65536u;
-  }
-  static const ::server::TrainControlRequest_DoWaitForChange& dowaitforchange(const TrainControlRequest* msg);
-  static void set_has_dowaitforchange(HasBits* has_bits) {
-    (*has_bits)[0] |= 131072u;
-  }
 };
 
-const ::server::TrainControlRequest_DoSetSpeed&
-TrainControlRequest::_Internal::dosetspeed(const TrainControlRequest* msg) {
-  return *msg->dosetspeed_;
+TrainControlRequest_DoBatch::TrainControlRequest_DoBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  request_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlRequest.DoBatch)
 }
-const ::server::TrainControlRequest_DoSetAccessory&
-TrainControlRequest::_Internal::dosetaccessory(const TrainControlRequest* msg) {
-  return *msg->dosetaccessory_;
+TrainControlRequest_DoBatch::TrainControlRequest_DoBatch(const TrainControlRequest_DoBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      request_(from.request_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlRequest.DoBatch)
 }
-const ::server::TrainControlRequest_DoSetEmergencyStop&
-TrainControlRequest::_Internal::dosetemergencystop(const TrainControlRequest* msg) {
-  return *msg->dosetemergencystop_;
+
+void TrainControlRequest_DoBatch::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TrainControlRequest_train_5fcontrol_2eproto.base);
 }
-const ::server::TrainControlRequest_DoRpc&
-TrainControlRequest::_Internal::dorpc(const TrainControlRequest* msg) {
-  return *msg->dorpc_;
+
+TrainControlRequest_DoBatch::~TrainControlRequest_DoBatch() {
+  // @@protoc_insertion_point(destructor:server.TrainControlRequest.DoBatch)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
-const ::server::TrainControlRequest_DoPing&
-TrainControlRequest::_Internal::doping(const TrainControlRequest* msg) {
-  return *msg->doping_;
+
+void TrainControlRequest_DoBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
 }
-const ::server::TrainControlRequest_DoGetOrSetAddress&
-TrainControlRequest::_Internal::dogetorsetaddress(const TrainControlRequest* msg) {
-  return *msg->dogetorsetaddress_;
+
+void TrainControlRequest_DoBatch::ArenaDtor(void* object) {
+  TrainControlRequest_DoBatch* _this = reinterpret_cast< TrainControlRequest_DoBatch* >(object);
+  (void)_this;
 }
-const ::server::TrainControlRequest_DoDropState&
-TrainControlRequest::_Internal::dodropstate(const TrainControlRequest* msg) {
-  return *msg->dodropstate_;
+void TrainControlRequest_DoBatch::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-const ::server::TrainControlRequest_DoChangeSavedState&
-TrainControlRequest::_Internal::dochangesavedstate(const TrainControlRequest* msg) {
-  return *msg->dochangesavedstate_;
+void TrainControlRequest_DoBatch::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
 }
-const ::server::TrainControlRequest_DoSendRawCanPacket&
-TrainControlRequest::_Internal::dosendrawcanpacket(const TrainControlRequest* msg) {
-  return *msg->dosendrawcanpacket_;
+const TrainControlRequest_DoBatch& TrainControlRequest_DoBatch::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlRequest_train_5fcontrol_2eproto.base);
+  return *internal_default_instance();
 }
-const ::server::TrainControlRequest_DoReflashAutomata&
-TrainControlRequest::_Internal::doreflashautomata(const TrainControlRequest* msg) {
-  return *msg->doreflashautomata_;
+
+
+void TrainControlRequest_DoBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlRequest.DoBatch)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  request_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
-const ::server::TrainControlRequest_DoGetLokDb&
-TrainControlRequest::_Internal::dogetlokdb(const TrainControlRequest* msg) {
-  return *msg->dogetlokdb_;
+
+const char* TrainControlRequest_DoBatch::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated .server.TrainControlRequest request = 63;
+      case 63:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 250)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_request(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<506>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
 }
-const ::server::TrainControlRequest_DoGetLokState&
-TrainControlRequest::_Internal::dogetlokstate(const TrainControlRequest* msg) {
-  return *msg->dogetlokstate_;
+
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlRequest_DoBatch::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlRequest.DoBatch)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .server.TrainControlRequest request = 63;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_request_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(63, this->_internal_request(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlRequest.DoBatch)
+  return target;
 }
-const ::server::LokStateProto&
-TrainControlRequest::_Internal::dosetlokstate(const TrainControlRequest* msg) {
-  return *msg->dosetlokstate_;
+
+size_t TrainControlRequest_DoBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlRequest.DoBatch)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .server.TrainControlRequest request = 63;
+  total_size += 2UL * this->_internal_request_size();
+  for (const auto& msg : this->request_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
 }
-const ::server::TrainControlRequest_DoEStopLoco&
-TrainControlRequest::_Internal::doestoploco(const TrainControlRequest* msg) {
-  return *msg->doestoploco_;
+
+void TrainControlRequest_DoBatch::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlRequest.DoBatch)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TrainControlRequest_DoBatch* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlRequest_DoBatch>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlRequest.DoBatch)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlRequest.DoBatch)
+    MergeFrom(*source);
+  }
 }
-const ::server::TrainControlRequest_DoPicMisc&
-TrainControlRequest::_Internal::dopicmisc(const TrainControlRequest* msg) {
-  return *msg->dopicmisc_;
+
+void TrainControlRequest_DoBatch::MergeFrom(const TrainControlRequest_DoBatch& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlRequest.DoBatch)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  request_.MergeFrom(from.request_);
 }
-const ::server::TrainControlRequest_DoReflashPic&
-TrainControlRequest::_Internal::doreflashpic(const TrainControlRequest* msg) {
-  return *msg->doreflashpic_;
+
+void TrainControlRequest_DoBatch::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlRequest.DoBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
-const ::server::TrainControlRequest_DoGetOrSetCV&
-TrainControlRequest::_Internal::dogetorsetcv(const TrainControlRequest* msg) {
-  return *msg->dogetorsetcv_;
+
+void TrainControlRequest_DoBatch::CopyFrom(const TrainControlRequest_DoBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlRequest.DoBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
-const ::server::TrainControlRequest_DoWaitForChange&
-TrainControlRequest::_Internal::dowaitforchange(const TrainControlRequest* msg) {
-  return *msg->dowaitforchange_;
+
+bool TrainControlRequest_DoBatch::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(request_)) return false;
+  return true;
 }
-TrainControlRequest::TrainControlRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+
+void TrainControlRequest_DoBatch::InternalSwap(TrainControlRequest_DoBatch* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  request_.InternalSwap(&other->request_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlRequest_DoBatch::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TrainControlRequest_DoSubscribe::InitAsDefaultInstance() {
+}
+class TrainControlRequest_DoSubscribe::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TrainControlRequest_DoSubscribe>()._has_bits_);
+  static void set_has_resume_seq(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+TrainControlRequest_DoSubscribe::TrainControlRequest_DoSubscribe(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:server.TrainControlRequest)
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlRequest.DoSubscribe)
 }
-TrainControlRequest::TrainControlRequest(const TrainControlRequest& from)
+TrainControlRequest_DoSubscribe::TrainControlRequest_DoSubscribe(const TrainControlRequest_DoSubscribe& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
       _has_bits_(from._has_bits_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_dosetspeed()) {
-    dosetspeed_ = new ::server::TrainControlRequest_DoSetSpeed(*from.dosetspeed_);
-  } else {
-    dosetspeed_ = nullptr;
-  }
-  if (from._internal_has_dosetaccessory()) {
-    dosetaccessory_ = new ::server::TrainControlRequest_DoSetAccessory(*from.dosetaccessory_);
-  } else {
-    dosetaccessory_ = nullptr;
-  }
-  if (from._internal_has_dosetemergencystop()) {
-    dosetemergencystop_ = new ::server::TrainControlRequest_DoSetEmergencyStop(*from.dosetemergencystop_);
-  } else {
-    dosetemergencystop_ = nullptr;
-  }
-  if (from._internal_has_dorpc()) {
-    dorpc_ = new ::server::TrainControlRequest_DoRpc(*from.dorpc_);
-  } else {
-    dorpc_ = nullptr;
-  }
-  if (from._internal_has_doping()) {
-    doping_ = new ::server::TrainControlRequest_DoPing(*from.doping_);
-  } else {
-    doping_ = nullptr;
-  }
-  if (from._internal_has_dogetorsetaddress()) {
-    dogetorsetaddress_ = new ::server::TrainControlRequest_DoGetOrSetAddress(*from.dogetorsetaddress_);
-  } else {
-    dogetorsetaddress_ = nullptr;
-  }
-  if (from._internal_has_dodropstate()) {
-    dodropstate_ = new ::server::TrainControlRequest_DoDropState(*from.dodropstate_);
-  } else {
-    dodropstate_ = nullptr;
-  }
-  if (from._internal_has_dochangesavedstate()) {
-    dochangesavedstate_ = new ::server::TrainControlRequest_DoChangeSavedState(*from.dochangesavedstate_);
-  } else {
-    dochangesavedstate_ = nullptr;
-  }
-  if (from._internal_has_dosendrawcanpacket()) {
-    dosendrawcanpacket_ = new ::server::TrainControlRequest_DoSendRawCanPacket(*from.dosendrawcanpacket_);
-  } else {
-    dosendrawcanpacket_ = nullptr;
-  }
-  if (from._internal_has_doreflashautomata()) {
-    doreflashautomata_ = new ::server::TrainControlRequest_DoReflashAutomata(*from.doreflashautomata_);
-  } else {
-    doreflashautomata_ = nullptr;
-  }
-  if (from._internal_has_dogetlokdb()) {
-    dogetlokdb_ = new ::server::TrainControlRequest_DoGetLokDb(*from.dogetlokdb_);
-  } else {
-    dogetlokdb_ = nullptr;
-  }
-  if (from._internal_has_dogetlokstate()) {
-    dogetlokstate_ = new ::server::TrainControlRequest_DoGetLokState(*from.dogetlokstate_);
-  } else {
-    dogetlokstate_ = nullptr;
-  }
-  if (from._internal_has_dosetlokstate()) {
-    dosetlokstate_ = new ::server::LokStateProto(*from.dosetlokstate_);
-  } else {
-    dosetlokstate_ = nullptr;
-  }
-  if (from._internal_has_doestoploco()) {
-    doestoploco_ = new ::server::TrainControlRequest_DoEStopLoco(*from.doestoploco_);
-  } else {
-    doestoploco_ = nullptr;
-  }
-  if (from._internal_has_dopicmisc()) {
-    dopicmisc_ = new ::server::TrainControlRequest_DoPicMisc(*from.dopicmisc_);
-  } else {
-    dopicmisc_ = nullptr;
-  }
-  if (from._internal_has_doreflashpic()) {
-    doreflashpic_ = new ::server::TrainControlRequest_DoReflashPic(*from.doreflashpic_);
-  } else {
-    doreflashpic_ = nullptr;
-  }
-  if (from._internal_has_dogetorsetcv()) {
-    dogetorsetcv_ = new ::server::TrainControlRequest_DoGetOrSetCV(*from.dogetorsetcv_);
-  } else {
-    dogetorsetcv_ = nullptr;
-  }
-  if (from._internal_has_dowaitforchange()) {
-    dowaitforchange_ = new ::server::TrainControlRequest_DoWaitForChange(*from.dowaitforchange_);
-  } else {
-    dowaitforchange_ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:server.TrainControlRequest)
+  resume_seq_ = from.resume_seq_;
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlRequest.DoSubscribe)
 }
 
-void TrainControlRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TrainControlRequest_train_5fcontrol_2eproto.base);
-  ::memset(&dosetspeed_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&dowaitforchange_) -
-      reinterpret_cast<char*>(&dosetspeed_)) + sizeof(dowaitforchange_));
+void TrainControlRequest_DoSubscribe::SharedCtor() {
+  resume_seq_ = PROTOBUF_ULONGLONG(0);
 }
 
-TrainControlRequest::~TrainControlRequest() {
-  // @@protoc_insertion_point(destructor:server.TrainControlRequest)
+TrainControlRequest_DoSubscribe::~TrainControlRequest_DoSubscribe() {
+  // @@protoc_insertion_point(destructor:server.TrainControlRequest.DoSubscribe)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void TrainControlRequest::SharedDtor() {
+void TrainControlRequest_DoSubscribe::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete dosetspeed_;
-  if (this != internal_default_instance()) delete dosetaccessory_;
-  if (this != internal_default_instance()) delete dosetemergencystop_;
-  if (this != internal_default_instance()) delete dorpc_;
-  if (this != internal_default_instance()) delete doping_;
-  if (this != internal_default_instance()) delete dogetorsetaddress_;
-  if (this != internal_default_instance()) delete dodropstate_;
-  if (this != internal_default_instance()) delete dochangesavedstate_;
-  if (this != internal_default_instance()) delete dosendrawcanpacket_;
-  if (this != internal_default_instance()) delete doreflashautomata_;
-  if (this != internal_default_instance()) delete dogetlokdb_;
-  if (this != internal_default_instance()) delete dogetlokstate_;
-  if (this != internal_default_instance()) delete dosetlokstate_;
-  if (this != internal_default_instance()) delete doestoploco_;
-  if (this != internal_default_instance()) delete dopicmisc_;
-  if (this != internal_default_instance()) delete doreflashpic_;
-  if (this != internal_default_instance()) delete dogetorsetcv_;
-  if (this != internal_default_instance()) delete dowaitforchange_;
 }
 
-void TrainControlRequest::ArenaDtor(void* object) {
-  TrainControlRequest* _this = reinterpret_cast< TrainControlRequest* >(object);
+void TrainControlRequest_DoSubscribe::ArenaDtor(void* object) {
+  TrainControlRequest_DoSubscribe* _this = reinterpret_cast< TrainControlRequest_DoSubscribe* >(object);
   (void)_this;
 }
-void TrainControlRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void TrainControlRequest_DoSubscribe::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void TrainControlRequest::SetCachedSize(int size) const {
+void TrainControlRequest_DoSubscribe::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const TrainControlRequest& TrainControlRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlRequest_train_5fcontrol_2eproto.base);
+const TrainControlRequest_DoSubscribe& TrainControlRequest_DoSubscribe::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlRequest_DoSubscribe_train_5fcontrol_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void TrainControlRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:server.TrainControlRequest)
+void TrainControlRequest_DoSubscribe::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlRequest.DoSubscribe)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x000000ffu) {
-    if (cached_has_bits & 0x00000001u) {
-      GOOGLE_DCHECK(dosetspeed_ != nullptr);
-      dosetspeed_->Clear();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      GOOGLE_DCHECK(dosetaccessory_ != nullptr);
-      dosetaccessory_->Clear();
-    }
-    if (cached_has_bits & 0x00000004u) {
-      GOOGLE_DCHECK(dosetemergencystop_ != nullptr);
-      dosetemergencystop_->Clear();
-    }
-    if (cached_has_bits & 0x00000008u) {
-      GOOGLE_DCHECK(dorpc_ != nullptr);
-      dorpc_->Clear();
-    }
-    if (cached_has_bits & 0x00000010u) {
-      GOOGLE_DCHECK(doping_ != nullptr);
-      doping_->Clear();
-    }
-    if (cached_has_bits & 0x00000020u) {
-      GOOGLE_DCHECK(dogetorsetaddress_ != nullptr);
-      dogetorsetaddress_->Clear();
-    }
-    if (cached_has_bits & 0x00000040u) {
-      GOOGLE_DCHECK(dodropstate_ != nullptr);
-      dodropstate_->Clear();
-    }
-    if (cached_has_bits & 0x00000080u) {
-      GOOGLE_DCHECK(dochangesavedstate_ != nullptr);
-      dochangesavedstate_->Clear();
-    }
-  }
-  if (cached_has_bits & 0x0000ff00u) {
-    if (cached_has_bits & 0x00000100u) {
-      GOOGLE_DCHECK(dosendrawcanpacket_ != nullptr);
-      dosendrawcanpacket_->Clear();
-    }
-    if (cached_has_bits & 0x00000200u) {
-      GOOGLE_DCHECK(doreflashautomata_ != nullptr);
-      doreflashautomata_->Clear();
-    }
-    if (cached_has_bits & 0x00000400u) {
-      GOOGLE_DCHECK(dogetlokdb_ != nullptr);
-      dogetlokdb_->Clear();
-    }
-    if (cached_has_bits & 0x00000800u) {
-      GOOGLE_DCHECK(dogetlokstate_ != nullptr);
-      dogetlokstate_->Clear();
-    }
-    if (cached_has_bits & 0x00001000u) {
-      GOOGLE_DCHECK(dosetlokstate_ != nullptr);
-      dosetlokstate_->Clear();
-    }
-    if (cached_has_bits & 0x00002000u) {
-      GOOGLE_DCHECK(doestoploco_ != nullptr);
-      doestoploco_->Clear();
-    }
-    if (cached_has_bits & 0x00004000u) {
-      GOOGLE_DCHECK(dopicmisc_ != nullptr);
-      dopicmisc_->Clear();
-    }
-    if (cached_has_bits & 0x00008000u) {
-      GOOGLE_DCHECK(doreflashpic_ != nullptr);
-      doreflashpic_->Clear();
-    }
-  }
-  if (cached_has_bits & 0x00030000u) {
-    if (cached_has_bits & 0x00010000u) {
-      GOOGLE_DCHECK(dogetorsetcv_ != nullptr);
-      dogetorsetcv_->Clear();
-    }
-    if (cached_has_bits & 0x00020000u) {
-      GOOGLE_DCHECK(dowaitforchange_ != nullptr);
-      dowaitforchange_->Clear();
-    }
-  }
+  resume_seq_ = PROTOBUF_ULONGLONG(0);
   _has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TrainControlRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TrainControlRequest_DoSubscribe::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
@@ -6871,129 +6842,11 @@ const char* TrainControlRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAME
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // optional group DoSetSpeed = 1 { ... };
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 11)) {
-          ptr = ctx->ParseGroup(_internal_mutable_dosetspeed(), ptr, 11);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional group DoSetAccessory = 4 { ... };
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 35)) {
-          ptr = ctx->ParseGroup(_internal_mutable_dosetaccessory(), ptr, 35);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional group DoSetEmergencyStop = 8 { ... };
-      case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 67)) {
-          ptr = ctx->ParseGroup(_internal_mutable_dosetemergencystop(), ptr, 67);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional group DoRpc = 16 { ... };
-      case 16:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 131)) {
-          ptr = ctx->ParseGroup(_internal_mutable_dorpc(), ptr, 131);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional group DoPing = 21 { ... };
-      case 21:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 171)) {
-          ptr = ctx->ParseGroup(_internal_mutable_doping(), ptr, 171);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional group DoGetOrSetAddress = 23 { ... };
-      case 23:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 187)) {
-          ptr = ctx->ParseGroup(_internal_mutable_dogetorsetaddress(), ptr, 187);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional group DoDropState = 25 { ... };
-      case 25:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 203)) {
-          ptr = ctx->ParseGroup(_internal_mutable_dodropstate(), ptr, 203);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional group DoChangeSavedState = 26 { ... };
-      case 26:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 211)) {
-          ptr = ctx->ParseGroup(_internal_mutable_dochangesavedstate(), ptr, 211);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional group DoSendRawCanPacket = 32 { ... };
-      case 32:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 3)) {
-          ptr = ctx->ParseGroup(_internal_mutable_dosendrawcanpacket(), ptr, 259);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional group DoReflashAutomata = 40 { ... };
-      case 40:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 67)) {
-          ptr = ctx->ParseGroup(_internal_mutable_doreflashautomata(), ptr, 323);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional group DoGetLokDb = 41 { ... };
-      case 41:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 75)) {
-          ptr = ctx->ParseGroup(_internal_mutable_dogetlokdb(), ptr, 331);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional group DoGetLokState = 42 { ... };
-      case 42:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 83)) {
-          ptr = ctx->ParseGroup(_internal_mutable_dogetlokstate(), ptr, 339);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional .server.LokStateProto DoSetLokState = 44;
-      case 44:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
-          ptr = ctx->ParseMessage(_internal_mutable_dosetlokstate(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional group DoEStopLoco = 45 { ... };
-      case 45:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 107)) {
-          ptr = ctx->ParseGroup(_internal_mutable_doestoploco(), ptr, 363);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional group DoPicMisc = 47 { ... };
-      case 47:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 123)) {
-          ptr = ctx->ParseGroup(_internal_mutable_dopicmisc(), ptr, 379);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional group DoReflashPic = 50 { ... };
-      case 50:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 147)) {
-          ptr = ctx->ParseGroup(_internal_mutable_doreflashpic(), ptr, 403);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional group DoGetOrSetCV = 52 { ... };
-      case 52:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 163)) {
-          ptr = ctx->ParseGroup(_internal_mutable_dogetorsetcv(), ptr, 419);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional group DoWaitForChange = 56 { ... };
-      case 56:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 195)) {
-          ptr = ctx->ParseGroup(_internal_mutable_dowaitforchange(), ptr, 451);
+      // optional uint64 resume_seq = 65;
+      case 65:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          _Internal::set_has_resume_seq(&has_bits);
+          resume_seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
@@ -7020,306 +6873,1839 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* TrainControlRequest::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlRequest_DoSubscribe::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlRequest.DoSubscribe)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  // optional group DoSetSpeed = 1 { ... };
+  // optional uint64 resume_seq = 65;
   if (cached_has_bits & 0x00000001u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteGroup(
-        1, _Internal::dosetspeed(this), target, stream);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(65, this->_internal_resume_seq(), target);
   }
 
-  // optional group DoSetAccessory = 4 { ... };
-  if (cached_has_bits & 0x00000002u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteGroup(
-        4, _Internal::dosetaccessory(this), target, stream);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlRequest.DoSubscribe)
+  return target;
+}
 
-  // optional group DoSetEmergencyStop = 8 { ... };
-  if (cached_has_bits & 0x00000004u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteGroup(
-        8, _Internal::dosetemergencystop(this), target, stream);
-  }
+size_t TrainControlRequest_DoSubscribe::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlRequest.DoSubscribe)
+  size_t total_size = 0;
 
-  // optional group DoRpc = 16 { ... };
-  if (cached_has_bits & 0x00000008u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteGroup(
-        16, _Internal::dorpc(this), target, stream);
-  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // optional group DoPing = 21 { ... };
-  if (cached_has_bits & 0x00000010u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteGroup(
-        21, _Internal::doping(this), target, stream);
+  // optional uint64 resume_seq = 65;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_resume_seq());
   }
 
-  // optional group DoGetOrSetAddress = 23 { ... };
-  if (cached_has_bits & 0x00000020u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteGroup(
-        23, _Internal::dogetorsetaddress(this), target, stream);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
   }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
 
-  // optional group DoDropState = 25 { ... };
-  if (cached_has_bits & 0x00000040u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteGroup(
-        25, _Internal::dodropstate(this), target, stream);
+void TrainControlRequest_DoSubscribe::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlRequest.DoSubscribe)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TrainControlRequest_DoSubscribe* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlRequest_DoSubscribe>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlRequest.DoSubscribe)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlRequest.DoSubscribe)
+    MergeFrom(*source);
   }
+}
 
-  // optional group DoChangeSavedState = 26 { ... };
-  if (cached_has_bits & 0x00000080u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteGroup(
-        26, _Internal::dochangesavedstate(this), target, stream);
-  }
+void TrainControlRequest_DoSubscribe::MergeFrom(const TrainControlRequest_DoSubscribe& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlRequest.DoSubscribe)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
 
-  // optional group DoSendRawCanPacket = 32 { ... };
-  if (cached_has_bits & 0x00000100u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteGroup(
-        32, _Internal::dosendrawcanpacket(this), target, stream);
+  if (from._internal_has_resume_seq()) {
+    _internal_set_resume_seq(from._internal_resume_seq());
   }
+}
+
+void TrainControlRequest_DoSubscribe::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlRequest.DoSubscribe)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TrainControlRequest_DoSubscribe::CopyFrom(const TrainControlRequest_DoSubscribe& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlRequest.DoSubscribe)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TrainControlRequest_DoSubscribe::IsInitialized() const {
+  return true;
+}
+
+void TrainControlRequest_DoSubscribe::InternalSwap(TrainControlRequest_DoSubscribe* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(resume_seq_, other->resume_seq_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlRequest_DoSubscribe::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TrainControlRequest::InitAsDefaultInstance() {
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dosetspeed_ = const_cast< ::server::TrainControlRequest_DoSetSpeed*>(
+      ::server::TrainControlRequest_DoSetSpeed::internal_default_instance());
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dosetaccessory_ = const_cast< ::server::TrainControlRequest_DoSetAccessory*>(
+      ::server::TrainControlRequest_DoSetAccessory::internal_default_instance());
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dosetemergencystop_ = const_cast< ::server::TrainControlRequest_DoSetEmergencyStop*>(
+      ::server::TrainControlRequest_DoSetEmergencyStop::internal_default_instance());
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dorpc_ = const_cast< ::server::TrainControlRequest_DoRpc*>(
+      ::server::TrainControlRequest_DoRpc::internal_default_instance());
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->doping_ = const_cast< ::server::TrainControlRequest_DoPing*>(
+      ::server::TrainControlRequest_DoPing::internal_default_instance());
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dogetorsetaddress_ = const_cast< ::server::TrainControlRequest_DoGetOrSetAddress*>(
+      ::server::TrainControlRequest_DoGetOrSetAddress::internal_default_instance());
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dodropstate_ = const_cast< ::server::TrainControlRequest_DoDropState*>(
+      ::server::TrainControlRequest_DoDropState::internal_default_instance());
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dochangesavedstate_ = const_cast< ::server::TrainControlRequest_DoChangeSavedState*>(
+      ::server::TrainControlRequest_DoChangeSavedState::internal_default_instance());
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dosendrawcanpacket_ = const_cast< ::server::TrainControlRequest_DoSendRawCanPacket*>(
+      ::server::TrainControlRequest_DoSendRawCanPacket::internal_default_instance());
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->doreflashautomata_ = const_cast< ::server::TrainControlRequest_DoReflashAutomata*>(
+      ::server::TrainControlRequest_DoReflashAutomata::internal_default_instance());
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dogetlokdb_ = const_cast< ::server::TrainControlRequest_DoGetLokDb*>(
+      ::server::TrainControlRequest_DoGetLokDb::internal_default_instance());
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dogetlokstate_ = const_cast< ::server::TrainControlRequest_DoGetLokState*>(
+      ::server::TrainControlRequest_DoGetLokState::internal_default_instance());
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dosetlokstate_ = const_cast< ::server::LokStateProto*>(
+      ::server::LokStateProto::internal_default_instance());
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->doestoploco_ = const_cast< ::server::TrainControlRequest_DoEStopLoco*>(
+      ::server::TrainControlRequest_DoEStopLoco::internal_default_instance());
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dopicmisc_ = const_cast< ::server::TrainControlRequest_DoPicMisc*>(
+      ::server::TrainControlRequest_DoPicMisc::internal_default_instance());
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->doreflashpic_ = const_cast< ::server::TrainControlRequest_DoReflashPic*>(
+      ::server::TrainControlRequest_DoReflashPic::internal_default_instance());
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dogetorsetcv_ = const_cast< ::server::TrainControlRequest_DoGetOrSetCV*>(
+      ::server::TrainControlRequest_DoGetOrSetCV::internal_default_instance());
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dowaitforchange_ = const_cast< ::server::TrainControlRequest_DoWaitForChange*>(
+      ::server::TrainControlRequest_DoWaitForChange::internal_default_instance());
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dobatch_ = const_cast< ::server::TrainControlRequest_DoBatch*>(
+      ::server::TrainControlRequest_DoBatch::internal_default_instance());
+  ::server::_TrainControlRequest_default_instance_._instance.get_mutable()->dosubscribe_ = const_cast< ::server::TrainControlRequest_DoSubscribe*>(
+      ::server::TrainControlRequest_DoSubscribe::internal_default_instance());
+}
+class TrainControlRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TrainControlRequest>()._has_bits_);
+  static const ::server::TrainControlRequest_DoSetSpeed& dosetspeed(const TrainControlRequest* msg);
+  static void set_has_dosetspeed(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::server::TrainControlRequest_DoSetAccessory& dosetaccessory(const TrainControlRequest* msg);
+  static void set_has_dosetaccessory(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::server::TrainControlRequest_DoSetEmergencyStop& dosetemergencystop(const TrainControlRequest* msg);
+  static void set_has_dosetemergencystop(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::server::TrainControlRequest_DoRpc& dorpc(const TrainControlRequest* msg);
+  static void set_has_dorpc(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::server::TrainControlRequest_DoPing& doping(const TrainControlRequest* msg);
+  static void set_has_doping(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::server::TrainControlRequest_DoGetOrSetAddress& dogetorsetaddress(const TrainControlRequest* msg);
+  static void set_has_dogetorsetaddress(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::server::TrainControlRequest_DoDropState& dodropstate(const TrainControlRequest* msg);
+  static void set_has_dodropstate(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::server::TrainControlRequest_DoChangeSavedState& dochangesavedstate(const TrainControlRequest* msg);
+  static void set_has_dochangesavedstate(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static const ::server::TrainControlRequest_DoSendRawCanPacket& dosendrawcanpacket(const TrainControlRequest* msg);
+  static void set_has_dosendrawcanpacket(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::server::TrainControlRequest_DoReflashAutomata& doreflashautomata(const TrainControlRequest* msg);
+  static void set_has_doreflashautomata(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static const ::server::TrainControlRequest_DoGetLokDb& dogetlokdb(const TrainControlRequest* msg);
+  static void set_has_dogetlokdb(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static const ::server::TrainControlRequest_DoGetLokState& dogetlokstate(const TrainControlRequest* msg);
+  static void set_has_dogetlokstate(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static const ::server::LokStateProto& dosetlokstate(const TrainControlRequest* msg);
+  static void set_has_dosetlokstate(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static const ::server::TrainControlRequest_DoEStopLoco& doestoploco(const TrainControlRequest* msg);
+  static void set_has_doestoploco(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static const ::server::TrainControlRequest_DoPicMisc& dopicmisc(const TrainControlRequest* msg);
+  static void set_has_dopicmisc(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static const ::server::TrainControlRequest_DoReflashPic& doreflashpic(const TrainControlRequest* msg);
+  static void set_has_doreflashpic(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static const ::server::TrainControlRequest_DoGetOrSetCV& dogetorsetcv(const TrainControlRequest* msg);
+  static void set_has_dogetorsetcv(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+  static const ::server::TrainControlRequest_DoWaitForChange& dowaitforchange(const TrainControlRequest* msg);
+  static void set_has_dowaitforchange(HasBits* has_bits) {
+    (*has_bits)[0] |= 131072u;
+  }
+  static const ::server::TrainControlRequest_DoBatch& dobatch(const TrainControlRequest* msg);
+  static void set_has_dobatch(HasBits* has_bits) {
+    (*has_bits)[0] |= 262144u;
+  }
+  static const ::server::TrainControlRequest_DoSubscribe& dosubscribe(const TrainControlRequest* msg);
+  static void set_has_dosubscribe(HasBits* has_bits) {
+    (*has_bits)[0] |= 524288u;
+  }
+};
+
+const ::server::TrainControlRequest_DoSetSpeed&
+TrainControlRequest::_Internal::dosetspeed(const TrainControlRequest* msg) {
+  return *msg->dosetspeed_;
+}
+const ::server::TrainControlRequest_DoSetAccessory&
+TrainControlRequest::_Internal::dosetaccessory(const TrainControlRequest* msg) {
+  return *msg->dosetaccessory_;
+}
+const ::server::TrainControlRequest_DoSetEmergencyStop&
+TrainControlRequest::_Internal::dosetemergencystop(const TrainControlRequest* msg) {
+  return *msg->dosetemergencystop_;
+}
+const ::server::TrainControlRequest_DoRpc&
+TrainControlRequest::_Internal::dorpc(const TrainControlRequest* msg) {
+  return *msg->dorpc_;
+}
+const ::server::TrainControlRequest_DoPing&
+TrainControlRequest::_Internal::doping(const TrainControlRequest* msg) {
+  return *msg->doping_;
+}
+const ::server::TrainControlRequest_DoGetOrSetAddress&
+TrainControlRequest::_Internal::dogetorsetaddress(const TrainControlRequest* msg) {
+  return *msg->dogetorsetaddress_;
+}
+const ::server::TrainControlRequest_DoDropState&
+TrainControlRequest::_Internal::dodropstate(const TrainControlRequest* msg) {
+  return *msg->dodropstate_;
+}
+const ::server::TrainControlRequest_DoChangeSavedState&
+TrainControlRequest::_Internal::dochangesavedstate(const TrainControlRequest* msg) {
+  return *msg->dochangesavedstate_;
+}
+const ::server::TrainControlRequest_DoSendRawCanPacket&
+TrainControlRequest::_Internal::dosendrawcanpacket(const TrainControlRequest* msg) {
+  return *msg->dosendrawcanpacket_;
+}
+const ::server::TrainControlRequest_DoReflashAutomata&
+TrainControlRequest::_Internal::doreflashautomata(const TrainControlRequest* msg) {
+  return *msg->doreflashautomata_;
+}
+const ::server::TrainControlRequest_DoGetLokDb&
+TrainControlRequest::_Internal::dogetlokdb(const TrainControlRequest* msg) {
+  return *msg->dogetlokdb_;
+}
+const ::server::TrainControlRequest_DoGetLokState&
+TrainControlRequest::_Internal::dogetlokstate(const TrainControlRequest* msg) {
+  return *msg->dogetlokstate_;
+}
+const ::server::LokStateProto&
+TrainControlRequest::_Internal::dosetlokstate(const TrainControlRequest* msg) {
+  return *msg->dosetlokstate_;
+}
+const ::server::TrainControlRequest_DoEStopLoco&
+TrainControlRequest::_Internal::doestoploco(const TrainControlRequest* msg) {
+  return *msg->doestoploco_;
+}
+const ::server::TrainControlRequest_DoPicMisc&
+TrainControlRequest::_Internal::dopicmisc(const TrainControlRequest* msg) {
+  return *msg->dopicmisc_;
+}
+const ::server::TrainControlRequest_DoReflashPic&
+TrainControlRequest::_Internal::doreflashpic(const TrainControlRequest* msg) {
+  return *msg->doreflashpic_;
+}
+const ::server::TrainControlRequest_DoGetOrSetCV&
+TrainControlRequest::_Internal::dogetorsetcv(const TrainControlRequest* msg) {
+  return *msg->dogetorsetcv_;
+}
+const ::server::TrainControlRequest_DoWaitForChange&
+TrainControlRequest::_Internal::dowaitforchange(const TrainControlRequest* msg) {
+  return *msg->dowaitforchange_;
+}
+const ::server::TrainControlRequest_DoBatch&
+TrainControlRequest::_Internal::dobatch(const TrainControlRequest* msg) {
+  return *msg->dobatch_;
+}
+const ::server::TrainControlRequest_DoSubscribe&
+TrainControlRequest::_Internal::dosubscribe(const TrainControlRequest* msg) {
+  return *msg->dosubscribe_;
+}
+TrainControlRequest::TrainControlRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlRequest)
+}
+TrainControlRequest::TrainControlRequest(const TrainControlRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_dosetspeed()) {
+    dosetspeed_ = new ::server::TrainControlRequest_DoSetSpeed(*from.dosetspeed_);
+  } else {
+    dosetspeed_ = nullptr;
+  }
+  if (from._internal_has_dosetaccessory()) {
+    dosetaccessory_ = new ::server::TrainControlRequest_DoSetAccessory(*from.dosetaccessory_);
+  } else {
+    dosetaccessory_ = nullptr;
+  }
+  if (from._internal_has_dosetemergencystop()) {
+    dosetemergencystop_ = new ::server::TrainControlRequest_DoSetEmergencyStop(*from.dosetemergencystop_);
+  } else {
+    dosetemergencystop_ = nullptr;
+  }
+  if (from._internal_has_dorpc()) {
+    dorpc_ = new ::server::TrainControlRequest_DoRpc(*from.dorpc_);
+  } else {
+    dorpc_ = nullptr;
+  }
+  if (from._internal_has_doping()) {
+    doping_ = new ::server::TrainControlRequest_DoPing(*from.doping_);
+  } else {
+    doping_ = nullptr;
+  }
+  if (from._internal_has_dogetorsetaddress()) {
+    dogetorsetaddress_ = new ::server::TrainControlRequest_DoGetOrSetAddress(*from.dogetorsetaddress_);
+  } else {
+    dogetorsetaddress_ = nullptr;
+  }
+  if (from._internal_has_dodropstate()) {
+    dodropstate_ = new ::server::TrainControlRequest_DoDropState(*from.dodropstate_);
+  } else {
+    dodropstate_ = nullptr;
+  }
+  if (from._internal_has_dochangesavedstate()) {
+    dochangesavedstate_ = new ::server::TrainControlRequest_DoChangeSavedState(*from.dochangesavedstate_);
+  } else {
+    dochangesavedstate_ = nullptr;
+  }
+  if (from._internal_has_dosendrawcanpacket()) {
+    dosendrawcanpacket_ = new ::server::TrainControlRequest_DoSendRawCanPacket(*from.dosendrawcanpacket_);
+  } else {
+    dosendrawcanpacket_ = nullptr;
+  }
+  if (from._internal_has_doreflashautomata()) {
+    doreflashautomata_ = new ::server::TrainControlRequest_DoReflashAutomata(*from.doreflashautomata_);
+  } else {
+    doreflashautomata_ = nullptr;
+  }
+  if (from._internal_has_dogetlokdb()) {
+    dogetlokdb_ = new ::server::TrainControlRequest_DoGetLokDb(*from.dogetlokdb_);
+  } else {
+    dogetlokdb_ = nullptr;
+  }
+  if (from._internal_has_dogetlokstate()) {
+    dogetlokstate_ = new ::server::TrainControlRequest_DoGetLokState(*from.dogetlokstate_);
+  } else {
+    dogetlokstate_ = nullptr;
+  }
+  if (from._internal_has_dosetlokstate()) {
+    dosetlokstate_ = new ::server::LokStateProto(*from.dosetlokstate_);
+  } else {
+    dosetlokstate_ = nullptr;
+  }
+  if (from._internal_has_doestoploco()) {
+    doestoploco_ = new ::server::TrainControlRequest_DoEStopLoco(*from.doestoploco_);
+  } else {
+    doestoploco_ = nullptr;
+  }
+  if (from._internal_has_dopicmisc()) {
+    dopicmisc_ = new ::server::TrainControlRequest_DoPicMisc(*from.dopicmisc_);
+  } else {
+    dopicmisc_ = nullptr;
+  }
+  if (from._internal_has_doreflashpic()) {
+    doreflashpic_ = new ::server::TrainControlRequest_DoReflashPic(*from.doreflashpic_);
+  } else {
+    doreflashpic_ = nullptr;
+  }
+  if (from._internal_has_dogetorsetcv()) {
+    dogetorsetcv_ = new ::server::TrainControlRequest_DoGetOrSetCV(*from.dogetorsetcv_);
+  } else {
+    dogetorsetcv_ = nullptr;
+  }
+  if (from._internal_has_dowaitforchange()) {
+    dowaitforchange_ = new ::server::TrainControlRequest_DoWaitForChange(*from.dowaitforchange_);
+  } else {
+    dowaitforchange_ = nullptr;
+  }
+  if (from._internal_has_dobatch()) {
+    dobatch_ = new ::server::TrainControlRequest_DoBatch(*from.dobatch_);
+  } else {
+    dobatch_ = nullptr;
+  }
+  if (from._internal_has_dosubscribe()) {
+    dosubscribe_ = new ::server::TrainControlRequest_DoSubscribe(*from.dosubscribe_);
+  } else {
+    dosubscribe_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlRequest)
+}
+
+void TrainControlRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TrainControlRequest_train_5fcontrol_2eproto.base);
+  ::memset(&dosetspeed_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&dosubscribe_) -
+      reinterpret_cast<char*>(&dosetspeed_)) + sizeof(dosubscribe_));
+}
+
+TrainControlRequest::~TrainControlRequest() {
+  // @@protoc_insertion_point(destructor:server.TrainControlRequest)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TrainControlRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete dosetspeed_;
+  if (this != internal_default_instance()) delete dosetaccessory_;
+  if (this != internal_default_instance()) delete dosetemergencystop_;
+  if (this != internal_default_instance()) delete dorpc_;
+  if (this != internal_default_instance()) delete doping_;
+  if (this != internal_default_instance()) delete dogetorsetaddress_;
+  if (this != internal_default_instance()) delete dodropstate_;
+  if (this != internal_default_instance()) delete dochangesavedstate_;
+  if (this != internal_default_instance()) delete dosendrawcanpacket_;
+  if (this != internal_default_instance()) delete doreflashautomata_;
+  if (this != internal_default_instance()) delete dogetlokdb_;
+  if (this != internal_default_instance()) delete dogetlokstate_;
+  if (this != internal_default_instance()) delete dosetlokstate_;
+  if (this != internal_default_instance()) delete doestoploco_;
+  if (this != internal_default_instance()) delete dopicmisc_;
+  if (this != internal_default_instance()) delete doreflashpic_;
+  if (this != internal_default_instance()) delete dogetorsetcv_;
+  if (this != internal_default_instance()) delete dowaitforchange_;
+  if (this != internal_default_instance()) delete dobatch_;
+  if (this != internal_default_instance()) delete dosubscribe_;
+}
+
+void TrainControlRequest::ArenaDtor(void* object) {
+  TrainControlRequest* _this = reinterpret_cast< TrainControlRequest* >(object);
+  (void)_this;
+}
+void TrainControlRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TrainControlRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TrainControlRequest& TrainControlRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlRequest_train_5fcontrol_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TrainControlRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(dosetspeed_ != nullptr);
+      dosetspeed_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(dosetaccessory_ != nullptr);
+      dosetaccessory_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(dosetemergencystop_ != nullptr);
+      dosetemergencystop_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(dorpc_ != nullptr);
+      dorpc_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(doping_ != nullptr);
+      doping_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(dogetorsetaddress_ != nullptr);
+      dogetorsetaddress_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(dodropstate_ != nullptr);
+      dodropstate_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(dochangesavedstate_ != nullptr);
+      dochangesavedstate_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      GOOGLE_DCHECK(dosendrawcanpacket_ != nullptr);
+      dosendrawcanpacket_->Clear();
+    }
+    if (cached_has_bits & 0x00000200u) {
+      GOOGLE_DCHECK(doreflashautomata_ != nullptr);
+      doreflashautomata_->Clear();
+    }
+    if (cached_has_bits & 0x00000400u) {
+      GOOGLE_DCHECK(dogetlokdb_ != nullptr);
+      dogetlokdb_->Clear();
+    }
+    if (cached_has_bits & 0x00000800u) {
+      GOOGLE_DCHECK(dogetlokstate_ != nullptr);
+      dogetlokstate_->Clear();
+    }
+    if (cached_has_bits & 0x00001000u) {
+      GOOGLE_DCHECK(dosetlokstate_ != nullptr);
+      dosetlokstate_->Clear();
+    }
+    if (cached_has_bits & 0x00002000u) {
+      GOOGLE_DCHECK(doestoploco_ != nullptr);
+      doestoploco_->Clear();
+    }
+    if (cached_has_bits & 0x00004000u) {
+      GOOGLE_DCHECK(dopicmisc_ != nullptr);
+      dopicmisc_->Clear();
+    }
+    if (cached_has_bits & 0x00008000u) {
+      GOOGLE_DCHECK(doreflashpic_ != nullptr);
+      doreflashpic_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000f0000u) {
+    if (cached_has_bits & 0x00010000u) {
+      GOOGLE_DCHECK(dogetorsetcv_ != nullptr);
+      dogetorsetcv_->Clear();
+    }
+    if (cached_has_bits & 0x00020000u) {
+      GOOGLE_DCHECK(dowaitforchange_ != nullptr);
+      dowaitforchange_->Clear();
+    }
+    if (cached_has_bits & 0x00040000u) {
+      GOOGLE_DCHECK(dobatch_ != nullptr);
+      dobatch_->Clear();
+    }
+    if (cached_has_bits & 0x00080000u) {
+      GOOGLE_DCHECK(dosubscribe_ != nullptr);
+      dosubscribe_->Clear();
+    }
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TrainControlRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // optional group DoSetSpeed = 1 { ... };
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 11)) {
+          ptr = ctx->ParseGroup(_internal_mutable_dosetspeed(), ptr, 11);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group DoSetAccessory = 4 { ... };
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 35)) {
+          ptr = ctx->ParseGroup(_internal_mutable_dosetaccessory(), ptr, 35);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group DoSetEmergencyStop = 8 { ... };
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 67)) {
+          ptr = ctx->ParseGroup(_internal_mutable_dosetemergencystop(), ptr, 67);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group DoRpc = 16 { ... };
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 131)) {
+          ptr = ctx->ParseGroup(_internal_mutable_dorpc(), ptr, 131);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group DoPing = 21 { ... };
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 171)) {
+          ptr = ctx->ParseGroup(_internal_mutable_doping(), ptr, 171);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group DoGetOrSetAddress = 23 { ... };
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 187)) {
+          ptr = ctx->ParseGroup(_internal_mutable_dogetorsetaddress(), ptr, 187);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group DoDropState = 25 { ... };
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 203)) {
+          ptr = ctx->ParseGroup(_internal_mutable_dodropstate(), ptr, 203);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group DoChangeSavedState = 26 { ... };
+      case 26:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 211)) {
+          ptr = ctx->ParseGroup(_internal_mutable_dochangesavedstate(), ptr, 211);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group DoSendRawCanPacket = 32 { ... };
+      case 32:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 3)) {
+          ptr = ctx->ParseGroup(_internal_mutable_dosendrawcanpacket(), ptr, 259);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group DoReflashAutomata = 40 { ... };
+      case 40:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 67)) {
+          ptr = ctx->ParseGroup(_internal_mutable_doreflashautomata(), ptr, 323);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group DoGetLokDb = 41 { ... };
+      case 41:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 75)) {
+          ptr = ctx->ParseGroup(_internal_mutable_dogetlokdb(), ptr, 331);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group DoGetLokState = 42 { ... };
+      case 42:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 83)) {
+          ptr = ctx->ParseGroup(_internal_mutable_dogetlokstate(), ptr, 339);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional .server.LokStateProto DoSetLokState = 44;
+      case 44:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_dosetlokstate(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group DoEStopLoco = 45 { ... };
+      case 45:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 107)) {
+          ptr = ctx->ParseGroup(_internal_mutable_doestoploco(), ptr, 363);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group DoPicMisc = 47 { ... };
+      case 47:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 123)) {
+          ptr = ctx->ParseGroup(_internal_mutable_dopicmisc(), ptr, 379);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group DoReflashPic = 50 { ... };
+      case 50:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 147)) {
+          ptr = ctx->ParseGroup(_internal_mutable_doreflashpic(), ptr, 403);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group DoGetOrSetCV = 52 { ... };
+      case 52:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 163)) {
+          ptr = ctx->ParseGroup(_internal_mutable_dogetorsetcv(), ptr, 419);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group DoWaitForChange = 56 { ... };
+      case 56:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 195)) {
+          ptr = ctx->ParseGroup(_internal_mutable_dowaitforchange(), ptr, 451);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group DoBatch = 62 { ... };
+      case 62:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 243)) {
+          ptr = ctx->ParseGroup(_internal_mutable_dobatch(), ptr, 499);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional group DoSubscribe = 64 { ... };
+      case 64:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 3)) {
+          ptr = ctx->ParseGroup(_internal_mutable_dosubscribe(), ptr, 515);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlRequest::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional group DoSetSpeed = 1 { ... };
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        1, _Internal::dosetspeed(this), target, stream);
+  }
+
+  // optional group DoSetAccessory = 4 { ... };
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        4, _Internal::dosetaccessory(this), target, stream);
+  }
+
+  // optional group DoSetEmergencyStop = 8 { ... };
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        8, _Internal::dosetemergencystop(this), target, stream);
+  }
+
+  // optional group DoRpc = 16 { ... };
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        16, _Internal::dorpc(this), target, stream);
+  }
+
+  // optional group DoPing = 21 { ... };
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        21, _Internal::doping(this), target, stream);
+  }
+
+  // optional group DoGetOrSetAddress = 23 { ... };
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        23, _Internal::dogetorsetaddress(this), target, stream);
+  }
+
+  // optional group DoDropState = 25 { ... };
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        25, _Internal::dodropstate(this), target, stream);
+  }
+
+  // optional group DoChangeSavedState = 26 { ... };
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        26, _Internal::dochangesavedstate(this), target, stream);
+  }
+
+  // optional group DoSendRawCanPacket = 32 { ... };
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        32, _Internal::dosendrawcanpacket(this), target, stream);
+  }
+
+  // optional group DoReflashAutomata = 40 { ... };
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        40, _Internal::doreflashautomata(this), target, stream);
+  }
+
+  // optional group DoGetLokDb = 41 { ... };
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        41, _Internal::dogetlokdb(this), target, stream);
+  }
+
+  // optional group DoGetLokState = 42 { ... };
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        42, _Internal::dogetlokstate(this), target, stream);
+  }
+
+  // optional .server.LokStateProto DoSetLokState = 44;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        44, _Internal::dosetlokstate(this), target, stream);
+  }
+
+  // optional group DoEStopLoco = 45 { ... };
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        45, _Internal::doestoploco(this), target, stream);
+  }
+
+  // optional group DoPicMisc = 47 { ... };
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        47, _Internal::dopicmisc(this), target, stream);
+  }
+
+  // optional group DoReflashPic = 50 { ... };
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        50, _Internal::doreflashpic(this), target, stream);
+  }
+
+  // optional group DoGetOrSetCV = 52 { ... };
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        52, _Internal::dogetorsetcv(this), target, stream);
+  }
+
+  // optional group DoWaitForChange = 56 { ... };
+  if (cached_has_bits & 0x00020000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        56, _Internal::dowaitforchange(this), target, stream);
+  }
+
+  // optional group DoBatch = 62 { ... };
+  if (cached_has_bits & 0x00040000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        62, _Internal::dobatch(this), target, stream);
+  }
+
+  // optional group DoSubscribe = 64 { ... };
+  if (cached_has_bits & 0x00080000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        64, _Internal::dosubscribe(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlRequest)
+  return target;
+}
+
+size_t TrainControlRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlRequest)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional group DoSetSpeed = 1 { ... };
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *dosetspeed_);
+    }
+
+    // optional group DoSetAccessory = 4 { ... };
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *dosetaccessory_);
+    }
+
+    // optional group DoSetEmergencyStop = 8 { ... };
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *dosetemergencystop_);
+    }
+
+    // optional group DoRpc = 16 { ... };
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 4 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *dorpc_);
+    }
+
+    // optional group DoPing = 21 { ... };
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 4 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *doping_);
+    }
+
+    // optional group DoGetOrSetAddress = 23 { ... };
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 4 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *dogetorsetaddress_);
+    }
+
+    // optional group DoDropState = 25 { ... };
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 4 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *dodropstate_);
+    }
+
+    // optional group DoChangeSavedState = 26 { ... };
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 4 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *dochangesavedstate_);
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional group DoSendRawCanPacket = 32 { ... };
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 4 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *dosendrawcanpacket_);
+    }
+
+    // optional group DoReflashAutomata = 40 { ... };
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 4 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *doreflashautomata_);
+    }
+
+    // optional group DoGetLokDb = 41 { ... };
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 4 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *dogetlokdb_);
+    }
+
+    // optional group DoGetLokState = 42 { ... };
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 4 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *dogetlokstate_);
+    }
+
+    // optional .server.LokStateProto DoSetLokState = 44;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *dosetlokstate_);
+    }
+
+    // optional group DoEStopLoco = 45 { ... };
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 4 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *doestoploco_);
+    }
+
+    // optional group DoPicMisc = 47 { ... };
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 4 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *dopicmisc_);
+    }
+
+    // optional group DoReflashPic = 50 { ... };
+    if (cached_has_bits & 0x00008000u) {
+      total_size += 4 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *doreflashpic_);
+    }
+
+  }
+  if (cached_has_bits & 0x000f0000u) {
+    // optional group DoGetOrSetCV = 52 { ... };
+    if (cached_has_bits & 0x00010000u) {
+      total_size += 4 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *dogetorsetcv_);
+    }
+
+    // optional group DoWaitForChange = 56 { ... };
+    if (cached_has_bits & 0x00020000u) {
+      total_size += 4 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *dowaitforchange_);
+    }
+
+    // optional group DoBatch = 62 { ... };
+    if (cached_has_bits & 0x00040000u) {
+      total_size += 4 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *dobatch_);
+    }
+
+    // optional group DoSubscribe = 64 { ... };
+    if (cached_has_bits & 0x00080000u) {
+      total_size += 4 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *dosubscribe_);
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TrainControlRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TrainControlRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlRequest>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlRequest)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlRequest)
+    MergeFrom(*source);
+  }
+}
+
+void TrainControlRequest::MergeFrom(const TrainControlRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _internal_mutable_dosetspeed()->::server::TrainControlRequest_DoSetSpeed::MergeFrom(from._internal_dosetspeed());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _internal_mutable_dosetaccessory()->::server::TrainControlRequest_DoSetAccessory::MergeFrom(from._internal_dosetaccessory());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _internal_mutable_dosetemergencystop()->::server::TrainControlRequest_DoSetEmergencyStop::MergeFrom(from._internal_dosetemergencystop());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _internal_mutable_dorpc()->::server::TrainControlRequest_DoRpc::MergeFrom(from._internal_dorpc());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _internal_mutable_doping()->::server::TrainControlRequest_DoPing::MergeFrom(from._internal_doping());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _internal_mutable_dogetorsetaddress()->::server::TrainControlRequest_DoGetOrSetAddress::MergeFrom(from._internal_dogetorsetaddress());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _internal_mutable_dodropstate()->::server::TrainControlRequest_DoDropState::MergeFrom(from._internal_dodropstate());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _internal_mutable_dochangesavedstate()->::server::TrainControlRequest_DoChangeSavedState::MergeFrom(from._internal_dochangesavedstate());
+    }
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _internal_mutable_dosendrawcanpacket()->::server::TrainControlRequest_DoSendRawCanPacket::MergeFrom(from._internal_dosendrawcanpacket());
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _internal_mutable_doreflashautomata()->::server::TrainControlRequest_DoReflashAutomata::MergeFrom(from._internal_doreflashautomata());
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _internal_mutable_dogetlokdb()->::server::TrainControlRequest_DoGetLokDb::MergeFrom(from._internal_dogetlokdb());
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _internal_mutable_dogetlokstate()->::server::TrainControlRequest_DoGetLokState::MergeFrom(from._internal_dogetlokstate());
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _internal_mutable_dosetlokstate()->::server::LokStateProto::MergeFrom(from._internal_dosetlokstate());
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _internal_mutable_doestoploco()->::server::TrainControlRequest_DoEStopLoco::MergeFrom(from._internal_doestoploco());
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _internal_mutable_dopicmisc()->::server::TrainControlRequest_DoPicMisc::MergeFrom(from._internal_dopicmisc());
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _internal_mutable_doreflashpic()->::server::TrainControlRequest_DoReflashPic::MergeFrom(from._internal_doreflashpic());
+    }
+  }
+  if (cached_has_bits & 0x000f0000u) {
+    if (cached_has_bits & 0x00010000u) {
+      _internal_mutable_dogetorsetcv()->::server::TrainControlRequest_DoGetOrSetCV::MergeFrom(from._internal_dogetorsetcv());
+    }
+    if (cached_has_bits & 0x00020000u) {
+      _internal_mutable_dowaitforchange()->::server::TrainControlRequest_DoWaitForChange::MergeFrom(from._internal_dowaitforchange());
+    }
+    if (cached_has_bits & 0x00040000u) {
+      _internal_mutable_dobatch()->::server::TrainControlRequest_DoBatch::MergeFrom(from._internal_dobatch());
+    }
+    if (cached_has_bits & 0x00080000u) {
+      _internal_mutable_dosubscribe()->::server::TrainControlRequest_DoSubscribe::MergeFrom(from._internal_dosubscribe());
+    }
+  }
+}
+
+void TrainControlRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TrainControlRequest::CopyFrom(const TrainControlRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TrainControlRequest::IsInitialized() const {
+  if (_internal_has_dosetspeed()) {
+    if (!dosetspeed_->IsInitialized()) return false;
+  }
+  if (_internal_has_dosetaccessory()) {
+    if (!dosetaccessory_->IsInitialized()) return false;
+  }
+  if (_internal_has_dorpc()) {
+    if (!dorpc_->IsInitialized()) return false;
+  }
+  if (_internal_has_dochangesavedstate()) {
+    if (!dochangesavedstate_->IsInitialized()) return false;
+  }
+  if (_internal_has_doreflashautomata()) {
+    if (!doreflashautomata_->IsInitialized()) return false;
+  }
+  if (_internal_has_dosetlokstate()) {
+    if (!dosetlokstate_->IsInitialized()) return false;
+  }
+  if (_internal_has_doestoploco()) {
+    if (!doestoploco_->IsInitialized()) return false;
+  }
+  if (_internal_has_dopicmisc()) {
+    if (!dopicmisc_->IsInitialized()) return false;
+  }
+  if (_internal_has_dogetorsetcv()) {
+    if (!dogetorsetcv_->IsInitialized()) return false;
+  }
+  if (_internal_has_dowaitforchange()) {
+    if (!dowaitforchange_->IsInitialized()) return false;
+  }
+  if (_internal_has_dobatch()) {
+    if (!dobatch_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void TrainControlRequest::InternalSwap(TrainControlRequest* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TrainControlRequest, dosubscribe_)
+      + sizeof(TrainControlRequest::dosubscribe_)
+      - PROTOBUF_FIELD_OFFSET(TrainControlRequest, dosetspeed_)>(
+          reinterpret_cast<char*>(&dosetspeed_),
+          reinterpret_cast<char*>(&other->dosetspeed_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlRequest::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TrainControlResponse_Speed::InitAsDefaultInstance() {
+}
+class TrainControlResponse_Speed::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TrainControlResponse_Speed>()._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_dir(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_speed(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_timestamp(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+TrainControlResponse_Speed::TrainControlResponse_Speed(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.Speed)
+}
+TrainControlResponse_Speed::TrainControlResponse_Speed(const TrainControlResponse_Speed& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&id_, &from.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&dir_) -
+    reinterpret_cast<char*>(&id_)) + sizeof(dir_));
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.Speed)
+}
+
+void TrainControlResponse_Speed::SharedCtor() {
+  ::memset(&id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&timestamp_) -
+      reinterpret_cast<char*>(&id_)) + sizeof(timestamp_));
+  dir_ = 1;
+}
+
+TrainControlResponse_Speed::~TrainControlResponse_Speed() {
+  // @@protoc_insertion_point(destructor:server.TrainControlResponse.Speed)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TrainControlResponse_Speed::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TrainControlResponse_Speed::ArenaDtor(void* object) {
+  TrainControlResponse_Speed* _this = reinterpret_cast< TrainControlResponse_Speed* >(object);
+  (void)_this;
+}
+void TrainControlResponse_Speed::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TrainControlResponse_Speed::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TrainControlResponse_Speed& TrainControlResponse_Speed::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_Speed_train_5fcontrol_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TrainControlResponse_Speed::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.Speed)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&timestamp_) -
+        reinterpret_cast<char*>(&id_)) + sizeof(timestamp_));
+    dir_ = 1;
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TrainControlResponse_Speed::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // required int32 id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          _Internal::set_has_id(&has_bits);
+          id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // required int32 speed = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          _Internal::set_has_speed(&has_bits);
+          speed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional int32 dir = 25 [default = 1];
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 200)) {
+          _Internal::set_has_dir(&has_bits);
+          dir_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional uint64 timestamp = 50;
+      case 50:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 144)) {
+          _Internal::set_has_timestamp(&has_bits);
+          timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_Speed::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.Speed)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // required int32 id = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_id(), target);
+  }
+
+  // required int32 speed = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_speed(), target);
+  }
+
+  // optional int32 dir = 25 [default = 1];
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(25, this->_internal_dir(), target);
+  }
+
+  // optional uint64 timestamp = 50;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(50, this->_internal_timestamp(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.Speed)
+  return target;
+}
 
-  // optional group DoReflashAutomata = 40 { ... };
-  if (cached_has_bits & 0x00000200u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteGroup(
-        40, _Internal::doreflashautomata(this), target, stream);
+size_t TrainControlResponse_Speed::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:server.TrainControlResponse.Speed)
+  size_t total_size = 0;
+
+  if (_internal_has_id()) {
+    // required int32 id = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_id());
   }
 
-  // optional group DoGetLokDb = 41 { ... };
-  if (cached_has_bits & 0x00000400u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteGroup(
-        41, _Internal::dogetlokdb(this), target, stream);
+  if (_internal_has_speed()) {
+    // required int32 speed = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_speed());
   }
 
-  // optional group DoGetLokState = 42 { ... };
-  if (cached_has_bits & 0x00000800u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteGroup(
-        42, _Internal::dogetlokstate(this), target, stream);
+  return total_size;
+}
+size_t TrainControlResponse_Speed::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.Speed)
+  size_t total_size = 0;
+
+  if (((_has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required int32 id = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_id());
+
+    // required int32 speed = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_speed());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // optional .server.LokStateProto DoSetLokState = 44;
-  if (cached_has_bits & 0x00001000u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        44, _Internal::dosetlokstate(this), target, stream);
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x0000000cu) {
+    // optional uint64 timestamp = 50;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+          this->_internal_timestamp());
+    }
+
+    // optional int32 dir = 25 [default = 1];
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_dir());
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TrainControlResponse_Speed::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.Speed)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TrainControlResponse_Speed* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_Speed>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.Speed)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.Speed)
+    MergeFrom(*source);
+  }
+}
+
+void TrainControlResponse_Speed::MergeFrom(const TrainControlResponse_Speed& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.Speed)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      id_ = from.id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      speed_ = from.speed_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      timestamp_ = from.timestamp_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      dir_ = from.dir_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void TrainControlResponse_Speed::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.Speed)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TrainControlResponse_Speed::CopyFrom(const TrainControlResponse_Speed& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.Speed)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TrainControlResponse_Speed::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
+  return true;
+}
+
+void TrainControlResponse_Speed::InternalSwap(TrainControlResponse_Speed* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TrainControlResponse_Speed, timestamp_)
+      + sizeof(TrainControlResponse_Speed::timestamp_)
+      - PROTOBUF_FIELD_OFFSET(TrainControlResponse_Speed, id_)>(
+          reinterpret_cast<char*>(&id_),
+          reinterpret_cast<char*>(&other->id_));
+  swap(dir_, other->dir_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_Speed::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TrainControlResponse_Accessory::InitAsDefaultInstance() {
+}
+class TrainControlResponse_Accessory::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TrainControlResponse_Accessory>()._has_bits_);
+  static void set_has_train_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_accessory_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_timestamp(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+TrainControlResponse_Accessory::TrainControlResponse_Accessory(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.Accessory)
+}
+TrainControlResponse_Accessory::TrainControlResponse_Accessory(const TrainControlResponse_Accessory& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&value_, &from.value_,
+    static_cast<size_t>(reinterpret_cast<char*>(&timestamp_) -
+    reinterpret_cast<char*>(&value_)) + sizeof(timestamp_));
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.Accessory)
+}
+
+void TrainControlResponse_Accessory::SharedCtor() {
+  ::memset(&value_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&timestamp_) -
+      reinterpret_cast<char*>(&value_)) + sizeof(timestamp_));
+}
+
+TrainControlResponse_Accessory::~TrainControlResponse_Accessory() {
+  // @@protoc_insertion_point(destructor:server.TrainControlResponse.Accessory)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void TrainControlResponse_Accessory::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void TrainControlResponse_Accessory::ArenaDtor(void* object) {
+  TrainControlResponse_Accessory* _this = reinterpret_cast< TrainControlResponse_Accessory* >(object);
+  (void)_this;
+}
+void TrainControlResponse_Accessory::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void TrainControlResponse_Accessory::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TrainControlResponse_Accessory& TrainControlResponse_Accessory::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_Accessory_train_5fcontrol_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TrainControlResponse_Accessory::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.Accessory)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&value_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&timestamp_) -
+        reinterpret_cast<char*>(&value_)) + sizeof(timestamp_));
   }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TrainControlResponse_Accessory::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // required int32 train_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
+          _Internal::set_has_train_id(&has_bits);
+          train_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // required int32 accessory_id = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
+          _Internal::set_has_accessory_id(&has_bits);
+          accessory_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // required int32 value = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
+          _Internal::set_has_value(&has_bits);
+          value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional uint64 timestamp = 51;
+      case 51:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 152)) {
+          _Internal::set_has_timestamp(&has_bits);
+          timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
 
-  // optional group DoEStopLoco = 45 { ... };
-  if (cached_has_bits & 0x00002000u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteGroup(
-        45, _Internal::doestoploco(this), target, stream);
-  }
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_Accessory::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.Accessory)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
 
-  // optional group DoPicMisc = 47 { ... };
-  if (cached_has_bits & 0x00004000u) {
+  cached_has_bits = _has_bits_[0];
+  // required int32 train_id = 5;
+  if (cached_has_bits & 0x00000002u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteGroup(
-        47, _Internal::dopicmisc(this), target, stream);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(5, this->_internal_train_id(), target);
   }
 
-  // optional group DoReflashPic = 50 { ... };
-  if (cached_has_bits & 0x00008000u) {
+  // required int32 accessory_id = 6;
+  if (cached_has_bits & 0x00000004u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteGroup(
-        50, _Internal::doreflashpic(this), target, stream);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(6, this->_internal_accessory_id(), target);
   }
 
-  // optional group DoGetOrSetCV = 52 { ... };
-  if (cached_has_bits & 0x00010000u) {
+  // required int32 value = 7;
+  if (cached_has_bits & 0x00000001u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteGroup(
-        52, _Internal::dogetorsetcv(this), target, stream);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(7, this->_internal_value(), target);
   }
 
-  // optional group DoWaitForChange = 56 { ... };
-  if (cached_has_bits & 0x00020000u) {
+  // optional uint64 timestamp = 51;
+  if (cached_has_bits & 0x00000008u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteGroup(
-        56, _Internal::dowaitforchange(this), target, stream);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(51, this->_internal_timestamp(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.Accessory)
   return target;
 }
 
-size_t TrainControlRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:server.TrainControlRequest)
+size_t TrainControlResponse_Accessory::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:server.TrainControlResponse.Accessory)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x000000ffu) {
-    // optional group DoSetSpeed = 1 { ... };
-    if (cached_has_bits & 0x00000001u) {
-      total_size += 2 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
-          *dosetspeed_);
-    }
-
-    // optional group DoSetAccessory = 4 { ... };
-    if (cached_has_bits & 0x00000002u) {
-      total_size += 2 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
-          *dosetaccessory_);
-    }
-
-    // optional group DoSetEmergencyStop = 8 { ... };
-    if (cached_has_bits & 0x00000004u) {
-      total_size += 2 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
-          *dosetemergencystop_);
-    }
-
-    // optional group DoRpc = 16 { ... };
-    if (cached_has_bits & 0x00000008u) {
-      total_size += 4 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
-          *dorpc_);
-    }
-
-    // optional group DoPing = 21 { ... };
-    if (cached_has_bits & 0x00000010u) {
-      total_size += 4 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
-          *doping_);
-    }
-
-    // optional group DoGetOrSetAddress = 23 { ... };
-    if (cached_has_bits & 0x00000020u) {
-      total_size += 4 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
-          *dogetorsetaddress_);
-    }
-
-    // optional group DoDropState = 25 { ... };
-    if (cached_has_bits & 0x00000040u) {
-      total_size += 4 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
-          *dodropstate_);
-    }
-
-    // optional group DoChangeSavedState = 26 { ... };
-    if (cached_has_bits & 0x00000080u) {
-      total_size += 4 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
-          *dochangesavedstate_);
-    }
-
+  if (_internal_has_value()) {
+    // required int32 value = 7;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_value());
   }
-  if (cached_has_bits & 0x0000ff00u) {
-    // optional group DoSendRawCanPacket = 32 { ... };
-    if (cached_has_bits & 0x00000100u) {
-      total_size += 4 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
-          *dosendrawcanpacket_);
-    }
 
-    // optional group DoReflashAutomata = 40 { ... };
-    if (cached_has_bits & 0x00000200u) {
-      total_size += 4 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
-          *doreflashautomata_);
-    }
-
-    // optional group DoGetLokDb = 41 { ... };
-    if (cached_has_bits & 0x00000400u) {
-      total_size += 4 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
-          *dogetlokdb_);
-    }
+  if (_internal_has_train_id()) {
+    // required int32 train_id = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_train_id());
+  }
 
-    // optional group DoGetLokState = 42 { ... };
-    if (cached_has_bits & 0x00000800u) {
-      total_size += 4 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
-          *dogetlokstate_);
-    }
+  if (_internal_has_accessory_id()) {
+    // required int32 accessory_id = 6;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_accessory_id());
+  }
 
-    // optional .server.LokStateProto DoSetLokState = 44;
-    if (cached_has_bits & 0x00001000u) {
-      total_size += 2 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *dosetlokstate_);
-    }
+  return total_size;
+}
+size_t TrainControlResponse_Accessory::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.Accessory)
+  size_t total_size = 0;
 
-    // optional group DoEStopLoco = 45 { ... };
-    if (cached_has_bits & 0x00002000u) {
-      total_size += 4 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
-          *doestoploco_);
-    }
+  if (((_has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required int32 value = 7;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_value());
 
-    // optional group DoPicMisc = 47 { ... };
-    if (cached_has_bits & 0x00004000u) {
-      total_size += 4 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
-          *dopicmisc_);
-    }
+    // required int32 train_id = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_train_id());
 
-    // optional group DoReflashPic = 50 { ... };
-    if (cached_has_bits & 0x00008000u) {
-      total_size += 4 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
-          *doreflashpic_);
-    }
+    // required int32 accessory_id = 6;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_accessory_id());
 
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
   }
-  if (cached_has_bits & 0x00030000u) {
-    // optional group DoGetOrSetCV = 52 { ... };
-    if (cached_has_bits & 0x00010000u) {
-      total_size += 4 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
-          *dogetorsetcv_);
-    }
-
-    // optional group DoWaitForChange = 56 { ... };
-    if (cached_has_bits & 0x00020000u) {
-      total_size += 4 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
-          *dowaitforchange_);
-    }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
+  // optional uint64 timestamp = 51;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000008u) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_timestamp());
   }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -7329,283 +8715,165 @@ size_t TrainControlRequest::ByteSizeLong() const {
   return total_size;
 }
 
-void TrainControlRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlRequest)
+void TrainControlResponse_Accessory::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.Accessory)
   GOOGLE_DCHECK_NE(&from, this);
-  const TrainControlRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlRequest>(
+  const TrainControlResponse_Accessory* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_Accessory>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.Accessory)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlRequest)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.Accessory)
     MergeFrom(*source);
   }
 }
 
-void TrainControlRequest::MergeFrom(const TrainControlRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlRequest)
+void TrainControlResponse_Accessory::MergeFrom(const TrainControlResponse_Accessory& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.Accessory)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = from._has_bits_[0];
-  if (cached_has_bits & 0x000000ffu) {
+  if (cached_has_bits & 0x0000000fu) {
     if (cached_has_bits & 0x00000001u) {
-      _internal_mutable_dosetspeed()->::server::TrainControlRequest_DoSetSpeed::MergeFrom(from._internal_dosetspeed());
+      value_ = from.value_;
     }
     if (cached_has_bits & 0x00000002u) {
-      _internal_mutable_dosetaccessory()->::server::TrainControlRequest_DoSetAccessory::MergeFrom(from._internal_dosetaccessory());
+      train_id_ = from.train_id_;
     }
     if (cached_has_bits & 0x00000004u) {
-      _internal_mutable_dosetemergencystop()->::server::TrainControlRequest_DoSetEmergencyStop::MergeFrom(from._internal_dosetemergencystop());
+      accessory_id_ = from.accessory_id_;
     }
     if (cached_has_bits & 0x00000008u) {
-      _internal_mutable_dorpc()->::server::TrainControlRequest_DoRpc::MergeFrom(from._internal_dorpc());
-    }
-    if (cached_has_bits & 0x00000010u) {
-      _internal_mutable_doping()->::server::TrainControlRequest_DoPing::MergeFrom(from._internal_doping());
-    }
-    if (cached_has_bits & 0x00000020u) {
-      _internal_mutable_dogetorsetaddress()->::server::TrainControlRequest_DoGetOrSetAddress::MergeFrom(from._internal_dogetorsetaddress());
-    }
-    if (cached_has_bits & 0x00000040u) {
-      _internal_mutable_dodropstate()->::server::TrainControlRequest_DoDropState::MergeFrom(from._internal_dodropstate());
-    }
-    if (cached_has_bits & 0x00000080u) {
-      _internal_mutable_dochangesavedstate()->::server::TrainControlRequest_DoChangeSavedState::MergeFrom(from._internal_dochangesavedstate());
-    }
-  }
-  if (cached_has_bits & 0x0000ff00u) {
-    if (cached_has_bits & 0x00000100u) {
-      _internal_mutable_dosendrawcanpacket()->::server::TrainControlRequest_DoSendRawCanPacket::MergeFrom(from._internal_dosendrawcanpacket());
-    }
-    if (cached_has_bits & 0x00000200u) {
-      _internal_mutable_doreflashautomata()->::server::TrainControlRequest_DoReflashAutomata::MergeFrom(from._internal_doreflashautomata());
-    }
-    if (cached_has_bits & 0x00000400u) {
-      _internal_mutable_dogetlokdb()->::server::TrainControlRequest_DoGetLokDb::MergeFrom(from._internal_dogetlokdb());
-    }
-    if (cached_has_bits & 0x00000800u) {
-      _internal_mutable_dogetlokstate()->::server::TrainControlRequest_DoGetLokState::MergeFrom(from._internal_dogetlokstate());
-    }
-    if (cached_has_bits & 0x00001000u) {
-      _internal_mutable_dosetlokstate()->::server::LokStateProto::MergeFrom(from._internal_dosetlokstate());
-    }
-    if (cached_has_bits & 0x00002000u) {
-      _internal_mutable_doestoploco()->::server::TrainControlRequest_DoEStopLoco::MergeFrom(from._internal_doestoploco());
-    }
-    if (cached_has_bits & 0x00004000u) {
-      _internal_mutable_dopicmisc()->::server::TrainControlRequest_DoPicMisc::MergeFrom(from._internal_dopicmisc());
-    }
-    if (cached_has_bits & 0x00008000u) {
-      _internal_mutable_doreflashpic()->::server::TrainControlRequest_DoReflashPic::MergeFrom(from._internal_doreflashpic());
-    }
-  }
-  if (cached_has_bits & 0x00030000u) {
-    if (cached_has_bits & 0x00010000u) {
-      _internal_mutable_dogetorsetcv()->::server::TrainControlRequest_DoGetOrSetCV::MergeFrom(from._internal_dogetorsetcv());
-    }
-    if (cached_has_bits & 0x00020000u) {
-      _internal_mutable_dowaitforchange()->::server::TrainControlRequest_DoWaitForChange::MergeFrom(from._internal_dowaitforchange());
+      timestamp_ = from.timestamp_;
     }
+    _has_bits_[0] |= cached_has_bits;
   }
 }
 
-void TrainControlRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlRequest)
+void TrainControlResponse_Accessory::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.Accessory)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void TrainControlRequest::CopyFrom(const TrainControlRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlRequest)
+void TrainControlResponse_Accessory::CopyFrom(const TrainControlResponse_Accessory& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.Accessory)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TrainControlRequest::IsInitialized() const {
-  if (_internal_has_dosetspeed()) {
-    if (!dosetspeed_->IsInitialized()) return false;
-  }
-  if (_internal_has_dosetaccessory()) {
-    if (!dosetaccessory_->IsInitialized()) return false;
-  }
-  if (_internal_has_dorpc()) {
-    if (!dorpc_->IsInitialized()) return false;
-  }
-  if (_internal_has_dochangesavedstate()) {
-    if (!dochangesavedstate_->IsInitialized()) return false;
-  }
-  if (_internal_has_doreflashautomata()) {
-    if (!doreflashautomata_->IsInitialized()) return false;
-  }
-  if (_internal_has_dosetlokstate()) {
-    if (!dosetlokstate_->IsInitialized()) return false;
-  }
-  if (_internal_has_doestoploco()) {
-    if (!doestoploco_->IsInitialized()) return false;
-  }
-  if (_internal_has_dopicmisc()) {
-    if (!dopicmisc_->IsInitialized()) return false;
-  }
-  if (_internal_has_dogetorsetcv()) {
-    if (!dogetorsetcv_->IsInitialized()) return false;
-  }
-  if (_internal_has_dowaitforchange()) {
-    if (!dowaitforchange_->IsInitialized()) return false;
-  }
+bool TrainControlResponse_Accessory::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
   return true;
 }
 
-void TrainControlRequest::InternalSwap(TrainControlRequest* other) {
+void TrainControlResponse_Accessory::InternalSwap(TrainControlResponse_Accessory* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   swap(_has_bits_[0], other->_has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TrainControlRequest, dowaitforchange_)
-      + sizeof(TrainControlRequest::dowaitforchange_)
-      - PROTOBUF_FIELD_OFFSET(TrainControlRequest, dosetspeed_)>(
-          reinterpret_cast<char*>(&dosetspeed_),
-          reinterpret_cast<char*>(&other->dosetspeed_));
+      PROTOBUF_FIELD_OFFSET(TrainControlResponse_Accessory, timestamp_)
+      + sizeof(TrainControlResponse_Accessory::timestamp_)
+      - PROTOBUF_FIELD_OFFSET(TrainControlResponse_Accessory, value_)>(
+          reinterpret_cast<char*>(&value_),
+          reinterpret_cast<char*>(&other->value_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TrainControlRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_Accessory::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void TrainControlResponse_Speed::InitAsDefaultInstance() {
+void TrainControlResponse_EmergencyStop::InitAsDefaultInstance() {
 }
-class TrainControlResponse_Speed::_Internal {
+class TrainControlResponse_EmergencyStop::_Internal {
  public:
-  using HasBits = decltype(std::declval<TrainControlResponse_Speed>()._has_bits_);
-  static void set_has_id(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<TrainControlResponse_EmergencyStop>()._has_bits_);
+  static void set_has_stop(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
-  static void set_has_dir(HasBits* has_bits) {
-    (*has_bits)[0] |= 8u;
-  }
-  static void set_has_speed(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
-  }
-  static void set_has_timestamp(HasBits* has_bits) {
-    (*has_bits)[0] |= 4u;
-  }
   static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
   }
 };
 
-TrainControlResponse_Speed::TrainControlResponse_Speed(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+TrainControlResponse_EmergencyStop::TrainControlResponse_EmergencyStop(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.Speed)
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.EmergencyStop)
 }
-TrainControlResponse_Speed::TrainControlResponse_Speed(const TrainControlResponse_Speed& from)
+TrainControlResponse_EmergencyStop::TrainControlResponse_EmergencyStop(const TrainControlResponse_EmergencyStop& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
       _has_bits_(from._has_bits_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&id_, &from.id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&dir_) -
-    reinterpret_cast<char*>(&id_)) + sizeof(dir_));
-  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.Speed)
+  stop_ = from.stop_;
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.EmergencyStop)
 }
 
-void TrainControlResponse_Speed::SharedCtor() {
-  ::memset(&id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&timestamp_) -
-      reinterpret_cast<char*>(&id_)) + sizeof(timestamp_));
-  dir_ = 1;
+void TrainControlResponse_EmergencyStop::SharedCtor() {
+  stop_ = false;
 }
 
-TrainControlResponse_Speed::~TrainControlResponse_Speed() {
-  // @@protoc_insertion_point(destructor:server.TrainControlResponse.Speed)
+TrainControlResponse_EmergencyStop::~TrainControlResponse_EmergencyStop() {
+  // @@protoc_insertion_point(destructor:server.TrainControlResponse.EmergencyStop)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void TrainControlResponse_Speed::SharedDtor() {
+void TrainControlResponse_EmergencyStop::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
 }
 
-void TrainControlResponse_Speed::ArenaDtor(void* object) {
-  TrainControlResponse_Speed* _this = reinterpret_cast< TrainControlResponse_Speed* >(object);
+void TrainControlResponse_EmergencyStop::ArenaDtor(void* object) {
+  TrainControlResponse_EmergencyStop* _this = reinterpret_cast< TrainControlResponse_EmergencyStop* >(object);
   (void)_this;
 }
-void TrainControlResponse_Speed::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void TrainControlResponse_EmergencyStop::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void TrainControlResponse_Speed::SetCachedSize(int size) const {
+void TrainControlResponse_EmergencyStop::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const TrainControlResponse_Speed& TrainControlResponse_Speed::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_Speed_train_5fcontrol_2eproto.base);
+const TrainControlResponse_EmergencyStop& TrainControlResponse_EmergencyStop::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_EmergencyStop_train_5fcontrol_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void TrainControlResponse_Speed::Clear() {
-// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.Speed)
+void TrainControlResponse_EmergencyStop::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.EmergencyStop)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
-    ::memset(&id_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&timestamp_) -
-        reinterpret_cast<char*>(&id_)) + sizeof(timestamp_));
-    dir_ = 1;
-  }
+  stop_ = false;
   _has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TrainControlResponse_Speed::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TrainControlResponse_EmergencyStop::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // required int32 id = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          _Internal::set_has_id(&has_bits);
-          id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // required int32 speed = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          _Internal::set_has_speed(&has_bits);
-          speed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional int32 dir = 25 [default = 1];
-      case 25:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 200)) {
-          _Internal::set_has_dir(&has_bits);
-          dir_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional uint64 timestamp = 50;
-      case 50:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 144)) {
-          _Internal::set_has_timestamp(&has_bits);
-          timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // required bool stop = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 72)) {
+          _Internal::set_has_stop(&has_bits);
+          stop_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
@@ -7632,104 +8900,39 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_Speed::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_EmergencyStop::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.Speed)
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.EmergencyStop)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  // required int32 id = 2;
+  // required bool stop = 9;
   if (cached_has_bits & 0x00000001u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_id(), target);
-  }
-
-  // required int32 speed = 3;
-  if (cached_has_bits & 0x00000002u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_speed(), target);
-  }
-
-  // optional int32 dir = 25 [default = 1];
-  if (cached_has_bits & 0x00000008u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(25, this->_internal_dir(), target);
-  }
-
-  // optional uint64 timestamp = 50;
-  if (cached_has_bits & 0x00000004u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(50, this->_internal_timestamp(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(9, this->_internal_stop(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.Speed)
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.EmergencyStop)
   return target;
 }
 
-size_t TrainControlResponse_Speed::RequiredFieldsByteSizeFallback() const {
-// @@protoc_insertion_point(required_fields_byte_size_fallback_start:server.TrainControlResponse.Speed)
-  size_t total_size = 0;
-
-  if (_internal_has_id()) {
-    // required int32 id = 2;
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_id());
-  }
-
-  if (_internal_has_speed()) {
-    // required int32 speed = 3;
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_speed());
-  }
-
-  return total_size;
-}
-size_t TrainControlResponse_Speed::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.Speed)
+size_t TrainControlResponse_EmergencyStop::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.EmergencyStop)
   size_t total_size = 0;
 
-  if (((_has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
-    // required int32 id = 2;
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_id());
-
-    // required int32 speed = 3;
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_speed());
-
-  } else {
-    total_size += RequiredFieldsByteSizeFallback();
+  // required bool stop = 9;
+  if (_internal_has_stop()) {
+    total_size += 1 + 1;
   }
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x0000000cu) {
-    // optional uint64 timestamp = 50;
-    if (cached_has_bits & 0x00000004u) {
-      total_size += 2 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-          this->_internal_timestamp());
-    }
-
-    // optional int32 dir = 25 [default = 1];
-    if (cached_has_bits & 0x00000008u) {
-      total_size += 2 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-          this->_internal_dir());
-    }
-
-  }
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -7739,208 +8942,167 @@ size_t TrainControlResponse_Speed::ByteSizeLong() const {
   return total_size;
 }
 
-void TrainControlResponse_Speed::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.Speed)
+void TrainControlResponse_EmergencyStop::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.EmergencyStop)
   GOOGLE_DCHECK_NE(&from, this);
-  const TrainControlResponse_Speed* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_Speed>(
+  const TrainControlResponse_EmergencyStop* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_EmergencyStop>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.Speed)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.EmergencyStop)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.Speed)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.EmergencyStop)
     MergeFrom(*source);
   }
 }
 
-void TrainControlResponse_Speed::MergeFrom(const TrainControlResponse_Speed& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.Speed)
+void TrainControlResponse_EmergencyStop::MergeFrom(const TrainControlResponse_EmergencyStop& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.EmergencyStop)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
-    if (cached_has_bits & 0x00000001u) {
-      id_ = from.id_;
-    }
-    if (cached_has_bits & 0x00000002u) {
-      speed_ = from.speed_;
-    }
-    if (cached_has_bits & 0x00000004u) {
-      timestamp_ = from.timestamp_;
-    }
-    if (cached_has_bits & 0x00000008u) {
-      dir_ = from.dir_;
-    }
-    _has_bits_[0] |= cached_has_bits;
+  if (from._internal_has_stop()) {
+    _internal_set_stop(from._internal_stop());
   }
 }
 
-void TrainControlResponse_Speed::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.Speed)
+void TrainControlResponse_EmergencyStop::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.EmergencyStop)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void TrainControlResponse_Speed::CopyFrom(const TrainControlResponse_Speed& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.Speed)
+void TrainControlResponse_EmergencyStop::CopyFrom(const TrainControlResponse_EmergencyStop& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.EmergencyStop)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TrainControlResponse_Speed::IsInitialized() const {
+bool TrainControlResponse_EmergencyStop::IsInitialized() const {
   if (_Internal::MissingRequiredFields(_has_bits_)) return false;
   return true;
 }
 
-void TrainControlResponse_Speed::InternalSwap(TrainControlResponse_Speed* other) {
+void TrainControlResponse_EmergencyStop::InternalSwap(TrainControlResponse_EmergencyStop* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   swap(_has_bits_[0], other->_has_bits_[0]);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TrainControlResponse_Speed, timestamp_)
-      + sizeof(TrainControlResponse_Speed::timestamp_)
-      - PROTOBUF_FIELD_OFFSET(TrainControlResponse_Speed, id_)>(
-          reinterpret_cast<char*>(&id_),
-          reinterpret_cast<char*>(&other->id_));
-  swap(dir_, other->dir_);
+  swap(stop_, other->stop_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_Speed::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_EmergencyStop::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void TrainControlResponse_Accessory::InitAsDefaultInstance() {
+void TrainControlResponse_RpcResponse::InitAsDefaultInstance() {
 }
-class TrainControlResponse_Accessory::_Internal {
+class TrainControlResponse_RpcResponse::_Internal {
  public:
-  using HasBits = decltype(std::declval<TrainControlResponse_Accessory>()._has_bits_);
-  static void set_has_train_id(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
-  }
-  static void set_has_accessory_id(HasBits* has_bits) {
-    (*has_bits)[0] |= 4u;
-  }
-  static void set_has_value(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<TrainControlResponse_RpcResponse>()._has_bits_);
+  static void set_has_success(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
-  static void set_has_timestamp(HasBits* has_bits) {
-    (*has_bits)[0] |= 8u;
+  static void set_has_response(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
   static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
   }
 };
 
-TrainControlResponse_Accessory::TrainControlResponse_Accessory(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+TrainControlResponse_RpcResponse::TrainControlResponse_RpcResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.Accessory)
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.RpcResponse)
 }
-TrainControlResponse_Accessory::TrainControlResponse_Accessory(const TrainControlResponse_Accessory& from)
+TrainControlResponse_RpcResponse::TrainControlResponse_RpcResponse(const TrainControlResponse_RpcResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
       _has_bits_(from._has_bits_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&value_, &from.value_,
-    static_cast<size_t>(reinterpret_cast<char*>(&timestamp_) -
-    reinterpret_cast<char*>(&value_)) + sizeof(timestamp_));
-  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.Accessory)
+  ::memcpy(&success_, &from.success_,
+    static_cast<size_t>(reinterpret_cast<char*>(&response_) -
+    reinterpret_cast<char*>(&success_)) + sizeof(response_));
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.RpcResponse)
 }
 
-void TrainControlResponse_Accessory::SharedCtor() {
-  ::memset(&value_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&timestamp_) -
-      reinterpret_cast<char*>(&value_)) + sizeof(timestamp_));
+void TrainControlResponse_RpcResponse::SharedCtor() {
+  ::memset(&success_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&response_) -
+      reinterpret_cast<char*>(&success_)) + sizeof(response_));
 }
 
-TrainControlResponse_Accessory::~TrainControlResponse_Accessory() {
-  // @@protoc_insertion_point(destructor:server.TrainControlResponse.Accessory)
+TrainControlResponse_RpcResponse::~TrainControlResponse_RpcResponse() {
+  // @@protoc_insertion_point(destructor:server.TrainControlResponse.RpcResponse)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void TrainControlResponse_Accessory::SharedDtor() {
+void TrainControlResponse_RpcResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
 }
 
-void TrainControlResponse_Accessory::ArenaDtor(void* object) {
-  TrainControlResponse_Accessory* _this = reinterpret_cast< TrainControlResponse_Accessory* >(object);
+void TrainControlResponse_RpcResponse::ArenaDtor(void* object) {
+  TrainControlResponse_RpcResponse* _this = reinterpret_cast< TrainControlResponse_RpcResponse* >(object);
   (void)_this;
 }
-void TrainControlResponse_Accessory::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void TrainControlResponse_RpcResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void TrainControlResponse_Accessory::SetCachedSize(int size) const {
+void TrainControlResponse_RpcResponse::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const TrainControlResponse_Accessory& TrainControlResponse_Accessory::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_Accessory_train_5fcontrol_2eproto.base);
+const TrainControlResponse_RpcResponse& TrainControlResponse_RpcResponse::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_RpcResponse_train_5fcontrol_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void TrainControlResponse_Accessory::Clear() {
-// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.Accessory)
+void TrainControlResponse_RpcResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.RpcResponse)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
-    ::memset(&value_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&timestamp_) -
-        reinterpret_cast<char*>(&value_)) + sizeof(timestamp_));
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&success_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&response_) -
+        reinterpret_cast<char*>(&success_)) + sizeof(response_));
   }
   _has_bits_.Clear();
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* TrainControlResponse_Accessory::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  _Internal::HasBits has_bits{};
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // required int32 train_id = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
-          _Internal::set_has_train_id(&has_bits);
-          train_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // required int32 accessory_id = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
-          _Internal::set_has_accessory_id(&has_bits);
-          accessory_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // required int32 value = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
-          _Internal::set_has_value(&has_bits);
-          value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TrainControlResponse_RpcResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // required bool success = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 136)) {
+          _Internal::set_has_success(&has_bits);
+          success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // optional uint64 timestamp = 51;
-      case 51:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 152)) {
-          _Internal::set_has_timestamp(&has_bits);
-          timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+      // required int32 response = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 144)) {
+          _Internal::set_has_response(&has_bits);
+          response_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
@@ -7967,91 +9129,63 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_Accessory::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_RpcResponse::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.Accessory)
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.RpcResponse)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  // required int32 train_id = 5;
-  if (cached_has_bits & 0x00000002u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(5, this->_internal_train_id(), target);
-  }
-
-  // required int32 accessory_id = 6;
-  if (cached_has_bits & 0x00000004u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(6, this->_internal_accessory_id(), target);
-  }
-
-  // required int32 value = 7;
+  // required bool success = 17;
   if (cached_has_bits & 0x00000001u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(7, this->_internal_value(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(17, this->_internal_success(), target);
   }
 
-  // optional uint64 timestamp = 51;
-  if (cached_has_bits & 0x00000008u) {
+  // required int32 response = 18;
+  if (cached_has_bits & 0x00000002u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(51, this->_internal_timestamp(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(18, this->_internal_response(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.Accessory)
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.RpcResponse)
   return target;
 }
 
-size_t TrainControlResponse_Accessory::RequiredFieldsByteSizeFallback() const {
-// @@protoc_insertion_point(required_fields_byte_size_fallback_start:server.TrainControlResponse.Accessory)
+size_t TrainControlResponse_RpcResponse::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:server.TrainControlResponse.RpcResponse)
   size_t total_size = 0;
 
-  if (_internal_has_value()) {
-    // required int32 value = 7;
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_value());
-  }
-
-  if (_internal_has_train_id()) {
-    // required int32 train_id = 5;
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_train_id());
+  if (_internal_has_success()) {
+    // required bool success = 17;
+    total_size += 2 + 1;
   }
 
-  if (_internal_has_accessory_id()) {
-    // required int32 accessory_id = 6;
-    total_size += 1 +
+  if (_internal_has_response()) {
+    // required int32 response = 18;
+    total_size += 2 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_accessory_id());
+        this->_internal_response());
   }
 
   return total_size;
 }
-size_t TrainControlResponse_Accessory::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.Accessory)
+size_t TrainControlResponse_RpcResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.RpcResponse)
   size_t total_size = 0;
 
-  if (((_has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
-    // required int32 value = 7;
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_value());
-
-    // required int32 train_id = 5;
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_train_id());
+  if (((_has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required bool success = 17;
+    total_size += 2 + 1;
 
-    // required int32 accessory_id = 6;
-    total_size += 1 +
+    // required int32 response = 18;
+    total_size += 2 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_accessory_id());
+        this->_internal_response());
 
   } else {
     total_size += RequiredFieldsByteSizeFallback();
@@ -8060,14 +9194,6 @@ size_t TrainControlResponse_Accessory::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // optional uint64 timestamp = 51;
-  cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x00000008u) {
-    total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-        this->_internal_timestamp());
-  }
-
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -8077,90 +9203,84 @@ size_t TrainControlResponse_Accessory::ByteSizeLong() const {
   return total_size;
 }
 
-void TrainControlResponse_Accessory::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.Accessory)
+void TrainControlResponse_RpcResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.RpcResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const TrainControlResponse_Accessory* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_Accessory>(
+  const TrainControlResponse_RpcResponse* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_RpcResponse>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.Accessory)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.RpcResponse)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.Accessory)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.RpcResponse)
     MergeFrom(*source);
   }
 }
 
-void TrainControlResponse_Accessory::MergeFrom(const TrainControlResponse_Accessory& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.Accessory)
+void TrainControlResponse_RpcResponse::MergeFrom(const TrainControlResponse_RpcResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.RpcResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = from._has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
+  if (cached_has_bits & 0x00000003u) {
     if (cached_has_bits & 0x00000001u) {
-      value_ = from.value_;
+      success_ = from.success_;
     }
     if (cached_has_bits & 0x00000002u) {
-      train_id_ = from.train_id_;
-    }
-    if (cached_has_bits & 0x00000004u) {
-      accessory_id_ = from.accessory_id_;
-    }
-    if (cached_has_bits & 0x00000008u) {
-      timestamp_ = from.timestamp_;
+      response_ = from.response_;
     }
     _has_bits_[0] |= cached_has_bits;
   }
 }
 
-void TrainControlResponse_Accessory::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.Accessory)
+void TrainControlResponse_RpcResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.RpcResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void TrainControlResponse_Accessory::CopyFrom(const TrainControlResponse_Accessory& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.Accessory)
+void TrainControlResponse_RpcResponse::CopyFrom(const TrainControlResponse_RpcResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.RpcResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TrainControlResponse_Accessory::IsInitialized() const {
+bool TrainControlResponse_RpcResponse::IsInitialized() const {
   if (_Internal::MissingRequiredFields(_has_bits_)) return false;
   return true;
 }
 
-void TrainControlResponse_Accessory::InternalSwap(TrainControlResponse_Accessory* other) {
+void TrainControlResponse_RpcResponse::InternalSwap(TrainControlResponse_RpcResponse* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   swap(_has_bits_[0], other->_has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TrainControlResponse_Accessory, timestamp_)
-      + sizeof(TrainControlResponse_Accessory::timestamp_)
-      - PROTOBUF_FIELD_OFFSET(TrainControlResponse_Accessory, value_)>(
-          reinterpret_cast<char*>(&value_),
-          reinterpret_cast<char*>(&other->value_));
+      PROTOBUF_FIELD_OFFSET(TrainControlResponse_RpcResponse, response_)
+      + sizeof(TrainControlResponse_RpcResponse::response_)
+      - PROTOBUF_FIELD_OFFSET(TrainControlResponse_RpcResponse, success_)>(
+          reinterpret_cast<char*>(&success_),
+          reinterpret_cast<char*>(&other->success_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_Accessory::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_RpcResponse::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void TrainControlResponse_EmergencyStop::InitAsDefaultInstance() {
+void TrainControlResponse_Pong::InitAsDefaultInstance() {
 }
-class TrainControlResponse_EmergencyStop::_Internal {
+class TrainControlResponse_Pong::_Internal {
  public:
-  using HasBits = decltype(std::declval<TrainControlResponse_EmergencyStop>()._has_bits_);
-  static void set_has_stop(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<TrainControlResponse_Pong>()._has_bits_);
+  static void set_has_value(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
   static bool MissingRequiredFields(const HasBits& has_bits) {
@@ -8168,61 +9288,61 @@ class TrainControlResponse_EmergencyStop::_Internal {
   }
 };
 
-TrainControlResponse_EmergencyStop::TrainControlResponse_EmergencyStop(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+TrainControlResponse_Pong::TrainControlResponse_Pong(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.EmergencyStop)
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.Pong)
 }
-TrainControlResponse_EmergencyStop::TrainControlResponse_EmergencyStop(const TrainControlResponse_EmergencyStop& from)
+TrainControlResponse_Pong::TrainControlResponse_Pong(const TrainControlResponse_Pong& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
       _has_bits_(from._has_bits_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  stop_ = from.stop_;
-  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.EmergencyStop)
+  value_ = from.value_;
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.Pong)
 }
 
-void TrainControlResponse_EmergencyStop::SharedCtor() {
-  stop_ = false;
+void TrainControlResponse_Pong::SharedCtor() {
+  value_ = 0;
 }
 
-TrainControlResponse_EmergencyStop::~TrainControlResponse_EmergencyStop() {
-  // @@protoc_insertion_point(destructor:server.TrainControlResponse.EmergencyStop)
+TrainControlResponse_Pong::~TrainControlResponse_Pong() {
+  // @@protoc_insertion_point(destructor:server.TrainControlResponse.Pong)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void TrainControlResponse_EmergencyStop::SharedDtor() {
+void TrainControlResponse_Pong::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
 }
 
-void TrainControlResponse_EmergencyStop::ArenaDtor(void* object) {
-  TrainControlResponse_EmergencyStop* _this = reinterpret_cast< TrainControlResponse_EmergencyStop* >(object);
+void TrainControlResponse_Pong::ArenaDtor(void* object) {
+  TrainControlResponse_Pong* _this = reinterpret_cast< TrainControlResponse_Pong* >(object);
   (void)_this;
 }
-void TrainControlResponse_EmergencyStop::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void TrainControlResponse_Pong::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void TrainControlResponse_EmergencyStop::SetCachedSize(int size) const {
+void TrainControlResponse_Pong::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const TrainControlResponse_EmergencyStop& TrainControlResponse_EmergencyStop::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_EmergencyStop_train_5fcontrol_2eproto.base);
+const TrainControlResponse_Pong& TrainControlResponse_Pong::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_Pong_train_5fcontrol_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void TrainControlResponse_EmergencyStop::Clear() {
-// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.EmergencyStop)
+void TrainControlResponse_Pong::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.Pong)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  stop_ = false;
+  value_ = 0;
   _has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TrainControlResponse_EmergencyStop::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TrainControlResponse_Pong::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
@@ -8231,11 +9351,11 @@ const char* TrainControlResponse_EmergencyStop::_InternalParse(const char* ptr,
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // required bool stop = 9;
-      case 9:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 72)) {
-          _Internal::set_has_stop(&has_bits);
-          stop_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+      // required int32 value = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 160)) {
+          _Internal::set_has_value(&has_bits);
+          value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
@@ -8262,34 +9382,36 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_EmergencyStop::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_Pong::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.EmergencyStop)
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.Pong)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  // required bool stop = 9;
+  // required int32 value = 20;
   if (cached_has_bits & 0x00000001u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(9, this->_internal_stop(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(20, this->_internal_value(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.EmergencyStop)
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.Pong)
   return target;
 }
 
-size_t TrainControlResponse_EmergencyStop::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.EmergencyStop)
+size_t TrainControlResponse_Pong::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.Pong)
   size_t total_size = 0;
 
-  // required bool stop = 9;
-  if (_internal_has_stop()) {
-    total_size += 1 + 1;
+  // required int32 value = 20;
+  if (_internal_has_value()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_value());
   }
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
@@ -8304,146 +9426,134 @@ size_t TrainControlResponse_EmergencyStop::ByteSizeLong() const {
   return total_size;
 }
 
-void TrainControlResponse_EmergencyStop::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.EmergencyStop)
+void TrainControlResponse_Pong::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.Pong)
   GOOGLE_DCHECK_NE(&from, this);
-  const TrainControlResponse_EmergencyStop* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_EmergencyStop>(
+  const TrainControlResponse_Pong* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_Pong>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.EmergencyStop)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.Pong)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.EmergencyStop)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.Pong)
     MergeFrom(*source);
   }
 }
 
-void TrainControlResponse_EmergencyStop::MergeFrom(const TrainControlResponse_EmergencyStop& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.EmergencyStop)
+void TrainControlResponse_Pong::MergeFrom(const TrainControlResponse_Pong& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.Pong)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_stop()) {
-    _internal_set_stop(from._internal_stop());
+  if (from._internal_has_value()) {
+    _internal_set_value(from._internal_value());
   }
 }
 
-void TrainControlResponse_EmergencyStop::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.EmergencyStop)
+void TrainControlResponse_Pong::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.Pong)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void TrainControlResponse_EmergencyStop::CopyFrom(const TrainControlResponse_EmergencyStop& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.EmergencyStop)
+void TrainControlResponse_Pong::CopyFrom(const TrainControlResponse_Pong& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.Pong)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TrainControlResponse_EmergencyStop::IsInitialized() const {
+bool TrainControlResponse_Pong::IsInitialized() const {
   if (_Internal::MissingRequiredFields(_has_bits_)) return false;
   return true;
 }
 
-void TrainControlResponse_EmergencyStop::InternalSwap(TrainControlResponse_EmergencyStop* other) {
+void TrainControlResponse_Pong::InternalSwap(TrainControlResponse_Pong* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   swap(_has_bits_[0], other->_has_bits_[0]);
-  swap(stop_, other->stop_);
+  swap(value_, other->value_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_EmergencyStop::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_Pong::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void TrainControlResponse_RpcResponse::InitAsDefaultInstance() {
+void TrainControlResponse_CurrentAddress::InitAsDefaultInstance() {
 }
-class TrainControlResponse_RpcResponse::_Internal {
+class TrainControlResponse_CurrentAddress::_Internal {
  public:
-  using HasBits = decltype(std::declval<TrainControlResponse_RpcResponse>()._has_bits_);
-  static void set_has_success(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<TrainControlResponse_CurrentAddress>()._has_bits_);
+  static void set_has_address(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
-  static void set_has_response(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
-  }
   static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
   }
 };
 
-TrainControlResponse_RpcResponse::TrainControlResponse_RpcResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+TrainControlResponse_CurrentAddress::TrainControlResponse_CurrentAddress(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.RpcResponse)
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.CurrentAddress)
 }
-TrainControlResponse_RpcResponse::TrainControlResponse_RpcResponse(const TrainControlResponse_RpcResponse& from)
+TrainControlResponse_CurrentAddress::TrainControlResponse_CurrentAddress(const TrainControlResponse_CurrentAddress& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
       _has_bits_(from._has_bits_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&success_, &from.success_,
-    static_cast<size_t>(reinterpret_cast<char*>(&response_) -
-    reinterpret_cast<char*>(&success_)) + sizeof(response_));
-  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.RpcResponse)
+  address_ = from.address_;
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.CurrentAddress)
 }
 
-void TrainControlResponse_RpcResponse::SharedCtor() {
-  ::memset(&success_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&response_) -
-      reinterpret_cast<char*>(&success_)) + sizeof(response_));
+void TrainControlResponse_CurrentAddress::SharedCtor() {
+  address_ = 0;
 }
 
-TrainControlResponse_RpcResponse::~TrainControlResponse_RpcResponse() {
-  // @@protoc_insertion_point(destructor:server.TrainControlResponse.RpcResponse)
+TrainControlResponse_CurrentAddress::~TrainControlResponse_CurrentAddress() {
+  // @@protoc_insertion_point(destructor:server.TrainControlResponse.CurrentAddress)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void TrainControlResponse_RpcResponse::SharedDtor() {
+void TrainControlResponse_CurrentAddress::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
 }
 
-void TrainControlResponse_RpcResponse::ArenaDtor(void* object) {
-  TrainControlResponse_RpcResponse* _this = reinterpret_cast< TrainControlResponse_RpcResponse* >(object);
+void TrainControlResponse_CurrentAddress::ArenaDtor(void* object) {
+  TrainControlResponse_CurrentAddress* _this = reinterpret_cast< TrainControlResponse_CurrentAddress* >(object);
   (void)_this;
 }
-void TrainControlResponse_RpcResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void TrainControlResponse_CurrentAddress::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void TrainControlResponse_RpcResponse::SetCachedSize(int size) const {
+void TrainControlResponse_CurrentAddress::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const TrainControlResponse_RpcResponse& TrainControlResponse_RpcResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_RpcResponse_train_5fcontrol_2eproto.base);
+const TrainControlResponse_CurrentAddress& TrainControlResponse_CurrentAddress::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_CurrentAddress_train_5fcontrol_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void TrainControlResponse_RpcResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.RpcResponse)
+void TrainControlResponse_CurrentAddress::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.CurrentAddress)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    ::memset(&success_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&response_) -
-        reinterpret_cast<char*>(&success_)) + sizeof(response_));
-  }
+  address_ = 0;
   _has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TrainControlResponse_RpcResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TrainControlResponse_CurrentAddress::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
@@ -8452,19 +9562,11 @@ const char* TrainControlResponse_RpcResponse::_InternalParse(const char* ptr, ::
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // required bool success = 17;
-      case 17:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 136)) {
-          _Internal::set_has_success(&has_bits);
-          success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // required int32 response = 18;
-      case 18:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 144)) {
-          _Internal::set_has_response(&has_bits);
-          response_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+      // required int32 address = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 176)) {
+          _Internal::set_has_address(&has_bits);
+          address_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
@@ -8491,66 +9593,36 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_RpcResponse::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_CurrentAddress::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.RpcResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.CurrentAddress)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  // required bool success = 17;
+  // required int32 address = 22;
   if (cached_has_bits & 0x00000001u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(17, this->_internal_success(), target);
-  }
-
-  // required int32 response = 18;
-  if (cached_has_bits & 0x00000002u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(18, this->_internal_response(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(22, this->_internal_address(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.RpcResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.CurrentAddress)
   return target;
 }
 
-size_t TrainControlResponse_RpcResponse::RequiredFieldsByteSizeFallback() const {
-// @@protoc_insertion_point(required_fields_byte_size_fallback_start:server.TrainControlResponse.RpcResponse)
-  size_t total_size = 0;
-
-  if (_internal_has_success()) {
-    // required bool success = 17;
-    total_size += 2 + 1;
-  }
-
-  if (_internal_has_response()) {
-    // required int32 response = 18;
-    total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_response());
-  }
-
-  return total_size;
-}
-size_t TrainControlResponse_RpcResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.RpcResponse)
+size_t TrainControlResponse_CurrentAddress::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.CurrentAddress)
   size_t total_size = 0;
 
-  if (((_has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
-    // required bool success = 17;
-    total_size += 2 + 1;
-
-    // required int32 response = 18;
+  // required int32 address = 22;
+  if (_internal_has_address()) {
     total_size += 2 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_response());
-
-  } else {
-    total_size += RequiredFieldsByteSizeFallback();
+        this->_internal_address());
   }
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
@@ -8565,159 +9637,144 @@ size_t TrainControlResponse_RpcResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void TrainControlResponse_RpcResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.RpcResponse)
+void TrainControlResponse_CurrentAddress::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.CurrentAddress)
   GOOGLE_DCHECK_NE(&from, this);
-  const TrainControlResponse_RpcResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_RpcResponse>(
+  const TrainControlResponse_CurrentAddress* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_CurrentAddress>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.RpcResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.CurrentAddress)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.RpcResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.CurrentAddress)
     MergeFrom(*source);
   }
 }
 
-void TrainControlResponse_RpcResponse::MergeFrom(const TrainControlResponse_RpcResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.RpcResponse)
+void TrainControlResponse_CurrentAddress::MergeFrom(const TrainControlResponse_CurrentAddress& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.CurrentAddress)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      success_ = from.success_;
-    }
-    if (cached_has_bits & 0x00000002u) {
-      response_ = from.response_;
-    }
-    _has_bits_[0] |= cached_has_bits;
+  if (from._internal_has_address()) {
+    _internal_set_address(from._internal_address());
   }
 }
 
-void TrainControlResponse_RpcResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.RpcResponse)
+void TrainControlResponse_CurrentAddress::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.CurrentAddress)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void TrainControlResponse_RpcResponse::CopyFrom(const TrainControlResponse_RpcResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.RpcResponse)
+void TrainControlResponse_CurrentAddress::CopyFrom(const TrainControlResponse_CurrentAddress& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.CurrentAddress)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TrainControlResponse_RpcResponse::IsInitialized() const {
+bool TrainControlResponse_CurrentAddress::IsInitialized() const {
   if (_Internal::MissingRequiredFields(_has_bits_)) return false;
   return true;
 }
 
-void TrainControlResponse_RpcResponse::InternalSwap(TrainControlResponse_RpcResponse* other) {
+void TrainControlResponse_CurrentAddress::InternalSwap(TrainControlResponse_CurrentAddress* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   swap(_has_bits_[0], other->_has_bits_[0]);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TrainControlResponse_RpcResponse, response_)
-      + sizeof(TrainControlResponse_RpcResponse::response_)
-      - PROTOBUF_FIELD_OFFSET(TrainControlResponse_RpcResponse, success_)>(
-          reinterpret_cast<char*>(&success_),
-          reinterpret_cast<char*>(&other->success_));
+  swap(address_, other->address_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_RpcResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_CurrentAddress::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void TrainControlResponse_Pong::InitAsDefaultInstance() {
+void TrainControlResponse_RawCanPacket::InitAsDefaultInstance() {
 }
-class TrainControlResponse_Pong::_Internal {
+class TrainControlResponse_RawCanPacket::_Internal {
  public:
-  using HasBits = decltype(std::declval<TrainControlResponse_Pong>()._has_bits_);
-  static void set_has_value(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
-  static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
-  }
 };
 
-TrainControlResponse_Pong::TrainControlResponse_Pong(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+TrainControlResponse_RawCanPacket::TrainControlResponse_RawCanPacket(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  data_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.Pong)
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.RawCanPacket)
 }
-TrainControlResponse_Pong::TrainControlResponse_Pong(const TrainControlResponse_Pong& from)
+TrainControlResponse_RawCanPacket::TrainControlResponse_RawCanPacket(const TrainControlResponse_RawCanPacket& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_) {
+      data_(from.data_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  value_ = from.value_;
-  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.Pong)
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.RawCanPacket)
 }
 
-void TrainControlResponse_Pong::SharedCtor() {
-  value_ = 0;
+void TrainControlResponse_RawCanPacket::SharedCtor() {
 }
 
-TrainControlResponse_Pong::~TrainControlResponse_Pong() {
-  // @@protoc_insertion_point(destructor:server.TrainControlResponse.Pong)
+TrainControlResponse_RawCanPacket::~TrainControlResponse_RawCanPacket() {
+  // @@protoc_insertion_point(destructor:server.TrainControlResponse.RawCanPacket)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void TrainControlResponse_Pong::SharedDtor() {
+void TrainControlResponse_RawCanPacket::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
 }
 
-void TrainControlResponse_Pong::ArenaDtor(void* object) {
-  TrainControlResponse_Pong* _this = reinterpret_cast< TrainControlResponse_Pong* >(object);
+void TrainControlResponse_RawCanPacket::ArenaDtor(void* object) {
+  TrainControlResponse_RawCanPacket* _this = reinterpret_cast< TrainControlResponse_RawCanPacket* >(object);
   (void)_this;
 }
-void TrainControlResponse_Pong::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void TrainControlResponse_RawCanPacket::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void TrainControlResponse_Pong::SetCachedSize(int size) const {
+void TrainControlResponse_RawCanPacket::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const TrainControlResponse_Pong& TrainControlResponse_Pong::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_Pong_train_5fcontrol_2eproto.base);
+const TrainControlResponse_RawCanPacket& TrainControlResponse_RawCanPacket::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_RawCanPacket_train_5fcontrol_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void TrainControlResponse_Pong::Clear() {
-// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.Pong)
+void TrainControlResponse_RawCanPacket::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.RawCanPacket)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  value_ = 0;
-  _has_bits_.Clear();
+  data_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TrainControlResponse_Pong::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TrainControlResponse_RawCanPacket::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  _Internal::HasBits has_bits{};
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
     ::PROTOBUF_NAMESPACE_ID::uint32 tag;
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // required int32 value = 20;
-      case 20:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 160)) {
-          _Internal::set_has_value(&has_bits);
-          value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+      // repeated int32 data = 24;
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 192)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            _internal_add_data(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<192>(ptr));
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 194) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_data(), ptr, ctx);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
@@ -8736,7 +9793,6 @@ const char* TrainControlResponse_Pong::_InternalParse(const char* ptr, ::PROTOBU
     }  // switch
   }  // while
 success:
-  _has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -8744,41 +9800,43 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_Pong::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_RawCanPacket::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.Pong)
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.RawCanPacket)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
-  // required int32 value = 20;
-  if (cached_has_bits & 0x00000001u) {
+  // repeated int32 data = 24;
+  for (int i = 0, n = this->_internal_data_size(); i < n; i++) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(20, this->_internal_value(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(24, this->_internal_data(i), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.Pong)
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.RawCanPacket)
   return target;
 }
 
-size_t TrainControlResponse_Pong::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.Pong)
+size_t TrainControlResponse_RawCanPacket::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.RawCanPacket)
   size_t total_size = 0;
 
-  // required int32 value = 20;
-  if (_internal_has_value()) {
-    total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_value());
-  }
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // repeated int32 data = 24;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int32Size(this->data_);
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_data_size());
+    total_size += data_size;
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -8788,134 +9846,136 @@ size_t TrainControlResponse_Pong::ByteSizeLong() const {
   return total_size;
 }
 
-void TrainControlResponse_Pong::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.Pong)
+void TrainControlResponse_RawCanPacket::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.RawCanPacket)
   GOOGLE_DCHECK_NE(&from, this);
-  const TrainControlResponse_Pong* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_Pong>(
+  const TrainControlResponse_RawCanPacket* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_RawCanPacket>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.Pong)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.RawCanPacket)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.Pong)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.RawCanPacket)
     MergeFrom(*source);
   }
 }
 
-void TrainControlResponse_Pong::MergeFrom(const TrainControlResponse_Pong& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.Pong)
+void TrainControlResponse_RawCanPacket::MergeFrom(const TrainControlResponse_RawCanPacket& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.RawCanPacket)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_value()) {
-    _internal_set_value(from._internal_value());
-  }
+  data_.MergeFrom(from.data_);
 }
 
-void TrainControlResponse_Pong::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.Pong)
+void TrainControlResponse_RawCanPacket::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.RawCanPacket)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void TrainControlResponse_Pong::CopyFrom(const TrainControlResponse_Pong& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.Pong)
+void TrainControlResponse_RawCanPacket::CopyFrom(const TrainControlResponse_RawCanPacket& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.RawCanPacket)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TrainControlResponse_Pong::IsInitialized() const {
-  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
+bool TrainControlResponse_RawCanPacket::IsInitialized() const {
   return true;
 }
 
-void TrainControlResponse_Pong::InternalSwap(TrainControlResponse_Pong* other) {
+void TrainControlResponse_RawCanPacket::InternalSwap(TrainControlResponse_RawCanPacket* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
-  swap(value_, other->value_);
+  data_.InternalSwap(&other->data_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_Pong::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_RawCanPacket::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void TrainControlResponse_CurrentAddress::InitAsDefaultInstance() {
+void TrainControlResponse_ReflashAutomata::InitAsDefaultInstance() {
 }
-class TrainControlResponse_CurrentAddress::_Internal {
+class TrainControlResponse_ReflashAutomata::_Internal {
  public:
-  using HasBits = decltype(std::declval<TrainControlResponse_CurrentAddress>()._has_bits_);
-  static void set_has_address(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<TrainControlResponse_ReflashAutomata>()._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
-  static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
-  }
 };
 
-TrainControlResponse_CurrentAddress::TrainControlResponse_CurrentAddress(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+TrainControlResponse_ReflashAutomata::TrainControlResponse_ReflashAutomata(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.CurrentAddress)
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.ReflashAutomata)
 }
-TrainControlResponse_CurrentAddress::TrainControlResponse_CurrentAddress(const TrainControlResponse_CurrentAddress& from)
+TrainControlResponse_ReflashAutomata::TrainControlResponse_ReflashAutomata(const TrainControlResponse_ReflashAutomata& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
       _has_bits_(from._has_bits_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  address_ = from.address_;
-  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.CurrentAddress)
+  error_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (from._internal_has_error()) {
+    error_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_error(),
+      GetArena());
+  }
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.ReflashAutomata)
 }
 
-void TrainControlResponse_CurrentAddress::SharedCtor() {
-  address_ = 0;
+void TrainControlResponse_ReflashAutomata::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TrainControlResponse_ReflashAutomata_train_5fcontrol_2eproto.base);
+  error_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
-TrainControlResponse_CurrentAddress::~TrainControlResponse_CurrentAddress() {
-  // @@protoc_insertion_point(destructor:server.TrainControlResponse.CurrentAddress)
+TrainControlResponse_ReflashAutomata::~TrainControlResponse_ReflashAutomata() {
+  // @@protoc_insertion_point(destructor:server.TrainControlResponse.ReflashAutomata)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void TrainControlResponse_CurrentAddress::SharedDtor() {
+void TrainControlResponse_ReflashAutomata::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
+  error_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
-void TrainControlResponse_CurrentAddress::ArenaDtor(void* object) {
-  TrainControlResponse_CurrentAddress* _this = reinterpret_cast< TrainControlResponse_CurrentAddress* >(object);
+void TrainControlResponse_ReflashAutomata::ArenaDtor(void* object) {
+  TrainControlResponse_ReflashAutomata* _this = reinterpret_cast< TrainControlResponse_ReflashAutomata* >(object);
   (void)_this;
 }
-void TrainControlResponse_CurrentAddress::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void TrainControlResponse_ReflashAutomata::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void TrainControlResponse_CurrentAddress::SetCachedSize(int size) const {
+void TrainControlResponse_ReflashAutomata::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const TrainControlResponse_CurrentAddress& TrainControlResponse_CurrentAddress::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_CurrentAddress_train_5fcontrol_2eproto.base);
+const TrainControlResponse_ReflashAutomata& TrainControlResponse_ReflashAutomata::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_ReflashAutomata_train_5fcontrol_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void TrainControlResponse_CurrentAddress::Clear() {
-// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.CurrentAddress)
+void TrainControlResponse_ReflashAutomata::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.ReflashAutomata)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  address_ = 0;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    error_.ClearNonDefaultToEmpty();
+  }
   _has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TrainControlResponse_CurrentAddress::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TrainControlResponse_ReflashAutomata::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
@@ -8924,11 +9984,14 @@ const char* TrainControlResponse_CurrentAddress::_InternalParse(const char* ptr,
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // required int32 address = 22;
-      case 22:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 176)) {
-          _Internal::set_has_address(&has_bits);
-          address_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+      // optional string error = 26;
+      case 26:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 210)) {
+          auto str = _internal_mutable_error();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          #ifndef NDEBUG
+          ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "server.TrainControlResponse.ReflashAutomata.error");
+          #endif  // !NDEBUG
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
@@ -8955,41 +10018,47 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_CurrentAddress::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_ReflashAutomata::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.CurrentAddress)
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.ReflashAutomata)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  // required int32 address = 22;
+  // optional string error = 26;
   if (cached_has_bits & 0x00000001u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(22, this->_internal_address(), target);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "server.TrainControlResponse.ReflashAutomata.error");
+    target = stream->WriteStringMaybeAliased(
+        26, this->_internal_error(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.CurrentAddress)
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.ReflashAutomata)
   return target;
 }
 
-size_t TrainControlResponse_CurrentAddress::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.CurrentAddress)
+size_t TrainControlResponse_ReflashAutomata::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.ReflashAutomata)
   size_t total_size = 0;
 
-  // required int32 address = 22;
-  if (_internal_has_address()) {
-    total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_address());
-  }
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // optional string error = 26;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -8999,144 +10068,166 @@ size_t TrainControlResponse_CurrentAddress::ByteSizeLong() const {
   return total_size;
 }
 
-void TrainControlResponse_CurrentAddress::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.CurrentAddress)
+void TrainControlResponse_ReflashAutomata::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.ReflashAutomata)
   GOOGLE_DCHECK_NE(&from, this);
-  const TrainControlResponse_CurrentAddress* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_CurrentAddress>(
+  const TrainControlResponse_ReflashAutomata* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_ReflashAutomata>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.CurrentAddress)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.ReflashAutomata)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.CurrentAddress)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.ReflashAutomata)
     MergeFrom(*source);
   }
 }
 
-void TrainControlResponse_CurrentAddress::MergeFrom(const TrainControlResponse_CurrentAddress& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.CurrentAddress)
+void TrainControlResponse_ReflashAutomata::MergeFrom(const TrainControlResponse_ReflashAutomata& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.ReflashAutomata)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_address()) {
-    _internal_set_address(from._internal_address());
+  if (from._internal_has_error()) {
+    _internal_set_error(from._internal_error());
   }
 }
 
-void TrainControlResponse_CurrentAddress::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.CurrentAddress)
+void TrainControlResponse_ReflashAutomata::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.ReflashAutomata)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void TrainControlResponse_CurrentAddress::CopyFrom(const TrainControlResponse_CurrentAddress& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.CurrentAddress)
+void TrainControlResponse_ReflashAutomata::CopyFrom(const TrainControlResponse_ReflashAutomata& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.ReflashAutomata)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TrainControlResponse_CurrentAddress::IsInitialized() const {
-  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
+bool TrainControlResponse_ReflashAutomata::IsInitialized() const {
   return true;
 }
 
-void TrainControlResponse_CurrentAddress::InternalSwap(TrainControlResponse_CurrentAddress* other) {
+void TrainControlResponse_ReflashAutomata::InternalSwap(TrainControlResponse_ReflashAutomata* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   swap(_has_bits_[0], other->_has_bits_[0]);
-  swap(address_, other->address_);
+  error_.Swap(&other->error_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_CurrentAddress::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_ReflashAutomata::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void TrainControlResponse_RawCanPacket::InitAsDefaultInstance() {
+void TrainControlResponse_LokDb_Lok_Function::InitAsDefaultInstance() {
 }
-class TrainControlResponse_RawCanPacket::_Internal {
+class TrainControlResponse_LokDb_Lok_Function::_Internal {
  public:
+  using HasBits = decltype(std::declval<TrainControlResponse_LokDb_Lok_Function>()._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
 };
 
-TrainControlResponse_RawCanPacket::TrainControlResponse_RawCanPacket(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  data_(arena) {
+TrainControlResponse_LokDb_Lok_Function::TrainControlResponse_LokDb_Lok_Function(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.RawCanPacket)
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.LokDb.Lok.Function)
 }
-TrainControlResponse_RawCanPacket::TrainControlResponse_RawCanPacket(const TrainControlResponse_RawCanPacket& from)
+TrainControlResponse_LokDb_Lok_Function::TrainControlResponse_LokDb_Lok_Function(const TrainControlResponse_LokDb_Lok_Function& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
-      data_(from.data_) {
+      _has_bits_(from._has_bits_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.RawCanPacket)
+  ::memcpy(&id_, &from.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&type_) -
+    reinterpret_cast<char*>(&id_)) + sizeof(type_));
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.LokDb.Lok.Function)
 }
 
-void TrainControlResponse_RawCanPacket::SharedCtor() {
+void TrainControlResponse_LokDb_Lok_Function::SharedCtor() {
+  ::memset(&id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&type_) -
+      reinterpret_cast<char*>(&id_)) + sizeof(type_));
 }
 
-TrainControlResponse_RawCanPacket::~TrainControlResponse_RawCanPacket() {
-  // @@protoc_insertion_point(destructor:server.TrainControlResponse.RawCanPacket)
+TrainControlResponse_LokDb_Lok_Function::~TrainControlResponse_LokDb_Lok_Function() {
+  // @@protoc_insertion_point(destructor:server.TrainControlResponse.LokDb.Lok.Function)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void TrainControlResponse_RawCanPacket::SharedDtor() {
+void TrainControlResponse_LokDb_Lok_Function::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
 }
 
-void TrainControlResponse_RawCanPacket::ArenaDtor(void* object) {
-  TrainControlResponse_RawCanPacket* _this = reinterpret_cast< TrainControlResponse_RawCanPacket* >(object);
+void TrainControlResponse_LokDb_Lok_Function::ArenaDtor(void* object) {
+  TrainControlResponse_LokDb_Lok_Function* _this = reinterpret_cast< TrainControlResponse_LokDb_Lok_Function* >(object);
   (void)_this;
 }
-void TrainControlResponse_RawCanPacket::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void TrainControlResponse_LokDb_Lok_Function::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void TrainControlResponse_RawCanPacket::SetCachedSize(int size) const {
+void TrainControlResponse_LokDb_Lok_Function::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const TrainControlResponse_RawCanPacket& TrainControlResponse_RawCanPacket::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_RawCanPacket_train_5fcontrol_2eproto.base);
+const TrainControlResponse_LokDb_Lok_Function& TrainControlResponse_LokDb_Lok_Function::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_LokDb_Lok_Function_train_5fcontrol_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void TrainControlResponse_RawCanPacket::Clear() {
-// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.RawCanPacket)
+void TrainControlResponse_LokDb_Lok_Function::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.LokDb.Lok.Function)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  data_.Clear();
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&type_) -
+        reinterpret_cast<char*>(&id_)) + sizeof(type_));
+  }
+  _has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TrainControlResponse_RawCanPacket::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TrainControlResponse_LokDb_Lok_Function::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
     ::PROTOBUF_NAMESPACE_ID::uint32 tag;
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // repeated int32 data = 24;
-      case 24:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 192)) {
-          ptr -= 2;
-          do {
-            ptr += 2;
-            _internal_add_data(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<192>(ptr));
-        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 194) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_data(), ptr, ctx);
+      // required int32 id = 34;
+      case 34:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          _Internal::set_has_id(&has_bits);
+          id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional int32 type = 35;
+      case 35:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          _Internal::set_has_type(&has_bits);
+          type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
@@ -9155,6 +10246,7 @@ const char* TrainControlResponse_RawCanPacket::_InternalParse(const char* ptr, :
     }  // switch
   }  // while
 success:
+  _has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -9162,41 +10254,53 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_RawCanPacket::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_LokDb_Lok_Function::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.RawCanPacket)
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.LokDb.Lok.Function)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated int32 data = 24;
-  for (int i = 0, n = this->_internal_data_size(); i < n; i++) {
+  cached_has_bits = _has_bits_[0];
+  // required int32 id = 34;
+  if (cached_has_bits & 0x00000001u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(24, this->_internal_data(i), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(34, this->_internal_id(), target);
+  }
+
+  // optional int32 type = 35;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(35, this->_internal_type(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.RawCanPacket)
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.LokDb.Lok.Function)
   return target;
 }
 
-size_t TrainControlResponse_RawCanPacket::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.RawCanPacket)
+size_t TrainControlResponse_LokDb_Lok_Function::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.LokDb.Lok.Function)
   size_t total_size = 0;
 
+  // required int32 id = 34;
+  if (_internal_has_id()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_id());
+  }
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated int32 data = 24;
-  {
-    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      Int32Size(this->data_);
-    total_size += 2 *
-                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_data_size());
-    total_size += data_size;
+  // optional int32 type = 35;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_type());
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -9208,136 +10312,175 @@ size_t TrainControlResponse_RawCanPacket::ByteSizeLong() const {
   return total_size;
 }
 
-void TrainControlResponse_RawCanPacket::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.RawCanPacket)
+void TrainControlResponse_LokDb_Lok_Function::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.LokDb.Lok.Function)
   GOOGLE_DCHECK_NE(&from, this);
-  const TrainControlResponse_RawCanPacket* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_RawCanPacket>(
+  const TrainControlResponse_LokDb_Lok_Function* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_LokDb_Lok_Function>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.RawCanPacket)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.LokDb.Lok.Function)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.RawCanPacket)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.LokDb.Lok.Function)
     MergeFrom(*source);
   }
 }
 
-void TrainControlResponse_RawCanPacket::MergeFrom(const TrainControlResponse_RawCanPacket& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.RawCanPacket)
+void TrainControlResponse_LokDb_Lok_Function::MergeFrom(const TrainControlResponse_LokDb_Lok_Function& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.LokDb.Lok.Function)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  data_.MergeFrom(from.data_);
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      id_ = from.id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      type_ = from.type_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
 }
 
-void TrainControlResponse_RawCanPacket::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.RawCanPacket)
+void TrainControlResponse_LokDb_Lok_Function::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.LokDb.Lok.Function)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void TrainControlResponse_RawCanPacket::CopyFrom(const TrainControlResponse_RawCanPacket& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.RawCanPacket)
+void TrainControlResponse_LokDb_Lok_Function::CopyFrom(const TrainControlResponse_LokDb_Lok_Function& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.LokDb.Lok.Function)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TrainControlResponse_RawCanPacket::IsInitialized() const {
+bool TrainControlResponse_LokDb_Lok_Function::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
   return true;
 }
 
-void TrainControlResponse_RawCanPacket::InternalSwap(TrainControlResponse_RawCanPacket* other) {
+void TrainControlResponse_LokDb_Lok_Function::InternalSwap(TrainControlResponse_LokDb_Lok_Function* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  data_.InternalSwap(&other->data_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TrainControlResponse_LokDb_Lok_Function, type_)
+      + sizeof(TrainControlResponse_LokDb_Lok_Function::type_)
+      - PROTOBUF_FIELD_OFFSET(TrainControlResponse_LokDb_Lok_Function, id_)>(
+          reinterpret_cast<char*>(&id_),
+          reinterpret_cast<char*>(&other->id_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_RawCanPacket::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_LokDb_Lok_Function::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void TrainControlResponse_ReflashAutomata::InitAsDefaultInstance() {
+void TrainControlResponse_LokDb_Lok::InitAsDefaultInstance() {
 }
-class TrainControlResponse_ReflashAutomata::_Internal {
+class TrainControlResponse_LokDb_Lok::_Internal {
  public:
-  using HasBits = decltype(std::declval<TrainControlResponse_ReflashAutomata>()._has_bits_);
-  static void set_has_error(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<TrainControlResponse_LokDb_Lok>()._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_name(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static void set_has_address(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
 };
 
-TrainControlResponse_ReflashAutomata::TrainControlResponse_ReflashAutomata(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+TrainControlResponse_LokDb_Lok::TrainControlResponse_LokDb_Lok(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  function_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.ReflashAutomata)
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.LokDb.Lok)
 }
-TrainControlResponse_ReflashAutomata::TrainControlResponse_ReflashAutomata(const TrainControlResponse_ReflashAutomata& from)
+TrainControlResponse_LokDb_Lok::TrainControlResponse_LokDb_Lok(const TrainControlResponse_LokDb_Lok& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_) {
+      _has_bits_(from._has_bits_),
+      function_(from.function_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  error_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from._internal_has_error()) {
-    error_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_error(),
+  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (from._internal_has_name()) {
+    name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_name(),
       GetArena());
   }
-  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.ReflashAutomata)
+  ::memcpy(&id_, &from.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&address_) -
+    reinterpret_cast<char*>(&id_)) + sizeof(address_));
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.LokDb.Lok)
 }
 
-void TrainControlResponse_ReflashAutomata::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TrainControlResponse_ReflashAutomata_train_5fcontrol_2eproto.base);
-  error_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+void TrainControlResponse_LokDb_Lok::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TrainControlResponse_LokDb_Lok_train_5fcontrol_2eproto.base);
+  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&address_) -
+      reinterpret_cast<char*>(&id_)) + sizeof(address_));
 }
 
-TrainControlResponse_ReflashAutomata::~TrainControlResponse_ReflashAutomata() {
-  // @@protoc_insertion_point(destructor:server.TrainControlResponse.ReflashAutomata)
+TrainControlResponse_LokDb_Lok::~TrainControlResponse_LokDb_Lok() {
+  // @@protoc_insertion_point(destructor:server.TrainControlResponse.LokDb.Lok)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void TrainControlResponse_ReflashAutomata::SharedDtor() {
+void TrainControlResponse_LokDb_Lok::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
-  error_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
-void TrainControlResponse_ReflashAutomata::ArenaDtor(void* object) {
-  TrainControlResponse_ReflashAutomata* _this = reinterpret_cast< TrainControlResponse_ReflashAutomata* >(object);
+void TrainControlResponse_LokDb_Lok::ArenaDtor(void* object) {
+  TrainControlResponse_LokDb_Lok* _this = reinterpret_cast< TrainControlResponse_LokDb_Lok* >(object);
   (void)_this;
 }
-void TrainControlResponse_ReflashAutomata::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void TrainControlResponse_LokDb_Lok::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void TrainControlResponse_ReflashAutomata::SetCachedSize(int size) const {
+void TrainControlResponse_LokDb_Lok::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const TrainControlResponse_ReflashAutomata& TrainControlResponse_ReflashAutomata::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_ReflashAutomata_train_5fcontrol_2eproto.base);
+const TrainControlResponse_LokDb_Lok& TrainControlResponse_LokDb_Lok::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_LokDb_Lok_train_5fcontrol_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void TrainControlResponse_ReflashAutomata::Clear() {
-// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.ReflashAutomata)
+void TrainControlResponse_LokDb_Lok::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.LokDb.Lok)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  function_.Clear();
   cached_has_bits = _has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
-    error_.ClearNonDefaultToEmpty();
+    name_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&address_) -
+        reinterpret_cast<char*>(&id_)) + sizeof(address_));
   }
   _has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TrainControlResponse_ReflashAutomata::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TrainControlResponse_LokDb_Lok::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
@@ -9346,17 +10489,45 @@ const char* TrainControlResponse_ReflashAutomata::_InternalParse(const char* ptr
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // optional string error = 26;
-      case 26:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 210)) {
-          auto str = _internal_mutable_error();
+      // required int32 id = 30;
+      case 30:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 240)) {
+          _Internal::set_has_id(&has_bits);
+          id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional string name = 31;
+      case 31:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 250)) {
+          auto str = _internal_mutable_name();
           ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
           #ifndef NDEBUG
-          ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "server.TrainControlResponse.ReflashAutomata.error");
+          ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "server.TrainControlResponse.LokDb.Lok.name");
           #endif  // !NDEBUG
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
+      // optional int32 address = 32;
+      case 32:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 0)) {
+          _Internal::set_has_address(&has_bits);
+          address_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated group Function = 33 { ... };
+      case 33:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 11)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseGroup(_internal_add_function(), ptr, 267);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<267>(ptr));
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -9380,45 +10551,85 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_ReflashAutomata::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_LokDb_Lok::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.ReflashAutomata)
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.LokDb.Lok)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  // optional string error = 26;
+  // required int32 id = 30;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(30, this->_internal_id(), target);
+  }
+
+  // optional string name = 31;
   if (cached_has_bits & 0x00000001u) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
-      "server.TrainControlResponse.ReflashAutomata.error");
+      "server.TrainControlResponse.LokDb.Lok.name");
     target = stream->WriteStringMaybeAliased(
-        26, this->_internal_error(), target);
+        31, this->_internal_name(), target);
+  }
+
+  // optional int32 address = 32;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(32, this->_internal_address(), target);
+  }
+
+  // repeated group Function = 33 { ... };
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_function_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(33, this->_internal_function(i), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.ReflashAutomata)
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.LokDb.Lok)
   return target;
 }
 
-size_t TrainControlResponse_ReflashAutomata::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.ReflashAutomata)
+size_t TrainControlResponse_LokDb_Lok::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.LokDb.Lok)
   size_t total_size = 0;
 
+  // required int32 id = 30;
+  if (_internal_has_id()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_id());
+  }
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // optional string error = 26;
+  // repeated group Function = 33 { ... };
+  total_size += 4UL * this->_internal_function_size();
+  for (const auto& msg : this->function_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(msg);
+  }
+
+  // optional string name = 31;
   cached_has_bits = _has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
     total_size += 2 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_error());
+        this->_internal_name());
+  }
+
+  // optional int32 address = 32;
+  if (cached_has_bits & 0x00000004u) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_address());
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -9430,167 +10641,162 @@ size_t TrainControlResponse_ReflashAutomata::ByteSizeLong() const {
   return total_size;
 }
 
-void TrainControlResponse_ReflashAutomata::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.ReflashAutomata)
+void TrainControlResponse_LokDb_Lok::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.LokDb.Lok)
   GOOGLE_DCHECK_NE(&from, this);
-  const TrainControlResponse_ReflashAutomata* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_ReflashAutomata>(
+  const TrainControlResponse_LokDb_Lok* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_LokDb_Lok>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.ReflashAutomata)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.LokDb.Lok)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.ReflashAutomata)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.LokDb.Lok)
     MergeFrom(*source);
   }
 }
 
-void TrainControlResponse_ReflashAutomata::MergeFrom(const TrainControlResponse_ReflashAutomata& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.ReflashAutomata)
+void TrainControlResponse_LokDb_Lok::MergeFrom(const TrainControlResponse_LokDb_Lok& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.LokDb.Lok)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_error()) {
-    _internal_set_error(from._internal_error());
+  function_.MergeFrom(from.function_);
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      id_ = from.id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      address_ = from.address_;
+    }
+    _has_bits_[0] |= cached_has_bits;
   }
 }
 
-void TrainControlResponse_ReflashAutomata::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.ReflashAutomata)
+void TrainControlResponse_LokDb_Lok::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.LokDb.Lok)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void TrainControlResponse_ReflashAutomata::CopyFrom(const TrainControlResponse_ReflashAutomata& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.ReflashAutomata)
+void TrainControlResponse_LokDb_Lok::CopyFrom(const TrainControlResponse_LokDb_Lok& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.LokDb.Lok)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TrainControlResponse_ReflashAutomata::IsInitialized() const {
+bool TrainControlResponse_LokDb_Lok::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(function_)) return false;
   return true;
 }
 
-void TrainControlResponse_ReflashAutomata::InternalSwap(TrainControlResponse_ReflashAutomata* other) {
+void TrainControlResponse_LokDb_Lok::InternalSwap(TrainControlResponse_LokDb_Lok* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   swap(_has_bits_[0], other->_has_bits_[0]);
-  error_.Swap(&other->error_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  function_.InternalSwap(&other->function_);
+  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TrainControlResponse_LokDb_Lok, address_)
+      + sizeof(TrainControlResponse_LokDb_Lok::address_)
+      - PROTOBUF_FIELD_OFFSET(TrainControlResponse_LokDb_Lok, id_)>(
+          reinterpret_cast<char*>(&id_),
+          reinterpret_cast<char*>(&other->id_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_ReflashAutomata::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_LokDb_Lok::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void TrainControlResponse_LokDb_Lok_Function::InitAsDefaultInstance() {
+void TrainControlResponse_LokDb::InitAsDefaultInstance() {
 }
-class TrainControlResponse_LokDb_Lok_Function::_Internal {
+class TrainControlResponse_LokDb::_Internal {
  public:
-  using HasBits = decltype(std::declval<TrainControlResponse_LokDb_Lok_Function>()._has_bits_);
-  static void set_has_id(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
-  static void set_has_type(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
-  }
-  static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
-  }
 };
 
-TrainControlResponse_LokDb_Lok_Function::TrainControlResponse_LokDb_Lok_Function(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+TrainControlResponse_LokDb::TrainControlResponse_LokDb(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  lok_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.LokDb.Lok.Function)
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.LokDb)
 }
-TrainControlResponse_LokDb_Lok_Function::TrainControlResponse_LokDb_Lok_Function(const TrainControlResponse_LokDb_Lok_Function& from)
+TrainControlResponse_LokDb::TrainControlResponse_LokDb(const TrainControlResponse_LokDb& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_) {
+      lok_(from.lok_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&id_, &from.id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&type_) -
-    reinterpret_cast<char*>(&id_)) + sizeof(type_));
-  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.LokDb.Lok.Function)
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.LokDb)
 }
 
-void TrainControlResponse_LokDb_Lok_Function::SharedCtor() {
-  ::memset(&id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&type_) -
-      reinterpret_cast<char*>(&id_)) + sizeof(type_));
+void TrainControlResponse_LokDb::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TrainControlResponse_LokDb_train_5fcontrol_2eproto.base);
 }
 
-TrainControlResponse_LokDb_Lok_Function::~TrainControlResponse_LokDb_Lok_Function() {
-  // @@protoc_insertion_point(destructor:server.TrainControlResponse.LokDb.Lok.Function)
+TrainControlResponse_LokDb::~TrainControlResponse_LokDb() {
+  // @@protoc_insertion_point(destructor:server.TrainControlResponse.LokDb)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void TrainControlResponse_LokDb_Lok_Function::SharedDtor() {
+void TrainControlResponse_LokDb::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
 }
 
-void TrainControlResponse_LokDb_Lok_Function::ArenaDtor(void* object) {
-  TrainControlResponse_LokDb_Lok_Function* _this = reinterpret_cast< TrainControlResponse_LokDb_Lok_Function* >(object);
+void TrainControlResponse_LokDb::ArenaDtor(void* object) {
+  TrainControlResponse_LokDb* _this = reinterpret_cast< TrainControlResponse_LokDb* >(object);
   (void)_this;
 }
-void TrainControlResponse_LokDb_Lok_Function::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void TrainControlResponse_LokDb::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void TrainControlResponse_LokDb_Lok_Function::SetCachedSize(int size) const {
+void TrainControlResponse_LokDb::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const TrainControlResponse_LokDb_Lok_Function& TrainControlResponse_LokDb_Lok_Function::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_LokDb_Lok_Function_train_5fcontrol_2eproto.base);
+const TrainControlResponse_LokDb& TrainControlResponse_LokDb::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_LokDb_train_5fcontrol_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void TrainControlResponse_LokDb_Lok_Function::Clear() {
-// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.LokDb.Lok.Function)
+void TrainControlResponse_LokDb::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.LokDb)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    ::memset(&id_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&type_) -
-        reinterpret_cast<char*>(&id_)) + sizeof(type_));
-  }
-  _has_bits_.Clear();
+  lok_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TrainControlResponse_LokDb_Lok_Function::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TrainControlResponse_LokDb::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  _Internal::HasBits has_bits{};
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
     ::PROTOBUF_NAMESPACE_ID::uint32 tag;
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // required int32 id = 34;
-      case 34:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          _Internal::set_has_id(&has_bits);
-          id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional int32 type = 35;
-      case 35:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          _Internal::set_has_type(&has_bits);
-          type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
+      // repeated group Lok = 29 { ... };
+      case 29:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 235)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseGroup(_internal_add_lok(), ptr, 235);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<235>(ptr));
         } else goto handle_unusual;
         continue;
       default: {
@@ -9608,7 +10814,6 @@ const char* TrainControlResponse_LokDb_Lok_Function::_InternalParse(const char*
     }  // switch
   }  // while
 success:
-  _has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -9616,53 +10821,41 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_LokDb_Lok_Function::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_LokDb::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.LokDb.Lok.Function)
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.LokDb)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
-  // required int32 id = 34;
-  if (cached_has_bits & 0x00000001u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(34, this->_internal_id(), target);
-  }
-
-  // optional int32 type = 35;
-  if (cached_has_bits & 0x00000002u) {
+  // repeated group Lok = 29 { ... };
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_lok_size()); i < n; i++) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(35, this->_internal_type(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(29, this->_internal_lok(i), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.LokDb.Lok.Function)
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.LokDb)
   return target;
 }
 
-size_t TrainControlResponse_LokDb_Lok_Function::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.LokDb.Lok.Function)
+size_t TrainControlResponse_LokDb::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.LokDb)
   size_t total_size = 0;
 
-  // required int32 id = 34;
-  if (_internal_has_id()) {
-    total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_id());
-  }
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // optional int32 type = 35;
-  cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x00000002u) {
-    total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_type());
+  // repeated group Lok = 29 { ... };
+  total_size += 4UL * this->_internal_lok_size();
+  for (const auto& msg : this->lok_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(msg);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -9674,175 +10867,152 @@ size_t TrainControlResponse_LokDb_Lok_Function::ByteSizeLong() const {
   return total_size;
 }
 
-void TrainControlResponse_LokDb_Lok_Function::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.LokDb.Lok.Function)
+void TrainControlResponse_LokDb::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.LokDb)
   GOOGLE_DCHECK_NE(&from, this);
-  const TrainControlResponse_LokDb_Lok_Function* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_LokDb_Lok_Function>(
+  const TrainControlResponse_LokDb* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_LokDb>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.LokDb.Lok.Function)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.LokDb)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.LokDb.Lok.Function)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.LokDb)
     MergeFrom(*source);
   }
 }
 
-void TrainControlResponse_LokDb_Lok_Function::MergeFrom(const TrainControlResponse_LokDb_Lok_Function& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.LokDb.Lok.Function)
+void TrainControlResponse_LokDb::MergeFrom(const TrainControlResponse_LokDb& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.LokDb)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      id_ = from.id_;
-    }
-    if (cached_has_bits & 0x00000002u) {
-      type_ = from.type_;
-    }
-    _has_bits_[0] |= cached_has_bits;
-  }
+  lok_.MergeFrom(from.lok_);
 }
 
-void TrainControlResponse_LokDb_Lok_Function::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.LokDb.Lok.Function)
+void TrainControlResponse_LokDb::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.LokDb)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void TrainControlResponse_LokDb_Lok_Function::CopyFrom(const TrainControlResponse_LokDb_Lok_Function& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.LokDb.Lok.Function)
+void TrainControlResponse_LokDb::CopyFrom(const TrainControlResponse_LokDb& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.LokDb)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TrainControlResponse_LokDb_Lok_Function::IsInitialized() const {
-  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
+bool TrainControlResponse_LokDb::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(lok_)) return false;
   return true;
 }
 
-void TrainControlResponse_LokDb_Lok_Function::InternalSwap(TrainControlResponse_LokDb_Lok_Function* other) {
+void TrainControlResponse_LokDb::InternalSwap(TrainControlResponse_LokDb* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TrainControlResponse_LokDb_Lok_Function, type_)
-      + sizeof(TrainControlResponse_LokDb_Lok_Function::type_)
-      - PROTOBUF_FIELD_OFFSET(TrainControlResponse_LokDb_Lok_Function, id_)>(
-          reinterpret_cast<char*>(&id_),
-          reinterpret_cast<char*>(&other->id_));
+  lok_.InternalSwap(&other->lok_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_LokDb_Lok_Function::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_LokDb::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void TrainControlResponse_LokDb_Lok::InitAsDefaultInstance() {
+void TrainControlResponse_PicMisc::InitAsDefaultInstance() {
 }
-class TrainControlResponse_LokDb_Lok::_Internal {
+class TrainControlResponse_PicMisc::_Internal {
  public:
-  using HasBits = decltype(std::declval<TrainControlResponse_LokDb_Lok>()._has_bits_);
-  static void set_has_id(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
-  }
-  static void set_has_name(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<TrainControlResponse_PicMisc>()._has_bits_);
+  static void set_has_cmd(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
-  static void set_has_address(HasBits* has_bits) {
+  static void set_has_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_arg1(HasBits* has_bits) {
     (*has_bits)[0] |= 4u;
   }
+  static void set_has_arg2(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
   static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
   }
 };
 
-TrainControlResponse_LokDb_Lok::TrainControlResponse_LokDb_Lok(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+TrainControlResponse_PicMisc::TrainControlResponse_PicMisc(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  function_(arena) {
+  more_arg_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.LokDb.Lok)
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.PicMisc)
 }
-TrainControlResponse_LokDb_Lok::TrainControlResponse_LokDb_Lok(const TrainControlResponse_LokDb_Lok& from)
+TrainControlResponse_PicMisc::TrainControlResponse_PicMisc(const TrainControlResponse_PicMisc& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
       _has_bits_(from._has_bits_),
-      function_(from.function_) {
+      more_arg_(from.more_arg_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from._internal_has_name()) {
-    name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_name(),
-      GetArena());
-  }
-  ::memcpy(&id_, &from.id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&address_) -
-    reinterpret_cast<char*>(&id_)) + sizeof(address_));
-  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.LokDb.Lok)
+  ::memcpy(&cmd_, &from.cmd_,
+    static_cast<size_t>(reinterpret_cast<char*>(&arg2_) -
+    reinterpret_cast<char*>(&cmd_)) + sizeof(arg2_));
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.PicMisc)
 }
 
-void TrainControlResponse_LokDb_Lok::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TrainControlResponse_LokDb_Lok_train_5fcontrol_2eproto.base);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&address_) -
-      reinterpret_cast<char*>(&id_)) + sizeof(address_));
+void TrainControlResponse_PicMisc::SharedCtor() {
+  ::memset(&cmd_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&arg2_) -
+      reinterpret_cast<char*>(&cmd_)) + sizeof(arg2_));
 }
 
-TrainControlResponse_LokDb_Lok::~TrainControlResponse_LokDb_Lok() {
-  // @@protoc_insertion_point(destructor:server.TrainControlResponse.LokDb.Lok)
+TrainControlResponse_PicMisc::~TrainControlResponse_PicMisc() {
+  // @@protoc_insertion_point(destructor:server.TrainControlResponse.PicMisc)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void TrainControlResponse_LokDb_Lok::SharedDtor() {
+void TrainControlResponse_PicMisc::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
-void TrainControlResponse_LokDb_Lok::ArenaDtor(void* object) {
-  TrainControlResponse_LokDb_Lok* _this = reinterpret_cast< TrainControlResponse_LokDb_Lok* >(object);
+void TrainControlResponse_PicMisc::ArenaDtor(void* object) {
+  TrainControlResponse_PicMisc* _this = reinterpret_cast< TrainControlResponse_PicMisc* >(object);
   (void)_this;
 }
-void TrainControlResponse_LokDb_Lok::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void TrainControlResponse_PicMisc::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void TrainControlResponse_LokDb_Lok::SetCachedSize(int size) const {
+void TrainControlResponse_PicMisc::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const TrainControlResponse_LokDb_Lok& TrainControlResponse_LokDb_Lok::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_LokDb_Lok_train_5fcontrol_2eproto.base);
+const TrainControlResponse_PicMisc& TrainControlResponse_PicMisc::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_PicMisc_train_5fcontrol_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void TrainControlResponse_LokDb_Lok::Clear() {
-// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.LokDb.Lok)
+void TrainControlResponse_PicMisc::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.PicMisc)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  function_.Clear();
+  more_arg_.Clear();
   cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    name_.ClearNonDefaultToEmpty();
-  }
-  if (cached_has_bits & 0x00000006u) {
-    ::memset(&id_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&address_) -
-        reinterpret_cast<char*>(&id_)) + sizeof(address_));
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&cmd_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&arg2_) -
+        reinterpret_cast<char*>(&cmd_)) + sizeof(arg2_));
   }
   _has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TrainControlResponse_LokDb_Lok::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TrainControlResponse_PicMisc::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
@@ -9851,43 +11021,51 @@ const char* TrainControlResponse_LokDb_Lok::_InternalParse(const char* ptr, ::PR
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // required int32 id = 30;
-      case 30:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 240)) {
-          _Internal::set_has_id(&has_bits);
-          id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+      // required int32 cmd = 38;
+      case 38:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
+          _Internal::set_has_cmd(&has_bits);
+          cmd_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // optional string name = 31;
-      case 31:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 250)) {
-          auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          #ifndef NDEBUG
-          ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "server.TrainControlResponse.LokDb.Lok.name");
-          #endif  // !NDEBUG
+      // required int32 status = 39;
+      case 39:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
+          _Internal::set_has_status(&has_bits);
+          status_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // optional int32 address = 32;
-      case 32:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 0)) {
-          _Internal::set_has_address(&has_bits);
-          address_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+      // required int32 arg1 = 40;
+      case 40:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 64)) {
+          _Internal::set_has_arg1(&has_bits);
+          arg1_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // repeated group Function = 33 { ... };
-      case 33:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 11)) {
+      // required int32 arg2 = 41;
+      case 41:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 72)) {
+          _Internal::set_has_arg2(&has_bits);
+          arg2_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated int32 more_arg = 42;
+      case 42:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 80)) {
           ptr -= 2;
           do {
             ptr += 2;
-            ptr = ctx->ParseGroup(_internal_add_function(), ptr, 267);
+            _internal_add_more_arg(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<267>(ptr));
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<336>(ptr));
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_more_arg(), ptr, ctx);
+          CHK_(ptr);
         } else goto handle_unusual;
         continue;
       default: {
@@ -9913,85 +11091,124 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_LokDb_Lok::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_PicMisc::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.LokDb.Lok)
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.PicMisc)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  // required int32 id = 30;
-  if (cached_has_bits & 0x00000002u) {
+  // required int32 cmd = 38;
+  if (cached_has_bits & 0x00000001u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(30, this->_internal_id(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(38, this->_internal_cmd(), target);
   }
 
-  // optional string name = 31;
-  if (cached_has_bits & 0x00000001u) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
-      "server.TrainControlResponse.LokDb.Lok.name");
-    target = stream->WriteStringMaybeAliased(
-        31, this->_internal_name(), target);
+  // required int32 status = 39;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(39, this->_internal_status(), target);
   }
 
-  // optional int32 address = 32;
+  // required int32 arg1 = 40;
   if (cached_has_bits & 0x00000004u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(32, this->_internal_address(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(40, this->_internal_arg1(), target);
+  }
+
+  // required int32 arg2 = 41;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(41, this->_internal_arg2(), target);
   }
 
-  // repeated group Function = 33 { ... };
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_function_size()); i < n; i++) {
+  // repeated int32 more_arg = 42;
+  for (int i = 0, n = this->_internal_more_arg_size(); i < n; i++) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteGroup(33, this->_internal_function(i), target, stream);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(42, this->_internal_more_arg(i), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.LokDb.Lok)
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.PicMisc)
   return target;
 }
 
-size_t TrainControlResponse_LokDb_Lok::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.LokDb.Lok)
+size_t TrainControlResponse_PicMisc::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:server.TrainControlResponse.PicMisc)
   size_t total_size = 0;
 
-  // required int32 id = 30;
-  if (_internal_has_id()) {
+  if (_internal_has_cmd()) {
+    // required int32 cmd = 38;
     total_size += 2 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_id());
+        this->_internal_cmd());
   }
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
 
-  // repeated group Function = 33 { ... };
-  total_size += 4UL * this->_internal_function_size();
-  for (const auto& msg : this->function_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(msg);
+  if (_internal_has_status()) {
+    // required int32 status = 39;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_status());
   }
 
-  // optional string name = 31;
-  cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
+  if (_internal_has_arg1()) {
+    // required int32 arg1 = 40;
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_arg1());
   }
 
-  // optional int32 address = 32;
-  if (cached_has_bits & 0x00000004u) {
+  if (_internal_has_arg2()) {
+    // required int32 arg2 = 41;
     total_size += 2 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_address());
+        this->_internal_arg2());
+  }
+
+  return total_size;
+}
+size_t TrainControlResponse_PicMisc::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.PicMisc)
+  size_t total_size = 0;
+
+  if (((_has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required int32 cmd = 38;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_cmd());
+
+    // required int32 status = 39;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_status());
+
+    // required int32 arg1 = 40;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_arg1());
+
+    // required int32 arg2 = 41;
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_arg2());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 more_arg = 42;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int32Size(this->more_arg_);
+    total_size += 2 *
+                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_more_arg_size());
+    total_size += data_size;
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -10003,162 +11220,177 @@ size_t TrainControlResponse_LokDb_Lok::ByteSizeLong() const {
   return total_size;
 }
 
-void TrainControlResponse_LokDb_Lok::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.LokDb.Lok)
+void TrainControlResponse_PicMisc::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.PicMisc)
   GOOGLE_DCHECK_NE(&from, this);
-  const TrainControlResponse_LokDb_Lok* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_LokDb_Lok>(
+  const TrainControlResponse_PicMisc* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_PicMisc>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.LokDb.Lok)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.PicMisc)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.LokDb.Lok)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.PicMisc)
     MergeFrom(*source);
   }
 }
 
-void TrainControlResponse_LokDb_Lok::MergeFrom(const TrainControlResponse_LokDb_Lok& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.LokDb.Lok)
+void TrainControlResponse_PicMisc::MergeFrom(const TrainControlResponse_PicMisc& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.PicMisc)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  function_.MergeFrom(from.function_);
+  more_arg_.MergeFrom(from.more_arg_);
   cached_has_bits = from._has_bits_[0];
-  if (cached_has_bits & 0x00000007u) {
+  if (cached_has_bits & 0x0000000fu) {
     if (cached_has_bits & 0x00000001u) {
-      _internal_set_name(from._internal_name());
+      cmd_ = from.cmd_;
     }
     if (cached_has_bits & 0x00000002u) {
-      id_ = from.id_;
+      status_ = from.status_;
     }
     if (cached_has_bits & 0x00000004u) {
-      address_ = from.address_;
+      arg1_ = from.arg1_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      arg2_ = from.arg2_;
     }
     _has_bits_[0] |= cached_has_bits;
   }
 }
 
-void TrainControlResponse_LokDb_Lok::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.LokDb.Lok)
+void TrainControlResponse_PicMisc::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.PicMisc)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void TrainControlResponse_LokDb_Lok::CopyFrom(const TrainControlResponse_LokDb_Lok& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.LokDb.Lok)
+void TrainControlResponse_PicMisc::CopyFrom(const TrainControlResponse_PicMisc& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.PicMisc)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TrainControlResponse_LokDb_Lok::IsInitialized() const {
+bool TrainControlResponse_PicMisc::IsInitialized() const {
   if (_Internal::MissingRequiredFields(_has_bits_)) return false;
-  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(function_)) return false;
   return true;
 }
 
-void TrainControlResponse_LokDb_Lok::InternalSwap(TrainControlResponse_LokDb_Lok* other) {
+void TrainControlResponse_PicMisc::InternalSwap(TrainControlResponse_PicMisc* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   swap(_has_bits_[0], other->_has_bits_[0]);
-  function_.InternalSwap(&other->function_);
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  more_arg_.InternalSwap(&other->more_arg_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TrainControlResponse_LokDb_Lok, address_)
-      + sizeof(TrainControlResponse_LokDb_Lok::address_)
-      - PROTOBUF_FIELD_OFFSET(TrainControlResponse_LokDb_Lok, id_)>(
-          reinterpret_cast<char*>(&id_),
-          reinterpret_cast<char*>(&other->id_));
+      PROTOBUF_FIELD_OFFSET(TrainControlResponse_PicMisc, arg2_)
+      + sizeof(TrainControlResponse_PicMisc::arg2_)
+      - PROTOBUF_FIELD_OFFSET(TrainControlResponse_PicMisc, cmd_)>(
+          reinterpret_cast<char*>(&cmd_),
+          reinterpret_cast<char*>(&other->cmd_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_LokDb_Lok::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_PicMisc::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void TrainControlResponse_LokDb::InitAsDefaultInstance() {
+void TrainControlResponse_ReflashPic::InitAsDefaultInstance() {
 }
-class TrainControlResponse_LokDb::_Internal {
+class TrainControlResponse_ReflashPic::_Internal {
  public:
+  using HasBits = decltype(std::declval<TrainControlResponse_ReflashPic>()._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
 };
 
-TrainControlResponse_LokDb::TrainControlResponse_LokDb(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  lok_(arena) {
+TrainControlResponse_ReflashPic::TrainControlResponse_ReflashPic(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.LokDb)
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.ReflashPic)
 }
-TrainControlResponse_LokDb::TrainControlResponse_LokDb(const TrainControlResponse_LokDb& from)
+TrainControlResponse_ReflashPic::TrainControlResponse_ReflashPic(const TrainControlResponse_ReflashPic& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
-      lok_(from.lok_) {
+      _has_bits_(from._has_bits_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.LokDb)
+  error_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (from._internal_has_error()) {
+    error_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_error(),
+      GetArena());
+  }
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.ReflashPic)
 }
 
-void TrainControlResponse_LokDb::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TrainControlResponse_LokDb_train_5fcontrol_2eproto.base);
+void TrainControlResponse_ReflashPic::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TrainControlResponse_ReflashPic_train_5fcontrol_2eproto.base);
+  error_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
-TrainControlResponse_LokDb::~TrainControlResponse_LokDb() {
-  // @@protoc_insertion_point(destructor:server.TrainControlResponse.LokDb)
+TrainControlResponse_ReflashPic::~TrainControlResponse_ReflashPic() {
+  // @@protoc_insertion_point(destructor:server.TrainControlResponse.ReflashPic)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void TrainControlResponse_LokDb::SharedDtor() {
+void TrainControlResponse_ReflashPic::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
+  error_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
-void TrainControlResponse_LokDb::ArenaDtor(void* object) {
-  TrainControlResponse_LokDb* _this = reinterpret_cast< TrainControlResponse_LokDb* >(object);
+void TrainControlResponse_ReflashPic::ArenaDtor(void* object) {
+  TrainControlResponse_ReflashPic* _this = reinterpret_cast< TrainControlResponse_ReflashPic* >(object);
   (void)_this;
 }
-void TrainControlResponse_LokDb::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void TrainControlResponse_ReflashPic::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void TrainControlResponse_LokDb::SetCachedSize(int size) const {
+void TrainControlResponse_ReflashPic::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const TrainControlResponse_LokDb& TrainControlResponse_LokDb::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_LokDb_train_5fcontrol_2eproto.base);
+const TrainControlResponse_ReflashPic& TrainControlResponse_ReflashPic::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_ReflashPic_train_5fcontrol_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void TrainControlResponse_LokDb::Clear() {
-// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.LokDb)
+void TrainControlResponse_ReflashPic::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.ReflashPic)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  lok_.Clear();
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    error_.ClearNonDefaultToEmpty();
+  }
+  _has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TrainControlResponse_LokDb::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TrainControlResponse_ReflashPic::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
     ::PROTOBUF_NAMESPACE_ID::uint32 tag;
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // repeated group Lok = 29 { ... };
-      case 29:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 235)) {
-          ptr -= 2;
-          do {
-            ptr += 2;
-            ptr = ctx->ParseGroup(_internal_add_lok(), ptr, 235);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<235>(ptr));
+      // optional string error = 44;
+      case 44:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+          auto str = _internal_mutable_error();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          #ifndef NDEBUG
+          ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "server.TrainControlResponse.ReflashPic.error");
+          #endif  // !NDEBUG
+          CHK_(ptr);
         } else goto handle_unusual;
         continue;
       default: {
@@ -10176,6 +11408,7 @@ const char* TrainControlResponse_LokDb::_InternalParse(const char* ptr, ::PROTOB
     }  // switch
   }  // while
 success:
+  _has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -10183,41 +11416,45 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_LokDb::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_ReflashPic::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.LokDb)
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.ReflashPic)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated group Lok = 29 { ... };
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_lok_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteGroup(29, this->_internal_lok(i), target, stream);
+  cached_has_bits = _has_bits_[0];
+  // optional string error = 44;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "server.TrainControlResponse.ReflashPic.error");
+    target = stream->WriteStringMaybeAliased(
+        44, this->_internal_error(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.LokDb)
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.ReflashPic)
   return target;
 }
-
-size_t TrainControlResponse_LokDb::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.LokDb)
+
+size_t TrainControlResponse_ReflashPic::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.ReflashPic)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated group Lok = 29 { ... };
-  total_size += 4UL * this->_internal_lok_size();
-  for (const auto& msg : this->lok_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(msg);
+  // optional string error = 44;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -10229,152 +11466,151 @@ size_t TrainControlResponse_LokDb::ByteSizeLong() const {
   return total_size;
 }
 
-void TrainControlResponse_LokDb::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.LokDb)
+void TrainControlResponse_ReflashPic::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.ReflashPic)
   GOOGLE_DCHECK_NE(&from, this);
-  const TrainControlResponse_LokDb* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_LokDb>(
+  const TrainControlResponse_ReflashPic* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_ReflashPic>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.LokDb)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.ReflashPic)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.LokDb)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.ReflashPic)
     MergeFrom(*source);
   }
 }
 
-void TrainControlResponse_LokDb::MergeFrom(const TrainControlResponse_LokDb& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.LokDb)
+void TrainControlResponse_ReflashPic::MergeFrom(const TrainControlResponse_ReflashPic& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.ReflashPic)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  lok_.MergeFrom(from.lok_);
+  if (from._internal_has_error()) {
+    _internal_set_error(from._internal_error());
+  }
 }
 
-void TrainControlResponse_LokDb::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.LokDb)
+void TrainControlResponse_ReflashPic::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.ReflashPic)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void TrainControlResponse_LokDb::CopyFrom(const TrainControlResponse_LokDb& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.LokDb)
+void TrainControlResponse_ReflashPic::CopyFrom(const TrainControlResponse_ReflashPic& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.ReflashPic)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TrainControlResponse_LokDb::IsInitialized() const {
-  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(lok_)) return false;
+bool TrainControlResponse_ReflashPic::IsInitialized() const {
   return true;
 }
 
-void TrainControlResponse_LokDb::InternalSwap(TrainControlResponse_LokDb* other) {
+void TrainControlResponse_ReflashPic::InternalSwap(TrainControlResponse_ReflashPic* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  lok_.InternalSwap(&other->lok_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  error_.Swap(&other->error_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_LokDb::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_ReflashPic::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void TrainControlResponse_PicMisc::InitAsDefaultInstance() {
+void TrainControlResponse_Cv::InitAsDefaultInstance() {
 }
-class TrainControlResponse_PicMisc::_Internal {
+class TrainControlResponse_Cv::_Internal {
  public:
-  using HasBits = decltype(std::declval<TrainControlResponse_PicMisc>()._has_bits_);
-  static void set_has_cmd(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<TrainControlResponse_Cv>()._has_bits_);
+  static void set_has_train_id(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
-  static void set_has_status(HasBits* has_bits) {
+  static void set_has_cv(HasBits* has_bits) {
     (*has_bits)[0] |= 2u;
   }
-  static void set_has_arg1(HasBits* has_bits) {
+  static void set_has_error_code(HasBits* has_bits) {
     (*has_bits)[0] |= 4u;
   }
-  static void set_has_arg2(HasBits* has_bits) {
+  static void set_has_value(HasBits* has_bits) {
     (*has_bits)[0] |= 8u;
   }
   static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
   }
 };
 
-TrainControlResponse_PicMisc::TrainControlResponse_PicMisc(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  more_arg_(arena) {
+TrainControlResponse_Cv::TrainControlResponse_Cv(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.PicMisc)
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.Cv)
 }
-TrainControlResponse_PicMisc::TrainControlResponse_PicMisc(const TrainControlResponse_PicMisc& from)
+TrainControlResponse_Cv::TrainControlResponse_Cv(const TrainControlResponse_Cv& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_),
-      more_arg_(from.more_arg_) {
+      _has_bits_(from._has_bits_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&cmd_, &from.cmd_,
-    static_cast<size_t>(reinterpret_cast<char*>(&arg2_) -
-    reinterpret_cast<char*>(&cmd_)) + sizeof(arg2_));
-  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.PicMisc)
+  ::memcpy(&train_id_, &from.train_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&value_) -
+    reinterpret_cast<char*>(&train_id_)) + sizeof(value_));
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.Cv)
 }
 
-void TrainControlResponse_PicMisc::SharedCtor() {
-  ::memset(&cmd_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&arg2_) -
-      reinterpret_cast<char*>(&cmd_)) + sizeof(arg2_));
+void TrainControlResponse_Cv::SharedCtor() {
+  ::memset(&train_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&value_) -
+      reinterpret_cast<char*>(&train_id_)) + sizeof(value_));
 }
 
-TrainControlResponse_PicMisc::~TrainControlResponse_PicMisc() {
-  // @@protoc_insertion_point(destructor:server.TrainControlResponse.PicMisc)
+TrainControlResponse_Cv::~TrainControlResponse_Cv() {
+  // @@protoc_insertion_point(destructor:server.TrainControlResponse.Cv)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void TrainControlResponse_PicMisc::SharedDtor() {
+void TrainControlResponse_Cv::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
 }
 
-void TrainControlResponse_PicMisc::ArenaDtor(void* object) {
-  TrainControlResponse_PicMisc* _this = reinterpret_cast< TrainControlResponse_PicMisc* >(object);
+void TrainControlResponse_Cv::ArenaDtor(void* object) {
+  TrainControlResponse_Cv* _this = reinterpret_cast< TrainControlResponse_Cv* >(object);
   (void)_this;
 }
-void TrainControlResponse_PicMisc::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void TrainControlResponse_Cv::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void TrainControlResponse_PicMisc::SetCachedSize(int size) const {
+void TrainControlResponse_Cv::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const TrainControlResponse_PicMisc& TrainControlResponse_PicMisc::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_PicMisc_train_5fcontrol_2eproto.base);
+const TrainControlResponse_Cv& TrainControlResponse_Cv::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_Cv_train_5fcontrol_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void TrainControlResponse_PicMisc::Clear() {
-// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.PicMisc)
+void TrainControlResponse_Cv::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.Cv)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  more_arg_.Clear();
   cached_has_bits = _has_bits_[0];
   if (cached_has_bits & 0x0000000fu) {
-    ::memset(&cmd_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&arg2_) -
-        reinterpret_cast<char*>(&cmd_)) + sizeof(arg2_));
+    ::memset(&train_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&value_) -
+        reinterpret_cast<char*>(&train_id_)) + sizeof(value_));
   }
   _has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TrainControlResponse_PicMisc::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TrainControlResponse_Cv::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
@@ -10383,50 +11619,35 @@ const char* TrainControlResponse_PicMisc::_InternalParse(const char* ptr, ::PROT
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // required int32 cmd = 38;
-      case 38:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
-          _Internal::set_has_cmd(&has_bits);
-          cmd_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // required int32 status = 39;
-      case 39:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
-          _Internal::set_has_status(&has_bits);
-          status_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+      // required int32 train_id = 46;
+      case 46:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 112)) {
+          _Internal::set_has_train_id(&has_bits);
+          train_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // required int32 arg1 = 40;
-      case 40:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 64)) {
-          _Internal::set_has_arg1(&has_bits);
-          arg1_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+      // required int32 cv = 47;
+      case 47:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 120)) {
+          _Internal::set_has_cv(&has_bits);
+          cv_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // required int32 arg2 = 41;
-      case 41:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 72)) {
-          _Internal::set_has_arg2(&has_bits);
-          arg2_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+      // optional int32 error_code = 48;
+      case 48:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 128)) {
+          _Internal::set_has_error_code(&has_bits);
+          error_code_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // repeated int32 more_arg = 42;
-      case 42:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 80)) {
-          ptr -= 2;
-          do {
-            ptr += 2;
-            _internal_add_more_arg(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<336>(ptr));
-        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_more_arg(), ptr, ctx);
+      // optional int32 value = 49;
+      case 49:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 136)) {
+          _Internal::set_has_value(&has_bits);
+          value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
@@ -10453,109 +11674,79 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_PicMisc::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_Cv::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.PicMisc)
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.Cv)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  // required int32 cmd = 38;
+  // required int32 train_id = 46;
   if (cached_has_bits & 0x00000001u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(38, this->_internal_cmd(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(46, this->_internal_train_id(), target);
   }
 
-  // required int32 status = 39;
+  // required int32 cv = 47;
   if (cached_has_bits & 0x00000002u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(39, this->_internal_status(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(47, this->_internal_cv(), target);
   }
 
-  // required int32 arg1 = 40;
+  // optional int32 error_code = 48;
   if (cached_has_bits & 0x00000004u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(40, this->_internal_arg1(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(48, this->_internal_error_code(), target);
   }
 
-  // required int32 arg2 = 41;
+  // optional int32 value = 49;
   if (cached_has_bits & 0x00000008u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(41, this->_internal_arg2(), target);
-  }
-
-  // repeated int32 more_arg = 42;
-  for (int i = 0, n = this->_internal_more_arg_size(); i < n; i++) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(42, this->_internal_more_arg(i), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(49, this->_internal_value(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.PicMisc)
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.Cv)
   return target;
 }
 
-size_t TrainControlResponse_PicMisc::RequiredFieldsByteSizeFallback() const {
-// @@protoc_insertion_point(required_fields_byte_size_fallback_start:server.TrainControlResponse.PicMisc)
+size_t TrainControlResponse_Cv::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:server.TrainControlResponse.Cv)
   size_t total_size = 0;
 
-  if (_internal_has_cmd()) {
-    // required int32 cmd = 38;
-    total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_cmd());
-  }
-
-  if (_internal_has_status()) {
-    // required int32 status = 39;
-    total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_status());
-  }
-
-  if (_internal_has_arg1()) {
-    // required int32 arg1 = 40;
+  if (_internal_has_train_id()) {
+    // required int32 train_id = 46;
     total_size += 2 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_arg1());
+        this->_internal_train_id());
   }
 
-  if (_internal_has_arg2()) {
-    // required int32 arg2 = 41;
+  if (_internal_has_cv()) {
+    // required int32 cv = 47;
     total_size += 2 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_arg2());
+        this->_internal_cv());
   }
 
   return total_size;
 }
-size_t TrainControlResponse_PicMisc::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.PicMisc)
-  size_t total_size = 0;
-
-  if (((_has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
-    // required int32 cmd = 38;
-    total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_cmd());
-
-    // required int32 status = 39;
-    total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_status());
+size_t TrainControlResponse_Cv::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.Cv)
+  size_t total_size = 0;
 
-    // required int32 arg1 = 40;
+  if (((_has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required int32 train_id = 46;
     total_size += 2 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_arg1());
+        this->_internal_train_id());
 
-    // required int32 arg2 = 41;
+    // required int32 cv = 47;
     total_size += 2 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_arg2());
+        this->_internal_cv());
 
   } else {
     total_size += RequiredFieldsByteSizeFallback();
@@ -10564,15 +11755,23 @@ size_t TrainControlResponse_PicMisc::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated int32 more_arg = 42;
-  {
-    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      Int32Size(this->more_arg_);
-    total_size += 2 *
-                  ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_more_arg_size());
-    total_size += data_size;
-  }
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x0000000cu) {
+    // optional int32 error_code = 48;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_error_code());
+    }
+
+    // optional int32 value = 49;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_value());
+    }
 
+  }
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -10582,160 +11781,164 @@ size_t TrainControlResponse_PicMisc::ByteSizeLong() const {
   return total_size;
 }
 
-void TrainControlResponse_PicMisc::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.PicMisc)
+void TrainControlResponse_Cv::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.Cv)
   GOOGLE_DCHECK_NE(&from, this);
-  const TrainControlResponse_PicMisc* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_PicMisc>(
+  const TrainControlResponse_Cv* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_Cv>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.PicMisc)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.Cv)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.PicMisc)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.Cv)
     MergeFrom(*source);
   }
 }
 
-void TrainControlResponse_PicMisc::MergeFrom(const TrainControlResponse_PicMisc& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.PicMisc)
+void TrainControlResponse_Cv::MergeFrom(const TrainControlResponse_Cv& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.Cv)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  more_arg_.MergeFrom(from.more_arg_);
   cached_has_bits = from._has_bits_[0];
   if (cached_has_bits & 0x0000000fu) {
     if (cached_has_bits & 0x00000001u) {
-      cmd_ = from.cmd_;
+      train_id_ = from.train_id_;
     }
     if (cached_has_bits & 0x00000002u) {
-      status_ = from.status_;
+      cv_ = from.cv_;
     }
     if (cached_has_bits & 0x00000004u) {
-      arg1_ = from.arg1_;
+      error_code_ = from.error_code_;
     }
     if (cached_has_bits & 0x00000008u) {
-      arg2_ = from.arg2_;
+      value_ = from.value_;
     }
     _has_bits_[0] |= cached_has_bits;
   }
 }
 
-void TrainControlResponse_PicMisc::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.PicMisc)
+void TrainControlResponse_Cv::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.Cv)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void TrainControlResponse_PicMisc::CopyFrom(const TrainControlResponse_PicMisc& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.PicMisc)
+void TrainControlResponse_Cv::CopyFrom(const TrainControlResponse_Cv& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.Cv)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TrainControlResponse_PicMisc::IsInitialized() const {
+bool TrainControlResponse_Cv::IsInitialized() const {
   if (_Internal::MissingRequiredFields(_has_bits_)) return false;
   return true;
 }
 
-void TrainControlResponse_PicMisc::InternalSwap(TrainControlResponse_PicMisc* other) {
+void TrainControlResponse_Cv::InternalSwap(TrainControlResponse_Cv* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   swap(_has_bits_[0], other->_has_bits_[0]);
-  more_arg_.InternalSwap(&other->more_arg_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TrainControlResponse_PicMisc, arg2_)
-      + sizeof(TrainControlResponse_PicMisc::arg2_)
-      - PROTOBUF_FIELD_OFFSET(TrainControlResponse_PicMisc, cmd_)>(
-          reinterpret_cast<char*>(&cmd_),
-          reinterpret_cast<char*>(&other->cmd_));
+      PROTOBUF_FIELD_OFFSET(TrainControlResponse_Cv, value_)
+      + sizeof(TrainControlResponse_Cv::value_)
+      - PROTOBUF_FIELD_OFFSET(TrainControlResponse_Cv, train_id_)>(
+          reinterpret_cast<char*>(&train_id_),
+          reinterpret_cast<char*>(&other->train_id_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_PicMisc::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_Cv::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void TrainControlResponse_ReflashPic::InitAsDefaultInstance() {
+void TrainControlResponse_WaitForChangeResponse::InitAsDefaultInstance() {
 }
-class TrainControlResponse_ReflashPic::_Internal {
+class TrainControlResponse_WaitForChangeResponse::_Internal {
  public:
-  using HasBits = decltype(std::declval<TrainControlResponse_ReflashPic>()._has_bits_);
-  static void set_has_error(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<TrainControlResponse_WaitForChangeResponse>()._has_bits_);
+  static void set_has_timestamp(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_id(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
 };
 
-TrainControlResponse_ReflashPic::TrainControlResponse_ReflashPic(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+TrainControlResponse_WaitForChangeResponse::TrainControlResponse_WaitForChangeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.ReflashPic)
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.WaitForChangeResponse)
 }
-TrainControlResponse_ReflashPic::TrainControlResponse_ReflashPic(const TrainControlResponse_ReflashPic& from)
+TrainControlResponse_WaitForChangeResponse::TrainControlResponse_WaitForChangeResponse(const TrainControlResponse_WaitForChangeResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
       _has_bits_(from._has_bits_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  error_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (from._internal_has_error()) {
-    error_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_error(),
-      GetArena());
-  }
-  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.ReflashPic)
+  ::memcpy(&id_, &from.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&timestamp_) -
+    reinterpret_cast<char*>(&id_)) + sizeof(timestamp_));
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.WaitForChangeResponse)
 }
 
-void TrainControlResponse_ReflashPic::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TrainControlResponse_ReflashPic_train_5fcontrol_2eproto.base);
-  error_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+void TrainControlResponse_WaitForChangeResponse::SharedCtor() {
+  ::memset(&id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&timestamp_) -
+      reinterpret_cast<char*>(&id_)) + sizeof(timestamp_));
 }
 
-TrainControlResponse_ReflashPic::~TrainControlResponse_ReflashPic() {
-  // @@protoc_insertion_point(destructor:server.TrainControlResponse.ReflashPic)
+TrainControlResponse_WaitForChangeResponse::~TrainControlResponse_WaitForChangeResponse() {
+  // @@protoc_insertion_point(destructor:server.TrainControlResponse.WaitForChangeResponse)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void TrainControlResponse_ReflashPic::SharedDtor() {
+void TrainControlResponse_WaitForChangeResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
-  error_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
-void TrainControlResponse_ReflashPic::ArenaDtor(void* object) {
-  TrainControlResponse_ReflashPic* _this = reinterpret_cast< TrainControlResponse_ReflashPic* >(object);
+void TrainControlResponse_WaitForChangeResponse::ArenaDtor(void* object) {
+  TrainControlResponse_WaitForChangeResponse* _this = reinterpret_cast< TrainControlResponse_WaitForChangeResponse* >(object);
   (void)_this;
 }
-void TrainControlResponse_ReflashPic::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void TrainControlResponse_WaitForChangeResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void TrainControlResponse_ReflashPic::SetCachedSize(int size) const {
+void TrainControlResponse_WaitForChangeResponse::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const TrainControlResponse_ReflashPic& TrainControlResponse_ReflashPic::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_ReflashPic_train_5fcontrol_2eproto.base);
+const TrainControlResponse_WaitForChangeResponse& TrainControlResponse_WaitForChangeResponse::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_WaitForChangeResponse_train_5fcontrol_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void TrainControlResponse_ReflashPic::Clear() {
-// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.ReflashPic)
+void TrainControlResponse_WaitForChangeResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.WaitForChangeResponse)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    error_.ClearNonDefaultToEmpty();
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&timestamp_) -
+        reinterpret_cast<char*>(&id_)) + sizeof(timestamp_));
   }
   _has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TrainControlResponse_ReflashPic::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TrainControlResponse_WaitForChangeResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
@@ -10744,14 +11947,19 @@ const char* TrainControlResponse_ReflashPic::_InternalParse(const char* ptr, ::P
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // optional string error = 44;
-      case 44:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
-          auto str = _internal_mutable_error();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          #ifndef NDEBUG
-          ::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "server.TrainControlResponse.ReflashPic.error");
-          #endif  // !NDEBUG
+      // required uint64 timestamp = 53;
+      case 53:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 168)) {
+          _Internal::set_has_timestamp(&has_bits);
+          timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional int32 id = 54;
+      case 54:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 176)) {
+          _Internal::set_has_id(&has_bits);
+          id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
@@ -10778,45 +11986,53 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_ReflashPic::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_WaitForChangeResponse::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.ReflashPic)
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.WaitForChangeResponse)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  // optional string error = 44;
+  // required uint64 timestamp = 53;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(53, this->_internal_timestamp(), target);
+  }
+
+  // optional int32 id = 54;
   if (cached_has_bits & 0x00000001u) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
-      "server.TrainControlResponse.ReflashPic.error");
-    target = stream->WriteStringMaybeAliased(
-        44, this->_internal_error(), target);
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(54, this->_internal_id(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.ReflashPic)
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.WaitForChangeResponse)
   return target;
 }
 
-size_t TrainControlResponse_ReflashPic::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.ReflashPic)
+size_t TrainControlResponse_WaitForChangeResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.WaitForChangeResponse)
   size_t total_size = 0;
 
+  // required uint64 timestamp = 53;
+  if (_internal_has_timestamp()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_timestamp());
+  }
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // optional string error = 44;
+  // optional int32 id = 54;
   cached_has_bits = _has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
     total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_error());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_id());
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -10828,189 +12044,155 @@ size_t TrainControlResponse_ReflashPic::ByteSizeLong() const {
   return total_size;
 }
 
-void TrainControlResponse_ReflashPic::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.ReflashPic)
+void TrainControlResponse_WaitForChangeResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.WaitForChangeResponse)
   GOOGLE_DCHECK_NE(&from, this);
-  const TrainControlResponse_ReflashPic* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_ReflashPic>(
+  const TrainControlResponse_WaitForChangeResponse* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_WaitForChangeResponse>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.ReflashPic)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.WaitForChangeResponse)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.ReflashPic)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.WaitForChangeResponse)
     MergeFrom(*source);
   }
 }
 
-void TrainControlResponse_ReflashPic::MergeFrom(const TrainControlResponse_ReflashPic& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.ReflashPic)
+void TrainControlResponse_WaitForChangeResponse::MergeFrom(const TrainControlResponse_WaitForChangeResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.WaitForChangeResponse)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_error()) {
-    _internal_set_error(from._internal_error());
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      id_ = from.id_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      timestamp_ = from.timestamp_;
+    }
+    _has_bits_[0] |= cached_has_bits;
   }
 }
 
-void TrainControlResponse_ReflashPic::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.ReflashPic)
+void TrainControlResponse_WaitForChangeResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.WaitForChangeResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void TrainControlResponse_ReflashPic::CopyFrom(const TrainControlResponse_ReflashPic& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.ReflashPic)
+void TrainControlResponse_WaitForChangeResponse::CopyFrom(const TrainControlResponse_WaitForChangeResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.WaitForChangeResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TrainControlResponse_ReflashPic::IsInitialized() const {
+bool TrainControlResponse_WaitForChangeResponse::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
   return true;
 }
 
-void TrainControlResponse_ReflashPic::InternalSwap(TrainControlResponse_ReflashPic* other) {
+void TrainControlResponse_WaitForChangeResponse::InternalSwap(TrainControlResponse_WaitForChangeResponse* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   swap(_has_bits_[0], other->_has_bits_[0]);
-  error_.Swap(&other->error_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TrainControlResponse_WaitForChangeResponse, timestamp_)
+      + sizeof(TrainControlResponse_WaitForChangeResponse::timestamp_)
+      - PROTOBUF_FIELD_OFFSET(TrainControlResponse_WaitForChangeResponse, id_)>(
+          reinterpret_cast<char*>(&id_),
+          reinterpret_cast<char*>(&other->id_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_ReflashPic::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_WaitForChangeResponse::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void TrainControlResponse_Cv::InitAsDefaultInstance() {
+void TrainControlResponse_Batch::InitAsDefaultInstance() {
 }
-class TrainControlResponse_Cv::_Internal {
+class TrainControlResponse_Batch::_Internal {
  public:
-  using HasBits = decltype(std::declval<TrainControlResponse_Cv>()._has_bits_);
-  static void set_has_train_id(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
-  static void set_has_cv(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
-  }
-  static void set_has_error_code(HasBits* has_bits) {
-    (*has_bits)[0] |= 4u;
-  }
-  static void set_has_value(HasBits* has_bits) {
-    (*has_bits)[0] |= 8u;
-  }
-  static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
-  }
 };
 
-TrainControlResponse_Cv::TrainControlResponse_Cv(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+TrainControlResponse_Batch::TrainControlResponse_Batch(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  response_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.Cv)
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.Batch)
 }
-TrainControlResponse_Cv::TrainControlResponse_Cv(const TrainControlResponse_Cv& from)
+TrainControlResponse_Batch::TrainControlResponse_Batch(const TrainControlResponse_Batch& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_) {
+      response_(from.response_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&train_id_, &from.train_id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&value_) -
-    reinterpret_cast<char*>(&train_id_)) + sizeof(value_));
-  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.Cv)
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.Batch)
 }
 
-void TrainControlResponse_Cv::SharedCtor() {
-  ::memset(&train_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&value_) -
-      reinterpret_cast<char*>(&train_id_)) + sizeof(value_));
+void TrainControlResponse_Batch::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TrainControlResponse_train_5fcontrol_2eproto.base);
 }
 
-TrainControlResponse_Cv::~TrainControlResponse_Cv() {
-  // @@protoc_insertion_point(destructor:server.TrainControlResponse.Cv)
+TrainControlResponse_Batch::~TrainControlResponse_Batch() {
+  // @@protoc_insertion_point(destructor:server.TrainControlResponse.Batch)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void TrainControlResponse_Cv::SharedDtor() {
+void TrainControlResponse_Batch::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
 }
 
-void TrainControlResponse_Cv::ArenaDtor(void* object) {
-  TrainControlResponse_Cv* _this = reinterpret_cast< TrainControlResponse_Cv* >(object);
+void TrainControlResponse_Batch::ArenaDtor(void* object) {
+  TrainControlResponse_Batch* _this = reinterpret_cast< TrainControlResponse_Batch* >(object);
   (void)_this;
 }
-void TrainControlResponse_Cv::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void TrainControlResponse_Batch::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void TrainControlResponse_Cv::SetCachedSize(int size) const {
+void TrainControlResponse_Batch::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const TrainControlResponse_Cv& TrainControlResponse_Cv::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_Cv_train_5fcontrol_2eproto.base);
+const TrainControlResponse_Batch& TrainControlResponse_Batch::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_train_5fcontrol_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void TrainControlResponse_Cv::Clear() {
-// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.Cv)
+void TrainControlResponse_Batch::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.Batch)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
-    ::memset(&train_id_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&value_) -
-        reinterpret_cast<char*>(&train_id_)) + sizeof(value_));
-  }
-  _has_bits_.Clear();
+  response_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TrainControlResponse_Cv::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TrainControlResponse_Batch::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  _Internal::HasBits has_bits{};
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
     ::PROTOBUF_NAMESPACE_ID::uint32 tag;
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // required int32 train_id = 46;
-      case 46:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 112)) {
-          _Internal::set_has_train_id(&has_bits);
-          train_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // required int32 cv = 47;
-      case 47:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 120)) {
-          _Internal::set_has_cv(&has_bits);
-          cv_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional int32 error_code = 48;
-      case 48:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 128)) {
-          _Internal::set_has_error_code(&has_bits);
-          error_code_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // optional int32 value = 49;
-      case 49:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 136)) {
-          _Internal::set_has_value(&has_bits);
-          value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
+      // repeated .server.TrainControlResponse response = 56;
+      case 56:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 194)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_response(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<450>(ptr));
         } else goto handle_unusual;
         continue;
       default: {
@@ -11028,7 +12210,6 @@ const char* TrainControlResponse_Cv::_InternalParse(const char* ptr, ::PROTOBUF_
     }  // switch
   }  // while
 success:
-  _has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -11036,104 +12217,43 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_Cv::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_Batch::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.Cv)
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.Batch)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
-  // required int32 train_id = 46;
-  if (cached_has_bits & 0x00000001u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(46, this->_internal_train_id(), target);
-  }
-
-  // required int32 cv = 47;
-  if (cached_has_bits & 0x00000002u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(47, this->_internal_cv(), target);
-  }
-
-  // optional int32 error_code = 48;
-  if (cached_has_bits & 0x00000004u) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(48, this->_internal_error_code(), target);
-  }
-
-  // optional int32 value = 49;
-  if (cached_has_bits & 0x00000008u) {
+  // repeated .server.TrainControlResponse response = 56;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_response_size()); i < n; i++) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(49, this->_internal_value(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(56, this->_internal_response(i), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.Cv)
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.Batch)
   return target;
 }
 
-size_t TrainControlResponse_Cv::RequiredFieldsByteSizeFallback() const {
-// @@protoc_insertion_point(required_fields_byte_size_fallback_start:server.TrainControlResponse.Cv)
-  size_t total_size = 0;
-
-  if (_internal_has_train_id()) {
-    // required int32 train_id = 46;
-    total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_train_id());
-  }
-
-  if (_internal_has_cv()) {
-    // required int32 cv = 47;
-    total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_cv());
-  }
-
-  return total_size;
-}
-size_t TrainControlResponse_Cv::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.Cv)
+size_t TrainControlResponse_Batch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.Batch)
   size_t total_size = 0;
 
-  if (((_has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
-    // required int32 train_id = 46;
-    total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_train_id());
-
-    // required int32 cv = 47;
-    total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_cv());
-
-  } else {
-    total_size += RequiredFieldsByteSizeFallback();
-  }
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x0000000cu) {
-    // optional int32 error_code = 48;
-    if (cached_has_bits & 0x00000004u) {
-      total_size += 2 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-          this->_internal_error_code());
-    }
-
-    // optional int32 value = 49;
-    if (cached_has_bits & 0x00000008u) {
-      total_size += 2 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-          this->_internal_value());
-    }
-
+  // repeated .server.TrainControlResponse response = 56;
+  total_size += 2UL * this->_internal_response_size();
+  for (const auto& msg : this->response_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -11143,164 +12263,161 @@ size_t TrainControlResponse_Cv::ByteSizeLong() const {
   return total_size;
 }
 
-void TrainControlResponse_Cv::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.Cv)
+void TrainControlResponse_Batch::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.Batch)
   GOOGLE_DCHECK_NE(&from, this);
-  const TrainControlResponse_Cv* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_Cv>(
+  const TrainControlResponse_Batch* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_Batch>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.Cv)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.Batch)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.Cv)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.Batch)
     MergeFrom(*source);
   }
 }
 
-void TrainControlResponse_Cv::MergeFrom(const TrainControlResponse_Cv& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.Cv)
+void TrainControlResponse_Batch::MergeFrom(const TrainControlResponse_Batch& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.Batch)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
-    if (cached_has_bits & 0x00000001u) {
-      train_id_ = from.train_id_;
-    }
-    if (cached_has_bits & 0x00000002u) {
-      cv_ = from.cv_;
-    }
-    if (cached_has_bits & 0x00000004u) {
-      error_code_ = from.error_code_;
-    }
-    if (cached_has_bits & 0x00000008u) {
-      value_ = from.value_;
-    }
-    _has_bits_[0] |= cached_has_bits;
-  }
+  response_.MergeFrom(from.response_);
 }
 
-void TrainControlResponse_Cv::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.Cv)
+void TrainControlResponse_Batch::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.Batch)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void TrainControlResponse_Cv::CopyFrom(const TrainControlResponse_Cv& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.Cv)
+void TrainControlResponse_Batch::CopyFrom(const TrainControlResponse_Batch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.Batch)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TrainControlResponse_Cv::IsInitialized() const {
-  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
+bool TrainControlResponse_Batch::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(response_)) return false;
   return true;
 }
 
-void TrainControlResponse_Cv::InternalSwap(TrainControlResponse_Cv* other) {
+void TrainControlResponse_Batch::InternalSwap(TrainControlResponse_Batch* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TrainControlResponse_Cv, value_)
-      + sizeof(TrainControlResponse_Cv::value_)
-      - PROTOBUF_FIELD_OFFSET(TrainControlResponse_Cv, train_id_)>(
-          reinterpret_cast<char*>(&train_id_),
-          reinterpret_cast<char*>(&other->train_id_));
+  response_.InternalSwap(&other->response_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_Cv::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_Batch::GetMetadata() const {
   return GetMetadataStatic();
 }
 
 
 // ===================================================================
 
-void TrainControlResponse_WaitForChangeResponse::InitAsDefaultInstance() {
+void TrainControlResponse_Change::InitAsDefaultInstance() {
 }
-class TrainControlResponse_WaitForChangeResponse::_Internal {
+class TrainControlResponse_Change::_Internal {
  public:
-  using HasBits = decltype(std::declval<TrainControlResponse_WaitForChangeResponse>()._has_bits_);
-  static void set_has_timestamp(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
+  using HasBits = decltype(std::declval<TrainControlResponse_Change>()._has_bits_);
+  static void set_has_seq(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
   static void set_has_id(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_fn_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_dir(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_speed(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_stop(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_ts(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
   }
   static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
   }
 };
 
-TrainControlResponse_WaitForChangeResponse::TrainControlResponse_WaitForChangeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+TrainControlResponse_Change::TrainControlResponse_Change(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.WaitForChangeResponse)
+  // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse.Change)
 }
-TrainControlResponse_WaitForChangeResponse::TrainControlResponse_WaitForChangeResponse(const TrainControlResponse_WaitForChangeResponse& from)
+TrainControlResponse_Change::TrainControlResponse_Change(const TrainControlResponse_Change& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
       _has_bits_(from._has_bits_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&id_, &from.id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&timestamp_) -
-    reinterpret_cast<char*>(&id_)) + sizeof(timestamp_));
-  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.WaitForChangeResponse)
+  ::memcpy(&seq_, &from.seq_,
+    static_cast<size_t>(reinterpret_cast<char*>(&ts_) -
+    reinterpret_cast<char*>(&seq_)) + sizeof(ts_));
+  // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse.Change)
 }
-
-void TrainControlResponse_WaitForChangeResponse::SharedCtor() {
-  ::memset(&id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&timestamp_) -
-      reinterpret_cast<char*>(&id_)) + sizeof(timestamp_));
+
+void TrainControlResponse_Change::SharedCtor() {
+  ::memset(&seq_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&ts_) -
+      reinterpret_cast<char*>(&seq_)) + sizeof(ts_));
 }
 
-TrainControlResponse_WaitForChangeResponse::~TrainControlResponse_WaitForChangeResponse() {
-  // @@protoc_insertion_point(destructor:server.TrainControlResponse.WaitForChangeResponse)
+TrainControlResponse_Change::~TrainControlResponse_Change() {
+  // @@protoc_insertion_point(destructor:server.TrainControlResponse.Change)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void TrainControlResponse_WaitForChangeResponse::SharedDtor() {
+void TrainControlResponse_Change::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
 }
 
-void TrainControlResponse_WaitForChangeResponse::ArenaDtor(void* object) {
-  TrainControlResponse_WaitForChangeResponse* _this = reinterpret_cast< TrainControlResponse_WaitForChangeResponse* >(object);
+void TrainControlResponse_Change::ArenaDtor(void* object) {
+  TrainControlResponse_Change* _this = reinterpret_cast< TrainControlResponse_Change* >(object);
   (void)_this;
 }
-void TrainControlResponse_WaitForChangeResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void TrainControlResponse_Change::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void TrainControlResponse_WaitForChangeResponse::SetCachedSize(int size) const {
+void TrainControlResponse_Change::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const TrainControlResponse_WaitForChangeResponse& TrainControlResponse_WaitForChangeResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_WaitForChangeResponse_train_5fcontrol_2eproto.base);
+const TrainControlResponse_Change& TrainControlResponse_Change::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TrainControlResponse_Change_train_5fcontrol_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void TrainControlResponse_WaitForChangeResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.WaitForChangeResponse)
+void TrainControlResponse_Change::Clear() {
+// @@protoc_insertion_point(message_clear_start:server.TrainControlResponse.Change)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    ::memset(&id_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&timestamp_) -
-        reinterpret_cast<char*>(&id_)) + sizeof(timestamp_));
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&seq_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&ts_) -
+        reinterpret_cast<char*>(&seq_)) + sizeof(ts_));
   }
   _has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TrainControlResponse_WaitForChangeResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TrainControlResponse_Change::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
@@ -11309,22 +12426,70 @@ const char* TrainControlResponse_WaitForChangeResponse::_InternalParse(const cha
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // required uint64 timestamp = 53;
-      case 53:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 168)) {
-          _Internal::set_has_timestamp(&has_bits);
-          timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+      // required uint64 seq = 58;
+      case 58:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 208)) {
+          _Internal::set_has_seq(&has_bits);
+          seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // optional int32 id = 54;
-      case 54:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 176)) {
+      // optional int32 id = 59;
+      case 59:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 216)) {
           _Internal::set_has_id(&has_bits);
           id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
+      // optional int32 fn_id = 60;
+      case 60:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 224)) {
+          _Internal::set_has_fn_id(&has_bits);
+          fn_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional int32 value = 61;
+      case 61:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 232)) {
+          _Internal::set_has_value(&has_bits);
+          value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional int32 dir = 62;
+      case 62:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 240)) {
+          _Internal::set_has_dir(&has_bits);
+          dir_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional int32 speed = 63;
+      case 63:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 248)) {
+          _Internal::set_has_speed(&has_bits);
+          speed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional bool stop = 64;
+      case 64:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 0)) {
+          _Internal::set_has_stop(&has_bits);
+          stop_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // optional uint64 ts = 65;
+      case 65:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          _Internal::set_has_ts(&has_bits);
+          ts_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -11348,55 +12513,133 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_WaitForChangeResponse::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* TrainControlResponse_Change::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.WaitForChangeResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:server.TrainControlResponse.Change)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  // required uint64 timestamp = 53;
+  // required uint64 seq = 58;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(58, this->_internal_seq(), target);
+  }
+
+  // optional int32 id = 59;
   if (cached_has_bits & 0x00000002u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(53, this->_internal_timestamp(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(59, this->_internal_id(), target);
   }
 
-  // optional int32 id = 54;
-  if (cached_has_bits & 0x00000001u) {
+  // optional int32 fn_id = 60;
+  if (cached_has_bits & 0x00000004u) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(54, this->_internal_id(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(60, this->_internal_fn_id(), target);
+  }
+
+  // optional int32 value = 61;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(61, this->_internal_value(), target);
+  }
+
+  // optional int32 dir = 62;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(62, this->_internal_dir(), target);
+  }
+
+  // optional int32 speed = 63;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(63, this->_internal_speed(), target);
+  }
+
+  // optional bool stop = 64;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(64, this->_internal_stop(), target);
+  }
+
+  // optional uint64 ts = 65;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(65, this->_internal_ts(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.WaitForChangeResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:server.TrainControlResponse.Change)
   return target;
 }
 
-size_t TrainControlResponse_WaitForChangeResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.WaitForChangeResponse)
+size_t TrainControlResponse_Change::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:server.TrainControlResponse.Change)
   size_t total_size = 0;
 
-  // required uint64 timestamp = 53;
-  if (_internal_has_timestamp()) {
+  // required uint64 seq = 58;
+  if (_internal_has_seq()) {
     total_size += 2 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
-        this->_internal_timestamp());
+        this->_internal_seq());
   }
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // optional int32 id = 54;
   cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_id());
-  }
+  if (cached_has_bits & 0x000000feu) {
+    // optional int32 id = 59;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_id());
+    }
+
+    // optional int32 fn_id = 60;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_fn_id());
+    }
+
+    // optional int32 value = 61;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_value());
+    }
+
+    // optional int32 dir = 62;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_dir());
+    }
+
+    // optional int32 speed = 63;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+          this->_internal_speed());
+    }
+
+    // optional bool stop = 64;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 2 + 1;
+    }
+
+    // optional uint64 ts = 65;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+          this->_internal_ts());
+    }
 
+  }
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -11406,72 +12649,90 @@ size_t TrainControlResponse_WaitForChangeResponse::ByteSizeLong() const {
   return total_size;
 }
 
-void TrainControlResponse_WaitForChangeResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.WaitForChangeResponse)
+void TrainControlResponse_Change::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:server.TrainControlResponse.Change)
   GOOGLE_DCHECK_NE(&from, this);
-  const TrainControlResponse_WaitForChangeResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_WaitForChangeResponse>(
+  const TrainControlResponse_Change* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TrainControlResponse_Change>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.WaitForChangeResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:server.TrainControlResponse.Change)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.WaitForChangeResponse)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:server.TrainControlResponse.Change)
     MergeFrom(*source);
   }
 }
 
-void TrainControlResponse_WaitForChangeResponse::MergeFrom(const TrainControlResponse_WaitForChangeResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.WaitForChangeResponse)
+void TrainControlResponse_Change::MergeFrom(const TrainControlResponse_Change& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:server.TrainControlResponse.Change)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = from._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
+  if (cached_has_bits & 0x000000ffu) {
     if (cached_has_bits & 0x00000001u) {
-      id_ = from.id_;
+      seq_ = from.seq_;
     }
     if (cached_has_bits & 0x00000002u) {
-      timestamp_ = from.timestamp_;
+      id_ = from.id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      fn_id_ = from.fn_id_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      value_ = from.value_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      dir_ = from.dir_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      speed_ = from.speed_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      stop_ = from.stop_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      ts_ = from.ts_;
     }
     _has_bits_[0] |= cached_has_bits;
   }
 }
 
-void TrainControlResponse_WaitForChangeResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.WaitForChangeResponse)
+void TrainControlResponse_Change::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:server.TrainControlResponse.Change)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void TrainControlResponse_WaitForChangeResponse::CopyFrom(const TrainControlResponse_WaitForChangeResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.WaitForChangeResponse)
+void TrainControlResponse_Change::CopyFrom(const TrainControlResponse_Change& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:server.TrainControlResponse.Change)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TrainControlResponse_WaitForChangeResponse::IsInitialized() const {
+bool TrainControlResponse_Change::IsInitialized() const {
   if (_Internal::MissingRequiredFields(_has_bits_)) return false;
   return true;
 }
 
-void TrainControlResponse_WaitForChangeResponse::InternalSwap(TrainControlResponse_WaitForChangeResponse* other) {
+void TrainControlResponse_Change::InternalSwap(TrainControlResponse_Change* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   swap(_has_bits_[0], other->_has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TrainControlResponse_WaitForChangeResponse, timestamp_)
-      + sizeof(TrainControlResponse_WaitForChangeResponse::timestamp_)
-      - PROTOBUF_FIELD_OFFSET(TrainControlResponse_WaitForChangeResponse, id_)>(
-          reinterpret_cast<char*>(&id_),
-          reinterpret_cast<char*>(&other->id_));
+      PROTOBUF_FIELD_OFFSET(TrainControlResponse_Change, ts_)
+      + sizeof(TrainControlResponse_Change::ts_)
+      - PROTOBUF_FIELD_OFFSET(TrainControlResponse_Change, seq_)>(
+          reinterpret_cast<char*>(&seq_),
+          reinterpret_cast<char*>(&other->seq_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_WaitForChangeResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata TrainControlResponse_Change::GetMetadata() const {
   return GetMetadataStatic();
 }
 
@@ -11505,6 +12766,8 @@ void TrainControlResponse::InitAsDefaultInstance() {
       ::server::TrainControlResponse_Cv::internal_default_instance());
   ::server::_TrainControlResponse_default_instance_._instance.get_mutable()->waitforchangeresponse_ = const_cast< ::server::TrainControlResponse_WaitForChangeResponse*>(
       ::server::TrainControlResponse_WaitForChangeResponse::internal_default_instance());
+  ::server::_TrainControlResponse_default_instance_._instance.get_mutable()->batch_ = const_cast< ::server::TrainControlResponse_Batch*>(
+      ::server::TrainControlResponse_Batch::internal_default_instance());
 }
 class TrainControlResponse::_Internal {
  public:
@@ -11561,6 +12824,13 @@ class TrainControlResponse::_Internal {
   static void set_has_waitforchangeresponse(HasBits* has_bits) {
     (*has_bits)[0] |= 4096u;
   }
+  static const ::server::TrainControlResponse_Batch& batch(const TrainControlResponse* msg);
+  static void set_has_batch(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_snapshot_seq(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
 };
 
 const ::server::TrainControlResponse_Speed&
@@ -11615,9 +12885,14 @@ const ::server::TrainControlResponse_WaitForChangeResponse&
 TrainControlResponse::_Internal::waitforchangeresponse(const TrainControlResponse* msg) {
   return *msg->waitforchangeresponse_;
 }
+const ::server::TrainControlResponse_Batch&
+TrainControlResponse::_Internal::batch(const TrainControlResponse* msg) {
+  return *msg->batch_;
+}
 TrainControlResponse::TrainControlResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  lokstate_(arena) {
+  lokstate_(arena),
+  change_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
   // @@protoc_insertion_point(arena_constructor:server.TrainControlResponse)
@@ -11625,7 +12900,8 @@ TrainControlResponse::TrainControlResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena
 TrainControlResponse::TrainControlResponse(const TrainControlResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
       _has_bits_(from._has_bits_),
-      lokstate_(from.lokstate_) {
+      lokstate_(from.lokstate_),
+      change_(from.change_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_speed()) {
     speed_ = new ::server::TrainControlResponse_Speed(*from.speed_);
@@ -11692,14 +12968,20 @@ TrainControlResponse::TrainControlResponse(const TrainControlResponse& from)
   } else {
     waitforchangeresponse_ = nullptr;
   }
+  if (from._internal_has_batch()) {
+    batch_ = new ::server::TrainControlResponse_Batch(*from.batch_);
+  } else {
+    batch_ = nullptr;
+  }
+  snapshot_seq_ = from.snapshot_seq_;
   // @@protoc_insertion_point(copy_constructor:server.TrainControlResponse)
 }
 
 void TrainControlResponse::SharedCtor() {
   ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TrainControlResponse_train_5fcontrol_2eproto.base);
   ::memset(&speed_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&waitforchangeresponse_) -
-      reinterpret_cast<char*>(&speed_)) + sizeof(waitforchangeresponse_));
+      reinterpret_cast<char*>(&snapshot_seq_) -
+      reinterpret_cast<char*>(&speed_)) + sizeof(snapshot_seq_));
 }
 
 TrainControlResponse::~TrainControlResponse() {
@@ -11723,6 +13005,7 @@ void TrainControlResponse::SharedDtor() {
   if (this != internal_default_instance()) delete reflashpic_;
   if (this != internal_default_instance()) delete cv_;
   if (this != internal_default_instance()) delete waitforchangeresponse_;
+  if (this != internal_default_instance()) delete batch_;
 }
 
 void TrainControlResponse::ArenaDtor(void* object) {
@@ -11747,6 +13030,7 @@ void TrainControlResponse::Clear() {
   (void) cached_has_bits;
 
   lokstate_.Clear();
+  change_.Clear();
   cached_has_bits = _has_bits_[0];
   if (cached_has_bits & 0x000000ffu) {
     if (cached_has_bits & 0x00000001u) {
@@ -11782,7 +13066,7 @@ void TrainControlResponse::Clear() {
       reflashautomata_->Clear();
     }
   }
-  if (cached_has_bits & 0x00001f00u) {
+  if (cached_has_bits & 0x00003f00u) {
     if (cached_has_bits & 0x00000100u) {
       GOOGLE_DCHECK(lokdb_ != nullptr);
       lokdb_->Clear();
@@ -11803,7 +13087,12 @@ void TrainControlResponse::Clear() {
       GOOGLE_DCHECK(waitforchangeresponse_ != nullptr);
       waitforchangeresponse_->Clear();
     }
+    if (cached_has_bits & 0x00002000u) {
+      GOOGLE_DCHECK(batch_ != nullptr);
+      batch_->Clear();
+    }
   }
+  snapshot_seq_ = PROTOBUF_ULONGLONG(0);
   _has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -11920,6 +13209,33 @@ const char* TrainControlResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAM
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
+      // optional group Batch = 55 { ... };
+      case 55:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 187)) {
+          ptr = ctx->ParseGroup(_internal_mutable_batch(), ptr, 443);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated group Change = 57 { ... };
+      case 57:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 203)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseGroup(_internal_add_change(), ptr, 459);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<459>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // optional uint64 snapshot_seq = 66;
+      case 66:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          _Internal::set_has_snapshot_seq(&has_bits);
+          snapshot_seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -12062,6 +13378,28 @@ failure:
         52, _Internal::waitforchangeresponse(this), target, stream);
   }
 
+  // optional group Batch = 55 { ... };
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(
+        55, _Internal::batch(this), target, stream);
+  }
+
+  // repeated group Change = 57 { ... };
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_change_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteGroup(57, this->_internal_change(i), target, stream);
+  }
+
+  // optional uint64 snapshot_seq = 66;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(66, this->_internal_snapshot_seq(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -12085,6 +13423,13 @@ size_t TrainControlResponse::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  // repeated group Change = 57 { ... };
+  total_size += 4UL * this->_internal_change_size();
+  for (const auto& msg : this->change_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(msg);
+  }
+
   cached_has_bits = _has_bits_[0];
   if (cached_has_bits & 0x000000ffu) {
     // optional group Speed = 1 { ... };
@@ -12144,7 +13489,7 @@ size_t TrainControlResponse::ByteSizeLong() const {
     }
 
   }
-  if (cached_has_bits & 0x00001f00u) {
+  if (cached_has_bits & 0x00007f00u) {
     // optional group LokDb = 28 { ... };
     if (cached_has_bits & 0x00000100u) {
       total_size += 4 +
@@ -12180,6 +13525,20 @@ size_t TrainControlResponse::ByteSizeLong() const {
           *waitforchangeresponse_);
     }
 
+    // optional group Batch = 55 { ... };
+    if (cached_has_bits & 0x00002000u) {
+      total_size += 4 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GroupSize(
+          *batch_);
+    }
+
+    // optional uint64 snapshot_seq = 66;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+          this->_internal_snapshot_seq());
+    }
+
   }
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
@@ -12213,6 +13572,7 @@ void TrainControlResponse::MergeFrom(const TrainControlResponse& from) {
   (void) cached_has_bits;
 
   lokstate_.MergeFrom(from.lokstate_);
+  change_.MergeFrom(from.change_);
   cached_has_bits = from._has_bits_[0];
   if (cached_has_bits & 0x000000ffu) {
     if (cached_has_bits & 0x00000001u) {
@@ -12240,7 +13600,7 @@ void TrainControlResponse::MergeFrom(const TrainControlResponse& from) {
       _internal_mutable_reflashautomata()->::server::TrainControlResponse_ReflashAutomata::MergeFrom(from._internal_reflashautomata());
     }
   }
-  if (cached_has_bits & 0x00001f00u) {
+  if (cached_has_bits & 0x00007f00u) {
     if (cached_has_bits & 0x00000100u) {
       _internal_mutable_lokdb()->::server::TrainControlResponse_LokDb::MergeFrom(from._internal_lokdb());
     }
@@ -12256,6 +13616,13 @@ void TrainControlResponse::MergeFrom(const TrainControlResponse& from) {
     if (cached_has_bits & 0x00001000u) {
       _internal_mutable_waitforchangeresponse()->::server::TrainControlResponse_WaitForChangeResponse::MergeFrom(from._internal_waitforchangeresponse());
     }
+    if (cached_has_bits & 0x00002000u) {
+      _internal_mutable_batch()->::server::TrainControlResponse_Batch::MergeFrom(from._internal_batch());
+    }
+    if (cached_has_bits & 0x00004000u) {
+      snapshot_seq_ = from.snapshot_seq_;
+    }
+    _has_bits_[0] |= cached_has_bits;
   }
 }
 
@@ -12275,6 +13642,7 @@ void TrainControlResponse::CopyFrom(const TrainControlResponse& from) {
 
 bool TrainControlResponse::IsInitialized() const {
   if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(lokstate_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(change_)) return false;
   if (_internal_has_speed()) {
     if (!speed_->IsInitialized()) return false;
   }
@@ -12305,6 +13673,9 @@ bool TrainControlResponse::IsInitialized() const {
   if (_internal_has_waitforchangeresponse()) {
     if (!waitforchangeresponse_->IsInitialized()) return false;
   }
+  if (_internal_has_batch()) {
+    if (!batch_->IsInitialized()) return false;
+  }
   return true;
 }
 
@@ -12313,9 +13684,10 @@ void TrainControlResponse::InternalSwap(TrainControlResponse* other) {
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   swap(_has_bits_[0], other->_has_bits_[0]);
   lokstate_.InternalSwap(&other->lokstate_);
+  change_.InternalSwap(&other->change_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TrainControlResponse, waitforchangeresponse_)
-      + sizeof(TrainControlResponse::waitforchangeresponse_)
+      PROTOBUF_FIELD_OFFSET(TrainControlResponse, snapshot_seq_)
+      + sizeof(TrainControlResponse::snapshot_seq_)
       - PROTOBUF_FIELD_OFFSET(TrainControlResponse, speed_)>(
           reinterpret_cast<char*>(&speed_),
           reinterpret_cast<char*>(&other->speed_));
@@ -13032,6 +14404,12 @@ template<> PROTOBUF_NOINLINE ::server::TrainControlRequest_DoGetOrSetCV* Arena::
 template<> PROTOBUF_NOINLINE ::server::TrainControlRequest_DoWaitForChange* Arena::CreateMaybeMessage< ::server::TrainControlRequest_DoWaitForChange >(Arena* arena) {
   return Arena::CreateMessageInternal< ::server::TrainControlRequest_DoWaitForChange >(arena);
 }
+template<> PROTOBUF_NOINLINE ::server::TrainControlRequest_DoBatch* Arena::CreateMaybeMessage< ::server::TrainControlRequest_DoBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::server::TrainControlRequest_DoBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::server::TrainControlRequest_DoSubscribe* Arena::CreateMaybeMessage< ::server::TrainControlRequest_DoSubscribe >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::server::TrainControlRequest_DoSubscribe >(arena);
+}
 template<> PROTOBUF_NOINLINE ::server::TrainControlRequest* Arena::CreateMaybeMessage< ::server::TrainControlRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::server::TrainControlRequest >(arena);
 }
@@ -13080,6 +14458,12 @@ template<> PROTOBUF_NOINLINE ::server::TrainControlResponse_Cv* Arena::CreateMay
 template<> PROTOBUF_NOINLINE ::server::TrainControlResponse_WaitForChangeResponse* Arena::CreateMaybeMessage< ::server::TrainControlResponse_WaitForChangeResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::server::TrainControlResponse_WaitForChangeResponse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::server::TrainControlResponse_Batch* Arena::CreateMaybeMessage< ::server::TrainControlResponse_Batch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::server::TrainControlResponse_Batch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::server::TrainControlResponse_Change* Arena::CreateMaybeMessage< ::server::TrainControlResponse_Change >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::server::TrainControlResponse_Change >(arena);
+}
 template<> PROTOBUF_NOINLINE ::server::TrainControlResponse* Arena::CreateMaybeMessage< ::server::TrainControlResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::server::TrainControlResponse >(arena);
 }
@@ -47,7 +47,7 @@ struct TableStruct_train_5fcontrol_2eproto {
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[38]
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[42]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
   static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
@@ -70,6 +70,9 @@ extern TinyRpcResponseDefaultTypeInternal _TinyRpcResponse_default_instance_;
 class TrainControlRequest;
 class TrainControlRequestDefaultTypeInternal;
 extern TrainControlRequestDefaultTypeInternal _TrainControlRequest_default_instance_;
+class TrainControlRequest_DoBatch;
+class TrainControlRequest_DoBatchDefaultTypeInternal;
+extern TrainControlRequest_DoBatchDefaultTypeInternal _TrainControlRequest_DoBatch_default_instance_;
 class TrainControlRequest_DoChangeSavedState;
 class TrainControlRequest_DoChangeSavedStateDefaultTypeInternal;
 extern TrainControlRequest_DoChangeSavedStateDefaultTypeInternal _TrainControlRequest_DoChangeSavedState_default_instance_;
@@ -118,6 +121,9 @@ extern TrainControlRequest_DoSetEmergencyStopDefaultTypeInternal _TrainControlRe
 class TrainControlRequest_DoSetSpeed;
 class TrainControlRequest_DoSetSpeedDefaultTypeInternal;
 extern TrainControlRequest_DoSetSpeedDefaultTypeInternal _TrainControlRequest_DoSetSpeed_default_instance_;
+class TrainControlRequest_DoSubscribe;
+class TrainControlRequest_DoSubscribeDefaultTypeInternal;
+extern TrainControlRequest_DoSubscribeDefaultTypeInternal _TrainControlRequest_DoSubscribe_default_instance_;
 class TrainControlRequest_DoWaitForChange;
 class TrainControlRequest_DoWaitForChangeDefaultTypeInternal;
 extern TrainControlRequest_DoWaitForChangeDefaultTypeInternal _TrainControlRequest_DoWaitForChange_default_instance_;
@@ -127,6 +133,12 @@ extern TrainControlResponseDefaultTypeInternal _TrainControlResponse_default_ins
 class TrainControlResponse_Accessory;
 class TrainControlResponse_AccessoryDefaultTypeInternal;
 extern TrainControlResponse_AccessoryDefaultTypeInternal _TrainControlResponse_Accessory_default_instance_;
+class TrainControlResponse_Batch;
+class TrainControlResponse_BatchDefaultTypeInternal;
+extern TrainControlResponse_BatchDefaultTypeInternal _TrainControlResponse_Batch_default_instance_;
+class TrainControlResponse_Change;
+class TrainControlResponse_ChangeDefaultTypeInternal;
+extern TrainControlResponse_ChangeDefaultTypeInternal _TrainControlResponse_Change_default_instance_;
 class TrainControlResponse_CurrentAddress;
 class TrainControlResponse_CurrentAddressDefaultTypeInternal;
 extern TrainControlResponse_CurrentAddressDefaultTypeInternal _TrainControlResponse_CurrentAddress_default_instance_;
@@ -176,6 +188,7 @@ template<> ::server::LokStateProto_Function* Arena::CreateMaybeMessage<::server:
 template<> ::server::TinyRpcRequest* Arena::CreateMaybeMessage<::server::TinyRpcRequest>(Arena*);
 template<> ::server::TinyRpcResponse* Arena::CreateMaybeMessage<::server::TinyRpcResponse>(Arena*);
 template<> ::server::TrainControlRequest* Arena::CreateMaybeMessage<::server::TrainControlRequest>(Arena*);
+template<> ::server::TrainControlRequest_DoBatch* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoBatch>(Arena*);
 template<> ::server::TrainControlRequest_DoChangeSavedState* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoChangeSavedState>(Arena*);
 template<> ::server::TrainControlRequest_DoDropState* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoDropState>(Arena*);
 template<> ::server::TrainControlRequest_DoEStopLoco* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoEStopLoco>(Arena*);
@@ -192,9 +205,12 @@ template<> ::server::TrainControlRequest_DoSendRawCanPacket* Arena::CreateMaybeM
 template<> ::server::TrainControlRequest_DoSetAccessory* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoSetAccessory>(Arena*);
 template<> ::server::TrainControlRequest_DoSetEmergencyStop* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoSetEmergencyStop>(Arena*);
 template<> ::server::TrainControlRequest_DoSetSpeed* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoSetSpeed>(Arena*);
+template<> ::server::TrainControlRequest_DoSubscribe* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoSubscribe>(Arena*);
 template<> ::server::TrainControlRequest_DoWaitForChange* Arena::CreateMaybeMessage<::server::TrainControlRequest_DoWaitForChange>(Arena*);
 template<> ::server::TrainControlResponse* Arena::CreateMaybeMessage<::server::TrainControlResponse>(Arena*);
 template<> ::server::TrainControlResponse_Accessory* Arena::CreateMaybeMessage<::server::TrainControlResponse_Accessory>(Arena*);
+template<> ::server::TrainControlResponse_Batch* Arena::CreateMaybeMessage<::server::TrainControlResponse_Batch>(Arena*);
+template<> ::server::TrainControlResponse_Change* Arena::CreateMaybeMessage<::server::TrainControlResponse_Change>(Arena*);
 template<> ::server::TrainControlResponse_CurrentAddress* Arena::CreateMaybeMessage<::server::TrainControlResponse_CurrentAddress>(Arena*);
 template<> ::server::TrainControlResponse_Cv* Arena::CreateMaybeMessage<::server::TrainControlResponse_Cv>(Arena*);
 template<> ::server::TrainControlResponse_EmergencyStop* Arena::CreateMaybeMessage<::server::TrainControlResponse_EmergencyStop>(Arena*);
@@ -3496,6 +3512,308 @@ class TrainControlRequest_DoWaitForChange PROTOBUF_FINAL :
 };
 // -------------------------------------------------------------------
 
+class TrainControlRequest_DoBatch PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoBatch) */ {
+ public:
+  inline TrainControlRequest_DoBatch() : TrainControlRequest_DoBatch(nullptr) {};
+  virtual ~TrainControlRequest_DoBatch();
+
+  TrainControlRequest_DoBatch(const TrainControlRequest_DoBatch& from);
+  TrainControlRequest_DoBatch(TrainControlRequest_DoBatch&& from) noexcept
+    : TrainControlRequest_DoBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline TrainControlRequest_DoBatch& operator=(const TrainControlRequest_DoBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TrainControlRequest_DoBatch& operator=(TrainControlRequest_DoBatch&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TrainControlRequest_DoBatch& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TrainControlRequest_DoBatch* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoBatch*>(
+               &_TrainControlRequest_DoBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(TrainControlRequest_DoBatch& a, TrainControlRequest_DoBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoBatch* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TrainControlRequest_DoBatch* New() const final {
+    return CreateMaybeMessage<TrainControlRequest_DoBatch>(nullptr);
+  }
+
+  TrainControlRequest_DoBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoBatch>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TrainControlRequest_DoBatch& from);
+  void MergeFrom(const TrainControlRequest_DoBatch& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TrainControlRequest_DoBatch* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoBatch";
+  }
+  protected:
+  explicit TrainControlRequest_DoBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_train_5fcontrol_2eproto);
+    return ::descriptor_table_train_5fcontrol_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestFieldNumber = 63,
+  };
+  // repeated .server.TrainControlRequest request = 63;
+  int request_size() const;
+  private:
+  int _internal_request_size() const;
+  public:
+  void clear_request();
+  ::server::TrainControlRequest* mutable_request(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlRequest >*
+      mutable_request();
+  private:
+  const ::server::TrainControlRequest& _internal_request(int index) const;
+  ::server::TrainControlRequest* _internal_add_request();
+  public:
+  const ::server::TrainControlRequest& request(int index) const;
+  ::server::TrainControlRequest* add_request();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlRequest >&
+      request() const;
+
+  // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlRequest > request_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TrainControlRequest_DoSubscribe PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest.DoSubscribe) */ {
+ public:
+  inline TrainControlRequest_DoSubscribe() : TrainControlRequest_DoSubscribe(nullptr) {};
+  virtual ~TrainControlRequest_DoSubscribe();
+
+  TrainControlRequest_DoSubscribe(const TrainControlRequest_DoSubscribe& from);
+  TrainControlRequest_DoSubscribe(TrainControlRequest_DoSubscribe&& from) noexcept
+    : TrainControlRequest_DoSubscribe() {
+    *this = ::std::move(from);
+  }
+
+  inline TrainControlRequest_DoSubscribe& operator=(const TrainControlRequest_DoSubscribe& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TrainControlRequest_DoSubscribe& operator=(TrainControlRequest_DoSubscribe&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TrainControlRequest_DoSubscribe& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TrainControlRequest_DoSubscribe* internal_default_instance() {
+    return reinterpret_cast<const TrainControlRequest_DoSubscribe*>(
+               &_TrainControlRequest_DoSubscribe_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(TrainControlRequest_DoSubscribe& a, TrainControlRequest_DoSubscribe& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlRequest_DoSubscribe* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlRequest_DoSubscribe* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TrainControlRequest_DoSubscribe* New() const final {
+    return CreateMaybeMessage<TrainControlRequest_DoSubscribe>(nullptr);
+  }
+
+  TrainControlRequest_DoSubscribe* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TrainControlRequest_DoSubscribe>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TrainControlRequest_DoSubscribe& from);
+  void MergeFrom(const TrainControlRequest_DoSubscribe& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TrainControlRequest_DoSubscribe* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlRequest.DoSubscribe";
+  }
+  protected:
+  explicit TrainControlRequest_DoSubscribe(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_train_5fcontrol_2eproto);
+    return ::descriptor_table_train_5fcontrol_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResumeSeqFieldNumber = 65,
+  };
+  // optional uint64 resume_seq = 65;
+  bool has_resume_seq() const;
+  private:
+  bool _internal_has_resume_seq() const;
+  public:
+  void clear_resume_seq();
+  ::PROTOBUF_NAMESPACE_ID::uint64 resume_seq() const;
+  void set_resume_seq(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_resume_seq() const;
+  void _internal_set_resume_seq(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:server.TrainControlRequest.DoSubscribe)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 resume_seq_;
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
+};
+// -------------------------------------------------------------------
+
 class TrainControlRequest PROTOBUF_FINAL :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlRequest) */ {
  public:
@@ -3545,7 +3863,7 @@ class TrainControlRequest PROTOBUF_FINAL :
                &_TrainControlRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    19;
+    21;
 
   friend void swap(TrainControlRequest& a, TrainControlRequest& b) {
     a.Swap(&b);
@@ -3630,6 +3948,8 @@ class TrainControlRequest PROTOBUF_FINAL :
   typedef TrainControlRequest_DoReflashPic DoReflashPic;
   typedef TrainControlRequest_DoGetOrSetCV DoGetOrSetCV;
   typedef TrainControlRequest_DoWaitForChange DoWaitForChange;
+  typedef TrainControlRequest_DoBatch DoBatch;
+  typedef TrainControlRequest_DoSubscribe DoSubscribe;
 
   // accessors -------------------------------------------------------
 
@@ -3652,6 +3972,8 @@ class TrainControlRequest PROTOBUF_FINAL :
     kDoreflashpicFieldNumber = 50,
     kDogetorsetcvFieldNumber = 52,
     kDowaitforchangeFieldNumber = 56,
+    kDobatchFieldNumber = 62,
+    kDosubscribeFieldNumber = 64,
   };
   // optional group DoSetSpeed = 1 { ... };
   bool has_dosetspeed() const;
@@ -3977,6 +4299,42 @@ class TrainControlRequest PROTOBUF_FINAL :
       ::server::TrainControlRequest_DoWaitForChange* dowaitforchange);
   ::server::TrainControlRequest_DoWaitForChange* unsafe_arena_release_dowaitforchange();
 
+  // optional group DoBatch = 62 { ... };
+  bool has_dobatch() const;
+  private:
+  bool _internal_has_dobatch() const;
+  public:
+  void clear_dobatch();
+  const ::server::TrainControlRequest_DoBatch& dobatch() const;
+  ::server::TrainControlRequest_DoBatch* release_dobatch();
+  ::server::TrainControlRequest_DoBatch* mutable_dobatch();
+  void set_allocated_dobatch(::server::TrainControlRequest_DoBatch* dobatch);
+  private:
+  const ::server::TrainControlRequest_DoBatch& _internal_dobatch() const;
+  ::server::TrainControlRequest_DoBatch* _internal_mutable_dobatch();
+  public:
+  void unsafe_arena_set_allocated_dobatch(
+      ::server::TrainControlRequest_DoBatch* dobatch);
+  ::server::TrainControlRequest_DoBatch* unsafe_arena_release_dobatch();
+
+  // optional group DoSubscribe = 64 { ... };
+  bool has_dosubscribe() const;
+  private:
+  bool _internal_has_dosubscribe() const;
+  public:
+  void clear_dosubscribe();
+  const ::server::TrainControlRequest_DoSubscribe& dosubscribe() const;
+  ::server::TrainControlRequest_DoSubscribe* release_dosubscribe();
+  ::server::TrainControlRequest_DoSubscribe* mutable_dosubscribe();
+  void set_allocated_dosubscribe(::server::TrainControlRequest_DoSubscribe* dosubscribe);
+  private:
+  const ::server::TrainControlRequest_DoSubscribe& _internal_dosubscribe() const;
+  ::server::TrainControlRequest_DoSubscribe* _internal_mutable_dosubscribe();
+  public:
+  void unsafe_arena_set_allocated_dosubscribe(
+      ::server::TrainControlRequest_DoSubscribe* dosubscribe);
+  ::server::TrainControlRequest_DoSubscribe* unsafe_arena_release_dosubscribe();
+
   // @@protoc_insertion_point(class_scope:server.TrainControlRequest)
  private:
   class _Internal;
@@ -4004,6 +4362,8 @@ class TrainControlRequest PROTOBUF_FINAL :
   ::server::TrainControlRequest_DoReflashPic* doreflashpic_;
   ::server::TrainControlRequest_DoGetOrSetCV* dogetorsetcv_;
   ::server::TrainControlRequest_DoWaitForChange* dowaitforchange_;
+  ::server::TrainControlRequest_DoBatch* dobatch_;
+  ::server::TrainControlRequest_DoSubscribe* dosubscribe_;
   friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
@@ -4057,7 +4417,7 @@ class TrainControlResponse_Speed PROTOBUF_FINAL :
                &_TrainControlResponse_Speed_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    20;
+    22;
 
   friend void swap(TrainControlResponse_Speed& a, TrainControlResponse_Speed& b) {
     a.Swap(&b);
@@ -4254,7 +4614,7 @@ class TrainControlResponse_Accessory PROTOBUF_FINAL :
                &_TrainControlResponse_Accessory_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    21;
+    23;
 
   friend void swap(TrainControlResponse_Accessory& a, TrainControlResponse_Accessory& b) {
     a.Swap(&b);
@@ -4451,7 +4811,7 @@ class TrainControlResponse_EmergencyStop PROTOBUF_FINAL :
                &_TrainControlResponse_EmergencyStop_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    22;
+    24;
 
   friend void swap(TrainControlResponse_EmergencyStop& a, TrainControlResponse_EmergencyStop& b) {
     a.Swap(&b);
@@ -4600,7 +4960,7 @@ class TrainControlResponse_RpcResponse PROTOBUF_FINAL :
                &_TrainControlResponse_RpcResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    23;
+    25;
 
   friend void swap(TrainControlResponse_RpcResponse& a, TrainControlResponse_RpcResponse& b) {
     a.Swap(&b);
@@ -4767,7 +5127,7 @@ class TrainControlResponse_Pong PROTOBUF_FINAL :
                &_TrainControlResponse_Pong_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    24;
+    26;
 
   friend void swap(TrainControlResponse_Pong& a, TrainControlResponse_Pong& b) {
     a.Swap(&b);
@@ -4916,7 +5276,7 @@ class TrainControlResponse_CurrentAddress PROTOBUF_FINAL :
                &_TrainControlResponse_CurrentAddress_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    25;
+    27;
 
   friend void swap(TrainControlResponse_CurrentAddress& a, TrainControlResponse_CurrentAddress& b) {
     a.Swap(&b);
@@ -5065,7 +5425,7 @@ class TrainControlResponse_RawCanPacket PROTOBUF_FINAL :
                &_TrainControlResponse_RawCanPacket_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    26;
+    28;
 
   friend void swap(TrainControlResponse_RawCanPacket& a, TrainControlResponse_RawCanPacket& b) {
     a.Swap(&b);
@@ -5222,7 +5582,7 @@ class TrainControlResponse_ReflashAutomata PROTOBUF_FINAL :
                &_TrainControlResponse_ReflashAutomata_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    27;
+    29;
 
   friend void swap(TrainControlResponse_ReflashAutomata& a, TrainControlResponse_ReflashAutomata& b) {
     a.Swap(&b);
@@ -5378,7 +5738,7 @@ class TrainControlResponse_LokDb_Lok_Function PROTOBUF_FINAL :
                &_TrainControlResponse_LokDb_Lok_Function_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    28;
+    30;
 
   friend void swap(TrainControlResponse_LokDb_Lok_Function& a, TrainControlResponse_LokDb_Lok_Function& b) {
     a.Swap(&b);
@@ -5542,7 +5902,7 @@ class TrainControlResponse_LokDb_Lok PROTOBUF_FINAL :
                &_TrainControlResponse_LokDb_Lok_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    29;
+    31;
 
   friend void swap(TrainControlResponse_LokDb_Lok& a, TrainControlResponse_LokDb_Lok& b) {
     a.Swap(&b);
@@ -5750,7 +6110,7 @@ class TrainControlResponse_LokDb PROTOBUF_FINAL :
                &_TrainControlResponse_LokDb_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    30;
+    32;
 
   friend void swap(TrainControlResponse_LokDb& a, TrainControlResponse_LokDb& b) {
     a.Swap(&b);
@@ -5905,7 +6265,7 @@ class TrainControlResponse_PicMisc PROTOBUF_FINAL :
                &_TrainControlResponse_PicMisc_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    31;
+    33;
 
   friend void swap(TrainControlResponse_PicMisc& a, TrainControlResponse_PicMisc& b) {
     a.Swap(&b);
@@ -6126,7 +6486,7 @@ class TrainControlResponse_ReflashPic PROTOBUF_FINAL :
                &_TrainControlResponse_ReflashPic_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    32;
+    34;
 
   friend void swap(TrainControlResponse_ReflashPic& a, TrainControlResponse_ReflashPic& b) {
     a.Swap(&b);
@@ -6282,7 +6642,7 @@ class TrainControlResponse_Cv PROTOBUF_FINAL :
                &_TrainControlResponse_Cv_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    33;
+    35;
 
   friend void swap(TrainControlResponse_Cv& a, TrainControlResponse_Cv& b) {
     a.Swap(&b);
@@ -6420,33 +6780,350 @@ class TrainControlResponse_Cv PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::int32 train_id_;
+  ::PROTOBUF_NAMESPACE_ID::int32 cv_;
+  ::PROTOBUF_NAMESPACE_ID::int32 error_code_;
+  ::PROTOBUF_NAMESPACE_ID::int32 value_;
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TrainControlResponse_WaitForChangeResponse PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.WaitForChangeResponse) */ {
+ public:
+  inline TrainControlResponse_WaitForChangeResponse() : TrainControlResponse_WaitForChangeResponse(nullptr) {};
+  virtual ~TrainControlResponse_WaitForChangeResponse();
+
+  TrainControlResponse_WaitForChangeResponse(const TrainControlResponse_WaitForChangeResponse& from);
+  TrainControlResponse_WaitForChangeResponse(TrainControlResponse_WaitForChangeResponse&& from) noexcept
+    : TrainControlResponse_WaitForChangeResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline TrainControlResponse_WaitForChangeResponse& operator=(const TrainControlResponse_WaitForChangeResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TrainControlResponse_WaitForChangeResponse& operator=(TrainControlResponse_WaitForChangeResponse&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TrainControlResponse_WaitForChangeResponse& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TrainControlResponse_WaitForChangeResponse* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_WaitForChangeResponse*>(
+               &_TrainControlResponse_WaitForChangeResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    36;
+
+  friend void swap(TrainControlResponse_WaitForChangeResponse& a, TrainControlResponse_WaitForChangeResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse_WaitForChangeResponse* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse_WaitForChangeResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TrainControlResponse_WaitForChangeResponse* New() const final {
+    return CreateMaybeMessage<TrainControlResponse_WaitForChangeResponse>(nullptr);
+  }
+
+  TrainControlResponse_WaitForChangeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TrainControlResponse_WaitForChangeResponse>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TrainControlResponse_WaitForChangeResponse& from);
+  void MergeFrom(const TrainControlResponse_WaitForChangeResponse& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TrainControlResponse_WaitForChangeResponse* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse.WaitForChangeResponse";
+  }
+  protected:
+  explicit TrainControlResponse_WaitForChangeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_train_5fcontrol_2eproto);
+    return ::descriptor_table_train_5fcontrol_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 54,
+    kTimestampFieldNumber = 53,
+  };
+  // optional int32 id = 54;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  ::PROTOBUF_NAMESPACE_ID::int32 id() const;
+  void set_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_id() const;
+  void _internal_set_id(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // required uint64 timestamp = 53;
+  bool has_timestamp() const;
+  private:
+  bool _internal_has_timestamp() const;
+  public:
+  void clear_timestamp();
+  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp() const;
+  void set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_timestamp() const;
+  void _internal_set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:server.TrainControlResponse.WaitForChangeResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::int32 id_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp_;
+  friend struct ::TableStruct_train_5fcontrol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TrainControlResponse_Batch PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.Batch) */ {
+ public:
+  inline TrainControlResponse_Batch() : TrainControlResponse_Batch(nullptr) {};
+  virtual ~TrainControlResponse_Batch();
+
+  TrainControlResponse_Batch(const TrainControlResponse_Batch& from);
+  TrainControlResponse_Batch(TrainControlResponse_Batch&& from) noexcept
+    : TrainControlResponse_Batch() {
+    *this = ::std::move(from);
+  }
+
+  inline TrainControlResponse_Batch& operator=(const TrainControlResponse_Batch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TrainControlResponse_Batch& operator=(TrainControlResponse_Batch&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TrainControlResponse_Batch& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TrainControlResponse_Batch* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_Batch*>(
+               &_TrainControlResponse_Batch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    37;
+
+  friend void swap(TrainControlResponse_Batch& a, TrainControlResponse_Batch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TrainControlResponse_Batch* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TrainControlResponse_Batch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TrainControlResponse_Batch* New() const final {
+    return CreateMaybeMessage<TrainControlResponse_Batch>(nullptr);
+  }
+
+  TrainControlResponse_Batch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TrainControlResponse_Batch>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TrainControlResponse_Batch& from);
+  void MergeFrom(const TrainControlResponse_Batch& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TrainControlResponse_Batch* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "server.TrainControlResponse.Batch";
+  }
+  protected:
+  explicit TrainControlResponse_Batch(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_train_5fcontrol_2eproto);
+    return ::descriptor_table_train_5fcontrol_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResponseFieldNumber = 56,
+  };
+  // repeated .server.TrainControlResponse response = 56;
+  int response_size() const;
+  private:
+  int _internal_response_size() const;
+  public:
+  void clear_response();
+  ::server::TrainControlResponse* mutable_response(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse >*
+      mutable_response();
+  private:
+  const ::server::TrainControlResponse& _internal_response(int index) const;
+  ::server::TrainControlResponse* _internal_add_response();
+  public:
+  const ::server::TrainControlResponse& response(int index) const;
+  ::server::TrainControlResponse* add_response();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse >&
+      response() const;
+
+  // @@protoc_insertion_point(class_scope:server.TrainControlResponse.Batch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse > response_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::int32 train_id_;
-  ::PROTOBUF_NAMESPACE_ID::int32 cv_;
-  ::PROTOBUF_NAMESPACE_ID::int32 error_code_;
-  ::PROTOBUF_NAMESPACE_ID::int32 value_;
   friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TrainControlResponse_WaitForChangeResponse PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.WaitForChangeResponse) */ {
+class TrainControlResponse_Change PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:server.TrainControlResponse.Change) */ {
  public:
-  inline TrainControlResponse_WaitForChangeResponse() : TrainControlResponse_WaitForChangeResponse(nullptr) {};
-  virtual ~TrainControlResponse_WaitForChangeResponse();
+  inline TrainControlResponse_Change() : TrainControlResponse_Change(nullptr) {};
+  virtual ~TrainControlResponse_Change();
 
-  TrainControlResponse_WaitForChangeResponse(const TrainControlResponse_WaitForChangeResponse& from);
-  TrainControlResponse_WaitForChangeResponse(TrainControlResponse_WaitForChangeResponse&& from) noexcept
-    : TrainControlResponse_WaitForChangeResponse() {
+  TrainControlResponse_Change(const TrainControlResponse_Change& from);
+  TrainControlResponse_Change(TrainControlResponse_Change&& from) noexcept
+    : TrainControlResponse_Change() {
     *this = ::std::move(from);
   }
 
-  inline TrainControlResponse_WaitForChangeResponse& operator=(const TrainControlResponse_WaitForChangeResponse& from) {
+  inline TrainControlResponse_Change& operator=(const TrainControlResponse_Change& from) {
     CopyFrom(from);
     return *this;
   }
-  inline TrainControlResponse_WaitForChangeResponse& operator=(TrainControlResponse_WaitForChangeResponse&& from) noexcept {
+  inline TrainControlResponse_Change& operator=(TrainControlResponse_Change&& from) noexcept {
     if (GetArena() == from.GetArena()) {
       if (this != &from) InternalSwap(&from);
     } else {
@@ -6471,20 +7148,20 @@ class TrainControlResponse_WaitForChangeResponse PROTOBUF_FINAL :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return GetMetadataStatic().reflection;
   }
-  static const TrainControlResponse_WaitForChangeResponse& default_instance();
+  static const TrainControlResponse_Change& default_instance();
 
   static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const TrainControlResponse_WaitForChangeResponse* internal_default_instance() {
-    return reinterpret_cast<const TrainControlResponse_WaitForChangeResponse*>(
-               &_TrainControlResponse_WaitForChangeResponse_default_instance_);
+  static inline const TrainControlResponse_Change* internal_default_instance() {
+    return reinterpret_cast<const TrainControlResponse_Change*>(
+               &_TrainControlResponse_Change_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    34;
+    38;
 
-  friend void swap(TrainControlResponse_WaitForChangeResponse& a, TrainControlResponse_WaitForChangeResponse& b) {
+  friend void swap(TrainControlResponse_Change& a, TrainControlResponse_Change& b) {
     a.Swap(&b);
   }
-  inline void Swap(TrainControlResponse_WaitForChangeResponse* other) {
+  inline void Swap(TrainControlResponse_Change* other) {
     if (other == this) return;
     if (GetArena() == other->GetArena()) {
       InternalSwap(other);
@@ -6492,7 +7169,7 @@ class TrainControlResponse_WaitForChangeResponse PROTOBUF_FINAL :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(TrainControlResponse_WaitForChangeResponse* other) {
+  void UnsafeArenaSwap(TrainControlResponse_Change* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -6500,17 +7177,17 @@ class TrainControlResponse_WaitForChangeResponse PROTOBUF_FINAL :
 
   // implements Message ----------------------------------------------
 
-  inline TrainControlResponse_WaitForChangeResponse* New() const final {
-    return CreateMaybeMessage<TrainControlResponse_WaitForChangeResponse>(nullptr);
+  inline TrainControlResponse_Change* New() const final {
+    return CreateMaybeMessage<TrainControlResponse_Change>(nullptr);
   }
 
-  TrainControlResponse_WaitForChangeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<TrainControlResponse_WaitForChangeResponse>(arena);
+  TrainControlResponse_Change* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TrainControlResponse_Change>(arena);
   }
   void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
   void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const TrainControlResponse_WaitForChangeResponse& from);
-  void MergeFrom(const TrainControlResponse_WaitForChangeResponse& from);
+  void CopyFrom(const TrainControlResponse_Change& from);
+  void MergeFrom(const TrainControlResponse_Change& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -6524,13 +7201,13 @@ class TrainControlResponse_WaitForChangeResponse PROTOBUF_FINAL :
   inline void SharedCtor();
   inline void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(TrainControlResponse_WaitForChangeResponse* other);
+  void InternalSwap(TrainControlResponse_Change* other);
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "server.TrainControlResponse.WaitForChangeResponse";
+    return "server.TrainControlResponse.Change";
   }
   protected:
-  explicit TrainControlResponse_WaitForChangeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit TrainControlResponse_Change(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   private:
   static void ArenaDtor(void* object);
   inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
@@ -6550,10 +7227,29 @@ class TrainControlResponse_WaitForChangeResponse PROTOBUF_FINAL :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kIdFieldNumber = 54,
-    kTimestampFieldNumber = 53,
+    kSeqFieldNumber = 58,
+    kIdFieldNumber = 59,
+    kFnIdFieldNumber = 60,
+    kValueFieldNumber = 61,
+    kDirFieldNumber = 62,
+    kSpeedFieldNumber = 63,
+    kStopFieldNumber = 64,
+    kTsFieldNumber = 65,
   };
-  // optional int32 id = 54;
+  // required uint64 seq = 58;
+  bool has_seq() const;
+  private:
+  bool _internal_has_seq() const;
+  public:
+  void clear_seq();
+  ::PROTOBUF_NAMESPACE_ID::uint64 seq() const;
+  void set_seq(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_seq() const;
+  void _internal_set_seq(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // optional int32 id = 59;
   bool has_id() const;
   private:
   bool _internal_has_id() const;
@@ -6566,20 +7262,85 @@ class TrainControlResponse_WaitForChangeResponse PROTOBUF_FINAL :
   void _internal_set_id(::PROTOBUF_NAMESPACE_ID::int32 value);
   public:
 
-  // required uint64 timestamp = 53;
-  bool has_timestamp() const;
+  // optional int32 fn_id = 60;
+  bool has_fn_id() const;
   private:
-  bool _internal_has_timestamp() const;
+  bool _internal_has_fn_id() const;
   public:
-  void clear_timestamp();
-  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp() const;
-  void set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  void clear_fn_id();
+  ::PROTOBUF_NAMESPACE_ID::int32 fn_id() const;
+  void set_fn_id(::PROTOBUF_NAMESPACE_ID::int32 value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_timestamp() const;
-  void _internal_set_timestamp(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_fn_id() const;
+  void _internal_set_fn_id(::PROTOBUF_NAMESPACE_ID::int32 value);
   public:
 
-  // @@protoc_insertion_point(class_scope:server.TrainControlResponse.WaitForChangeResponse)
+  // optional int32 value = 61;
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  ::PROTOBUF_NAMESPACE_ID::int32 value() const;
+  void set_value(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_value() const;
+  void _internal_set_value(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // optional int32 dir = 62;
+  bool has_dir() const;
+  private:
+  bool _internal_has_dir() const;
+  public:
+  void clear_dir();
+  ::PROTOBUF_NAMESPACE_ID::int32 dir() const;
+  void set_dir(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_dir() const;
+  void _internal_set_dir(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // optional int32 speed = 63;
+  bool has_speed() const;
+  private:
+  bool _internal_has_speed() const;
+  public:
+  void clear_speed();
+  ::PROTOBUF_NAMESPACE_ID::int32 speed() const;
+  void set_speed(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_speed() const;
+  void _internal_set_speed(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // optional bool stop = 64;
+  bool has_stop() const;
+  private:
+  bool _internal_has_stop() const;
+  public:
+  void clear_stop();
+  bool stop() const;
+  void set_stop(bool value);
+  private:
+  bool _internal_stop() const;
+  void _internal_set_stop(bool value);
+  public:
+
+  // optional uint64 ts = 65;
+  bool has_ts() const;
+  private:
+  bool _internal_has_ts() const;
+  public:
+  void clear_ts();
+  ::PROTOBUF_NAMESPACE_ID::uint64 ts() const;
+  void set_ts(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_ts() const;
+  void _internal_set_ts(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:server.TrainControlResponse.Change)
  private:
   class _Internal;
 
@@ -6588,8 +7349,14 @@ class TrainControlResponse_WaitForChangeResponse PROTOBUF_FINAL :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 seq_;
   ::PROTOBUF_NAMESPACE_ID::int32 id_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp_;
+  ::PROTOBUF_NAMESPACE_ID::int32 fn_id_;
+  ::PROTOBUF_NAMESPACE_ID::int32 value_;
+  ::PROTOBUF_NAMESPACE_ID::int32 dir_;
+  ::PROTOBUF_NAMESPACE_ID::int32 speed_;
+  bool stop_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 ts_;
   friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
@@ -6643,7 +7410,7 @@ class TrainControlResponse PROTOBUF_FINAL :
                &_TrainControlResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    35;
+    39;
 
   friend void swap(TrainControlResponse& a, TrainControlResponse& b) {
     a.Swap(&b);
@@ -6724,11 +7491,14 @@ class TrainControlResponse PROTOBUF_FINAL :
   typedef TrainControlResponse_ReflashPic ReflashPic;
   typedef TrainControlResponse_Cv Cv;
   typedef TrainControlResponse_WaitForChangeResponse WaitForChangeResponse;
+  typedef TrainControlResponse_Batch Batch;
+  typedef TrainControlResponse_Change Change;
 
   // accessors -------------------------------------------------------
 
   enum : int {
     kLokstateFieldNumber = 36,
+    kChangeFieldNumber = 57,
     kSpeedFieldNumber = 1,
     kAccessoryFieldNumber = 4,
     kEmergencystopFieldNumber = 8,
@@ -6742,6 +7512,8 @@ class TrainControlResponse PROTOBUF_FINAL :
     kReflashpicFieldNumber = 43,
     kCvFieldNumber = 45,
     kWaitforchangeresponseFieldNumber = 52,
+    kBatchFieldNumber = 55,
+    kSnapshotSeqFieldNumber = 66,
   };
   // repeated .server.LokStateProto lokstate = 36;
   int lokstate_size() const;
@@ -6761,6 +7533,24 @@ class TrainControlResponse PROTOBUF_FINAL :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::LokStateProto >&
       lokstate() const;
 
+  // repeated group Change = 57 { ... };
+  int change_size() const;
+  private:
+  int _internal_change_size() const;
+  public:
+  void clear_change();
+  ::server::TrainControlResponse_Change* mutable_change(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_Change >*
+      mutable_change();
+  private:
+  const ::server::TrainControlResponse_Change& _internal_change(int index) const;
+  ::server::TrainControlResponse_Change* _internal_add_change();
+  public:
+  const ::server::TrainControlResponse_Change& change(int index) const;
+  ::server::TrainControlResponse_Change* add_change();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_Change >&
+      change() const;
+
   // optional group Speed = 1 { ... };
   bool has_speed() const;
   private:
@@ -6995,6 +7785,37 @@ class TrainControlResponse PROTOBUF_FINAL :
       ::server::TrainControlResponse_WaitForChangeResponse* waitforchangeresponse);
   ::server::TrainControlResponse_WaitForChangeResponse* unsafe_arena_release_waitforchangeresponse();
 
+  // optional group Batch = 55 { ... };
+  bool has_batch() const;
+  private:
+  bool _internal_has_batch() const;
+  public:
+  void clear_batch();
+  const ::server::TrainControlResponse_Batch& batch() const;
+  ::server::TrainControlResponse_Batch* release_batch();
+  ::server::TrainControlResponse_Batch* mutable_batch();
+  void set_allocated_batch(::server::TrainControlResponse_Batch* batch);
+  private:
+  const ::server::TrainControlResponse_Batch& _internal_batch() const;
+  ::server::TrainControlResponse_Batch* _internal_mutable_batch();
+  public:
+  void unsafe_arena_set_allocated_batch(
+      ::server::TrainControlResponse_Batch* batch);
+  ::server::TrainControlResponse_Batch* unsafe_arena_release_batch();
+
+  // optional uint64 snapshot_seq = 66;
+  bool has_snapshot_seq() const;
+  private:
+  bool _internal_has_snapshot_seq() const;
+  public:
+  void clear_snapshot_seq();
+  ::PROTOBUF_NAMESPACE_ID::uint64 snapshot_seq() const;
+  void set_snapshot_seq(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_snapshot_seq() const;
+  void _internal_set_snapshot_seq(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
   // @@protoc_insertion_point(class_scope:server.TrainControlResponse)
  private:
   class _Internal;
@@ -7005,6 +7826,7 @@ class TrainControlResponse PROTOBUF_FINAL :
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::LokStateProto > lokstate_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_Change > change_;
   ::server::TrainControlResponse_Speed* speed_;
   ::server::TrainControlResponse_Accessory* accessory_;
   ::server::TrainControlResponse_EmergencyStop* emergencystop_;
@@ -7018,6 +7840,8 @@ class TrainControlResponse PROTOBUF_FINAL :
   ::server::TrainControlResponse_ReflashPic* reflashpic_;
   ::server::TrainControlResponse_Cv* cv_;
   ::server::TrainControlResponse_WaitForChangeResponse* waitforchangeresponse_;
+  ::server::TrainControlResponse_Batch* batch_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 snapshot_seq_;
   friend struct ::TableStruct_train_5fcontrol_2eproto;
 };
 // -------------------------------------------------------------------
@@ -7071,7 +7895,7 @@ class TinyRpcRequest PROTOBUF_FINAL :
                &_TinyRpcRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    36;
+    40;
 
   friend void swap(TinyRpcRequest& a, TinyRpcRequest& b) {
     a.Swap(&b);
@@ -7243,7 +8067,7 @@ class TinyRpcResponse PROTOBUF_FINAL :
                &_TinyRpcResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    37;
+    41;
 
   friend void swap(TinyRpcResponse& a, TinyRpcResponse& b) {
     a.Swap(&b);
@@ -8895,6 +9719,81 @@ inline void TrainControlRequest_DoWaitForChange::set_id(::PROTOBUF_NAMESPACE_ID:
 
 // -------------------------------------------------------------------
 
+// TrainControlRequest_DoBatch
+
+// repeated .server.TrainControlRequest request = 63;
+inline int TrainControlRequest_DoBatch::_internal_request_size() const {
+  return request_.size();
+}
+inline int TrainControlRequest_DoBatch::request_size() const {
+  return _internal_request_size();
+}
+inline void TrainControlRequest_DoBatch::clear_request() {
+  request_.Clear();
+}
+inline ::server::TrainControlRequest* TrainControlRequest_DoBatch::mutable_request(int index) {
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.DoBatch.request)
+  return request_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlRequest >*
+TrainControlRequest_DoBatch::mutable_request() {
+  // @@protoc_insertion_point(field_mutable_list:server.TrainControlRequest.DoBatch.request)
+  return &request_;
+}
+inline const ::server::TrainControlRequest& TrainControlRequest_DoBatch::_internal_request(int index) const {
+  return request_.Get(index);
+}
+inline const ::server::TrainControlRequest& TrainControlRequest_DoBatch::request(int index) const {
+  // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoBatch.request)
+  return _internal_request(index);
+}
+inline ::server::TrainControlRequest* TrainControlRequest_DoBatch::_internal_add_request() {
+  return request_.Add();
+}
+inline ::server::TrainControlRequest* TrainControlRequest_DoBatch::add_request() {
+  // @@protoc_insertion_point(field_add:server.TrainControlRequest.DoBatch.request)
+  return _internal_add_request();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlRequest >&
+TrainControlRequest_DoBatch::request() const {
+  // @@protoc_insertion_point(field_list:server.TrainControlRequest.DoBatch.request)
+  return request_;
+}
+
+// -------------------------------------------------------------------
+
+// TrainControlRequest_DoSubscribe
+
+// optional uint64 resume_seq = 65;
+inline bool TrainControlRequest_DoSubscribe::_internal_has_resume_seq() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TrainControlRequest_DoSubscribe::has_resume_seq() const {
+  return _internal_has_resume_seq();
+}
+inline void TrainControlRequest_DoSubscribe::clear_resume_seq() {
+  resume_seq_ = PROTOBUF_ULONGLONG(0);
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TrainControlRequest_DoSubscribe::_internal_resume_seq() const {
+  return resume_seq_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TrainControlRequest_DoSubscribe::resume_seq() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlRequest.DoSubscribe.resume_seq)
+  return _internal_resume_seq();
+}
+inline void TrainControlRequest_DoSubscribe::_internal_set_resume_seq(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _has_bits_[0] |= 0x00000001u;
+  resume_seq_ = value;
+}
+inline void TrainControlRequest_DoSubscribe::set_resume_seq(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_resume_seq(value);
+  // @@protoc_insertion_point(field_set:server.TrainControlRequest.DoSubscribe.resume_seq)
+}
+
+// -------------------------------------------------------------------
+
 // TrainControlRequest
 
 // optional group DoSetSpeed = 1 { ... };
@@ -10330,65 +11229,231 @@ inline const ::server::TrainControlRequest_DoWaitForChange& TrainControlRequest:
   // @@protoc_insertion_point(field_get:server.TrainControlRequest.dowaitforchange)
   return _internal_dowaitforchange();
 }
-inline void TrainControlRequest::unsafe_arena_set_allocated_dowaitforchange(
-    ::server::TrainControlRequest_DoWaitForChange* dowaitforchange) {
+inline void TrainControlRequest::unsafe_arena_set_allocated_dowaitforchange(
+    ::server::TrainControlRequest_DoWaitForChange* dowaitforchange) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(dowaitforchange_);
+  }
+  dowaitforchange_ = dowaitforchange;
+  if (dowaitforchange) {
+    _has_bits_[0] |= 0x00020000u;
+  } else {
+    _has_bits_[0] &= ~0x00020000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.dowaitforchange)
+}
+inline ::server::TrainControlRequest_DoWaitForChange* TrainControlRequest::release_dowaitforchange() {
+  _has_bits_[0] &= ~0x00020000u;
+  ::server::TrainControlRequest_DoWaitForChange* temp = dowaitforchange_;
+  dowaitforchange_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::server::TrainControlRequest_DoWaitForChange* TrainControlRequest::unsafe_arena_release_dowaitforchange() {
+  // @@protoc_insertion_point(field_release:server.TrainControlRequest.dowaitforchange)
+  _has_bits_[0] &= ~0x00020000u;
+  ::server::TrainControlRequest_DoWaitForChange* temp = dowaitforchange_;
+  dowaitforchange_ = nullptr;
+  return temp;
+}
+inline ::server::TrainControlRequest_DoWaitForChange* TrainControlRequest::_internal_mutable_dowaitforchange() {
+  _has_bits_[0] |= 0x00020000u;
+  if (dowaitforchange_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoWaitForChange>(GetArena());
+    dowaitforchange_ = p;
+  }
+  return dowaitforchange_;
+}
+inline ::server::TrainControlRequest_DoWaitForChange* TrainControlRequest::mutable_dowaitforchange() {
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dowaitforchange)
+  return _internal_mutable_dowaitforchange();
+}
+inline void TrainControlRequest::set_allocated_dowaitforchange(::server::TrainControlRequest_DoWaitForChange* dowaitforchange) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete dowaitforchange_;
+  }
+  if (dowaitforchange) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(dowaitforchange);
+    if (message_arena != submessage_arena) {
+      dowaitforchange = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dowaitforchange, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00020000u;
+  } else {
+    _has_bits_[0] &= ~0x00020000u;
+  }
+  dowaitforchange_ = dowaitforchange;
+  // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.dowaitforchange)
+}
+
+// optional group DoBatch = 62 { ... };
+inline bool TrainControlRequest::_internal_has_dobatch() const {
+  bool value = (_has_bits_[0] & 0x00040000u) != 0;
+  PROTOBUF_ASSUME(!value || dobatch_ != nullptr);
+  return value;
+}
+inline bool TrainControlRequest::has_dobatch() const {
+  return _internal_has_dobatch();
+}
+inline void TrainControlRequest::clear_dobatch() {
+  if (dobatch_ != nullptr) dobatch_->Clear();
+  _has_bits_[0] &= ~0x00040000u;
+}
+inline const ::server::TrainControlRequest_DoBatch& TrainControlRequest::_internal_dobatch() const {
+  const ::server::TrainControlRequest_DoBatch* p = dobatch_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::server::TrainControlRequest_DoBatch*>(
+      &::server::_TrainControlRequest_DoBatch_default_instance_);
+}
+inline const ::server::TrainControlRequest_DoBatch& TrainControlRequest::dobatch() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlRequest.dobatch)
+  return _internal_dobatch();
+}
+inline void TrainControlRequest::unsafe_arena_set_allocated_dobatch(
+    ::server::TrainControlRequest_DoBatch* dobatch) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(dobatch_);
+  }
+  dobatch_ = dobatch;
+  if (dobatch) {
+    _has_bits_[0] |= 0x00040000u;
+  } else {
+    _has_bits_[0] &= ~0x00040000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.dobatch)
+}
+inline ::server::TrainControlRequest_DoBatch* TrainControlRequest::release_dobatch() {
+  _has_bits_[0] &= ~0x00040000u;
+  ::server::TrainControlRequest_DoBatch* temp = dobatch_;
+  dobatch_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::server::TrainControlRequest_DoBatch* TrainControlRequest::unsafe_arena_release_dobatch() {
+  // @@protoc_insertion_point(field_release:server.TrainControlRequest.dobatch)
+  _has_bits_[0] &= ~0x00040000u;
+  ::server::TrainControlRequest_DoBatch* temp = dobatch_;
+  dobatch_ = nullptr;
+  return temp;
+}
+inline ::server::TrainControlRequest_DoBatch* TrainControlRequest::_internal_mutable_dobatch() {
+  _has_bits_[0] |= 0x00040000u;
+  if (dobatch_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoBatch>(GetArena());
+    dobatch_ = p;
+  }
+  return dobatch_;
+}
+inline ::server::TrainControlRequest_DoBatch* TrainControlRequest::mutable_dobatch() {
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dobatch)
+  return _internal_mutable_dobatch();
+}
+inline void TrainControlRequest::set_allocated_dobatch(::server::TrainControlRequest_DoBatch* dobatch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete dobatch_;
+  }
+  if (dobatch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(dobatch);
+    if (message_arena != submessage_arena) {
+      dobatch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dobatch, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00040000u;
+  } else {
+    _has_bits_[0] &= ~0x00040000u;
+  }
+  dobatch_ = dobatch;
+  // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.dobatch)
+}
+
+// optional group DoSubscribe = 64 { ... };
+inline bool TrainControlRequest::_internal_has_dosubscribe() const {
+  bool value = (_has_bits_[0] & 0x00080000u) != 0;
+  PROTOBUF_ASSUME(!value || dosubscribe_ != nullptr);
+  return value;
+}
+inline bool TrainControlRequest::has_dosubscribe() const {
+  return _internal_has_dosubscribe();
+}
+inline void TrainControlRequest::clear_dosubscribe() {
+  if (dosubscribe_ != nullptr) dosubscribe_->Clear();
+  _has_bits_[0] &= ~0x00080000u;
+}
+inline const ::server::TrainControlRequest_DoSubscribe& TrainControlRequest::_internal_dosubscribe() const {
+  const ::server::TrainControlRequest_DoSubscribe* p = dosubscribe_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::server::TrainControlRequest_DoSubscribe*>(
+      &::server::_TrainControlRequest_DoSubscribe_default_instance_);
+}
+inline const ::server::TrainControlRequest_DoSubscribe& TrainControlRequest::dosubscribe() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlRequest.dosubscribe)
+  return _internal_dosubscribe();
+}
+inline void TrainControlRequest::unsafe_arena_set_allocated_dosubscribe(
+    ::server::TrainControlRequest_DoSubscribe* dosubscribe) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(dowaitforchange_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(dosubscribe_);
   }
-  dowaitforchange_ = dowaitforchange;
-  if (dowaitforchange) {
-    _has_bits_[0] |= 0x00020000u;
+  dosubscribe_ = dosubscribe;
+  if (dosubscribe) {
+    _has_bits_[0] |= 0x00080000u;
   } else {
-    _has_bits_[0] &= ~0x00020000u;
+    _has_bits_[0] &= ~0x00080000u;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.dowaitforchange)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlRequest.dosubscribe)
 }
-inline ::server::TrainControlRequest_DoWaitForChange* TrainControlRequest::release_dowaitforchange() {
-  _has_bits_[0] &= ~0x00020000u;
-  ::server::TrainControlRequest_DoWaitForChange* temp = dowaitforchange_;
-  dowaitforchange_ = nullptr;
+inline ::server::TrainControlRequest_DoSubscribe* TrainControlRequest::release_dosubscribe() {
+  _has_bits_[0] &= ~0x00080000u;
+  ::server::TrainControlRequest_DoSubscribe* temp = dosubscribe_;
+  dosubscribe_ = nullptr;
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::server::TrainControlRequest_DoWaitForChange* TrainControlRequest::unsafe_arena_release_dowaitforchange() {
-  // @@protoc_insertion_point(field_release:server.TrainControlRequest.dowaitforchange)
-  _has_bits_[0] &= ~0x00020000u;
-  ::server::TrainControlRequest_DoWaitForChange* temp = dowaitforchange_;
-  dowaitforchange_ = nullptr;
+inline ::server::TrainControlRequest_DoSubscribe* TrainControlRequest::unsafe_arena_release_dosubscribe() {
+  // @@protoc_insertion_point(field_release:server.TrainControlRequest.dosubscribe)
+  _has_bits_[0] &= ~0x00080000u;
+  ::server::TrainControlRequest_DoSubscribe* temp = dosubscribe_;
+  dosubscribe_ = nullptr;
   return temp;
 }
-inline ::server::TrainControlRequest_DoWaitForChange* TrainControlRequest::_internal_mutable_dowaitforchange() {
-  _has_bits_[0] |= 0x00020000u;
-  if (dowaitforchange_ == nullptr) {
-    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoWaitForChange>(GetArena());
-    dowaitforchange_ = p;
+inline ::server::TrainControlRequest_DoSubscribe* TrainControlRequest::_internal_mutable_dosubscribe() {
+  _has_bits_[0] |= 0x00080000u;
+  if (dosubscribe_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlRequest_DoSubscribe>(GetArena());
+    dosubscribe_ = p;
   }
-  return dowaitforchange_;
+  return dosubscribe_;
 }
-inline ::server::TrainControlRequest_DoWaitForChange* TrainControlRequest::mutable_dowaitforchange() {
-  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dowaitforchange)
-  return _internal_mutable_dowaitforchange();
+inline ::server::TrainControlRequest_DoSubscribe* TrainControlRequest::mutable_dosubscribe() {
+  // @@protoc_insertion_point(field_mutable:server.TrainControlRequest.dosubscribe)
+  return _internal_mutable_dosubscribe();
 }
-inline void TrainControlRequest::set_allocated_dowaitforchange(::server::TrainControlRequest_DoWaitForChange* dowaitforchange) {
+inline void TrainControlRequest::set_allocated_dosubscribe(::server::TrainControlRequest_DoSubscribe* dosubscribe) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete dowaitforchange_;
+    delete dosubscribe_;
   }
-  if (dowaitforchange) {
+  if (dosubscribe) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(dowaitforchange);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(dosubscribe);
     if (message_arena != submessage_arena) {
-      dowaitforchange = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, dowaitforchange, submessage_arena);
+      dosubscribe = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, dosubscribe, submessage_arena);
     }
-    _has_bits_[0] |= 0x00020000u;
+    _has_bits_[0] |= 0x00080000u;
   } else {
-    _has_bits_[0] &= ~0x00020000u;
+    _has_bits_[0] &= ~0x00080000u;
   }
-  dowaitforchange_ = dowaitforchange;
-  // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.dowaitforchange)
+  dosubscribe_ = dosubscribe;
+  // @@protoc_insertion_point(field_set_allocated:server.TrainControlRequest.dosubscribe)
 }
 
 // -------------------------------------------------------------------
@@ -11603,6 +12668,277 @@ inline void TrainControlResponse_WaitForChangeResponse::set_id(::PROTOBUF_NAMESP
 
 // -------------------------------------------------------------------
 
+// TrainControlResponse_Batch
+
+// repeated .server.TrainControlResponse response = 56;
+inline int TrainControlResponse_Batch::_internal_response_size() const {
+  return response_.size();
+}
+inline int TrainControlResponse_Batch::response_size() const {
+  return _internal_response_size();
+}
+inline void TrainControlResponse_Batch::clear_response() {
+  response_.Clear();
+}
+inline ::server::TrainControlResponse* TrainControlResponse_Batch::mutable_response(int index) {
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.Batch.response)
+  return response_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse >*
+TrainControlResponse_Batch::mutable_response() {
+  // @@protoc_insertion_point(field_mutable_list:server.TrainControlResponse.Batch.response)
+  return &response_;
+}
+inline const ::server::TrainControlResponse& TrainControlResponse_Batch::_internal_response(int index) const {
+  return response_.Get(index);
+}
+inline const ::server::TrainControlResponse& TrainControlResponse_Batch::response(int index) const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.Batch.response)
+  return _internal_response(index);
+}
+inline ::server::TrainControlResponse* TrainControlResponse_Batch::_internal_add_response() {
+  return response_.Add();
+}
+inline ::server::TrainControlResponse* TrainControlResponse_Batch::add_response() {
+  // @@protoc_insertion_point(field_add:server.TrainControlResponse.Batch.response)
+  return _internal_add_response();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse >&
+TrainControlResponse_Batch::response() const {
+  // @@protoc_insertion_point(field_list:server.TrainControlResponse.Batch.response)
+  return response_;
+}
+
+// -------------------------------------------------------------------
+
+// TrainControlResponse_Change
+
+// required uint64 seq = 58;
+inline bool TrainControlResponse_Change::_internal_has_seq() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TrainControlResponse_Change::has_seq() const {
+  return _internal_has_seq();
+}
+inline void TrainControlResponse_Change::clear_seq() {
+  seq_ = PROTOBUF_ULONGLONG(0);
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TrainControlResponse_Change::_internal_seq() const {
+  return seq_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TrainControlResponse_Change::seq() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.Change.seq)
+  return _internal_seq();
+}
+inline void TrainControlResponse_Change::_internal_set_seq(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _has_bits_[0] |= 0x00000001u;
+  seq_ = value;
+}
+inline void TrainControlResponse_Change::set_seq(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_seq(value);
+  // @@protoc_insertion_point(field_set:server.TrainControlResponse.Change.seq)
+}
+
+// optional int32 id = 59;
+inline bool TrainControlResponse_Change::_internal_has_id() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool TrainControlResponse_Change::has_id() const {
+  return _internal_has_id();
+}
+inline void TrainControlResponse_Change::clear_id() {
+  id_ = 0;
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TrainControlResponse_Change::_internal_id() const {
+  return id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TrainControlResponse_Change::id() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.Change.id)
+  return _internal_id();
+}
+inline void TrainControlResponse_Change::_internal_set_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000002u;
+  id_ = value;
+}
+inline void TrainControlResponse_Change::set_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:server.TrainControlResponse.Change.id)
+}
+
+// optional int32 fn_id = 60;
+inline bool TrainControlResponse_Change::_internal_has_fn_id() const {
+  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool TrainControlResponse_Change::has_fn_id() const {
+  return _internal_has_fn_id();
+}
+inline void TrainControlResponse_Change::clear_fn_id() {
+  fn_id_ = 0;
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TrainControlResponse_Change::_internal_fn_id() const {
+  return fn_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TrainControlResponse_Change::fn_id() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.Change.fn_id)
+  return _internal_fn_id();
+}
+inline void TrainControlResponse_Change::_internal_set_fn_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000004u;
+  fn_id_ = value;
+}
+inline void TrainControlResponse_Change::set_fn_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_fn_id(value);
+  // @@protoc_insertion_point(field_set:server.TrainControlResponse.Change.fn_id)
+}
+
+// optional int32 value = 61;
+inline bool TrainControlResponse_Change::_internal_has_value() const {
+  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool TrainControlResponse_Change::has_value() const {
+  return _internal_has_value();
+}
+inline void TrainControlResponse_Change::clear_value() {
+  value_ = 0;
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TrainControlResponse_Change::_internal_value() const {
+  return value_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TrainControlResponse_Change::value() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.Change.value)
+  return _internal_value();
+}
+inline void TrainControlResponse_Change::_internal_set_value(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000008u;
+  value_ = value;
+}
+inline void TrainControlResponse_Change::set_value(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:server.TrainControlResponse.Change.value)
+}
+
+// optional int32 dir = 62;
+inline bool TrainControlResponse_Change::_internal_has_dir() const {
+  bool value = (_has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool TrainControlResponse_Change::has_dir() const {
+  return _internal_has_dir();
+}
+inline void TrainControlResponse_Change::clear_dir() {
+  dir_ = 0;
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TrainControlResponse_Change::_internal_dir() const {
+  return dir_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TrainControlResponse_Change::dir() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.Change.dir)
+  return _internal_dir();
+}
+inline void TrainControlResponse_Change::_internal_set_dir(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000010u;
+  dir_ = value;
+}
+inline void TrainControlResponse_Change::set_dir(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_dir(value);
+  // @@protoc_insertion_point(field_set:server.TrainControlResponse.Change.dir)
+}
+
+// optional int32 speed = 63;
+inline bool TrainControlResponse_Change::_internal_has_speed() const {
+  bool value = (_has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool TrainControlResponse_Change::has_speed() const {
+  return _internal_has_speed();
+}
+inline void TrainControlResponse_Change::clear_speed() {
+  speed_ = 0;
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TrainControlResponse_Change::_internal_speed() const {
+  return speed_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 TrainControlResponse_Change::speed() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.Change.speed)
+  return _internal_speed();
+}
+inline void TrainControlResponse_Change::_internal_set_speed(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _has_bits_[0] |= 0x00000020u;
+  speed_ = value;
+}
+inline void TrainControlResponse_Change::set_speed(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_speed(value);
+  // @@protoc_insertion_point(field_set:server.TrainControlResponse.Change.speed)
+}
+
+// optional bool stop = 64;
+inline bool TrainControlResponse_Change::_internal_has_stop() const {
+  bool value = (_has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool TrainControlResponse_Change::has_stop() const {
+  return _internal_has_stop();
+}
+inline void TrainControlResponse_Change::clear_stop() {
+  stop_ = false;
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline bool TrainControlResponse_Change::_internal_stop() const {
+  return stop_;
+}
+inline bool TrainControlResponse_Change::stop() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.Change.stop)
+  return _internal_stop();
+}
+inline void TrainControlResponse_Change::_internal_set_stop(bool value) {
+  _has_bits_[0] |= 0x00000040u;
+  stop_ = value;
+}
+inline void TrainControlResponse_Change::set_stop(bool value) {
+  _internal_set_stop(value);
+  // @@protoc_insertion_point(field_set:server.TrainControlResponse.Change.stop)
+}
+
+// optional uint64 ts = 65;
+inline bool TrainControlResponse_Change::_internal_has_ts() const {
+  bool value = (_has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool TrainControlResponse_Change::has_ts() const {
+  return _internal_has_ts();
+}
+inline void TrainControlResponse_Change::clear_ts() {
+  ts_ = PROTOBUF_ULONGLONG(0);
+  _has_bits_[0] &= ~0x00000080u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TrainControlResponse_Change::_internal_ts() const {
+  return ts_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TrainControlResponse_Change::ts() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.Change.ts)
+  return _internal_ts();
+}
+inline void TrainControlResponse_Change::_internal_set_ts(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _has_bits_[0] |= 0x00000080u;
+  ts_ = value;
+}
+inline void TrainControlResponse_Change::set_ts(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_ts(value);
+  // @@protoc_insertion_point(field_set:server.TrainControlResponse.Change.ts)
+}
+
+// -------------------------------------------------------------------
+
 // TrainControlResponse
 
 // optional group Speed = 1 { ... };
@@ -12723,6 +14059,156 @@ inline void TrainControlResponse::set_allocated_waitforchangeresponse(::server::
   // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.waitforchangeresponse)
 }
 
+// optional group Batch = 55 { ... };
+inline bool TrainControlResponse::_internal_has_batch() const {
+  bool value = (_has_bits_[0] & 0x00002000u) != 0;
+  PROTOBUF_ASSUME(!value || batch_ != nullptr);
+  return value;
+}
+inline bool TrainControlResponse::has_batch() const {
+  return _internal_has_batch();
+}
+inline void TrainControlResponse::clear_batch() {
+  if (batch_ != nullptr) batch_->Clear();
+  _has_bits_[0] &= ~0x00002000u;
+}
+inline const ::server::TrainControlResponse_Batch& TrainControlResponse::_internal_batch() const {
+  const ::server::TrainControlResponse_Batch* p = batch_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::server::TrainControlResponse_Batch*>(
+      &::server::_TrainControlResponse_Batch_default_instance_);
+}
+inline const ::server::TrainControlResponse_Batch& TrainControlResponse::batch() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.batch)
+  return _internal_batch();
+}
+inline void TrainControlResponse::unsafe_arena_set_allocated_batch(
+    ::server::TrainControlResponse_Batch* batch) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(batch_);
+  }
+  batch_ = batch;
+  if (batch) {
+    _has_bits_[0] |= 0x00002000u;
+  } else {
+    _has_bits_[0] &= ~0x00002000u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:server.TrainControlResponse.batch)
+}
+inline ::server::TrainControlResponse_Batch* TrainControlResponse::release_batch() {
+  _has_bits_[0] &= ~0x00002000u;
+  ::server::TrainControlResponse_Batch* temp = batch_;
+  batch_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::server::TrainControlResponse_Batch* TrainControlResponse::unsafe_arena_release_batch() {
+  // @@protoc_insertion_point(field_release:server.TrainControlResponse.batch)
+  _has_bits_[0] &= ~0x00002000u;
+  ::server::TrainControlResponse_Batch* temp = batch_;
+  batch_ = nullptr;
+  return temp;
+}
+inline ::server::TrainControlResponse_Batch* TrainControlResponse::_internal_mutable_batch() {
+  _has_bits_[0] |= 0x00002000u;
+  if (batch_ == nullptr) {
+    auto* p = CreateMaybeMessage<::server::TrainControlResponse_Batch>(GetArena());
+    batch_ = p;
+  }
+  return batch_;
+}
+inline ::server::TrainControlResponse_Batch* TrainControlResponse::mutable_batch() {
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.batch)
+  return _internal_mutable_batch();
+}
+inline void TrainControlResponse::set_allocated_batch(::server::TrainControlResponse_Batch* batch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete batch_;
+  }
+  if (batch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(batch);
+    if (message_arena != submessage_arena) {
+      batch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, batch, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00002000u;
+  } else {
+    _has_bits_[0] &= ~0x00002000u;
+  }
+  batch_ = batch;
+  // @@protoc_insertion_point(field_set_allocated:server.TrainControlResponse.batch)
+}
+
+// repeated group Change = 57 { ... };
+inline int TrainControlResponse::_internal_change_size() const {
+  return change_.size();
+}
+inline int TrainControlResponse::change_size() const {
+  return _internal_change_size();
+}
+inline void TrainControlResponse::clear_change() {
+  change_.Clear();
+}
+inline ::server::TrainControlResponse_Change* TrainControlResponse::mutable_change(int index) {
+  // @@protoc_insertion_point(field_mutable:server.TrainControlResponse.change)
+  return change_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_Change >*
+TrainControlResponse::mutable_change() {
+  // @@protoc_insertion_point(field_mutable_list:server.TrainControlResponse.change)
+  return &change_;
+}
+inline const ::server::TrainControlResponse_Change& TrainControlResponse::_internal_change(int index) const {
+  return change_.Get(index);
+}
+inline const ::server::TrainControlResponse_Change& TrainControlResponse::change(int index) const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.change)
+  return _internal_change(index);
+}
+inline ::server::TrainControlResponse_Change* TrainControlResponse::_internal_add_change() {
+  return change_.Add();
+}
+inline ::server::TrainControlResponse_Change* TrainControlResponse::add_change() {
+  // @@protoc_insertion_point(field_add:server.TrainControlResponse.change)
+  return _internal_add_change();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::server::TrainControlResponse_Change >&
+TrainControlResponse::change() const {
+  // @@protoc_insertion_point(field_list:server.TrainControlResponse.change)
+  return change_;
+}
+
+// optional uint64 snapshot_seq = 66;
+inline bool TrainControlResponse::_internal_has_snapshot_seq() const {
+  bool value = (_has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool TrainControlResponse::has_snapshot_seq() const {
+  return _internal_has_snapshot_seq();
+}
+inline void TrainControlResponse::clear_snapshot_seq() {
+  snapshot_seq_ = PROTOBUF_ULONGLONG(0);
+  _has_bits_[0] &= ~0x00004000u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TrainControlResponse::_internal_snapshot_seq() const {
+  return snapshot_seq_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TrainControlResponse::snapshot_seq() const {
+  // @@protoc_insertion_point(field_get:server.TrainControlResponse.snapshot_seq)
+  return _internal_snapshot_seq();
+}
+inline void TrainControlResponse::_internal_set_snapshot_seq(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _has_bits_[0] |= 0x00004000u;
+  snapshot_seq_ = value;
+}
+inline void TrainControlResponse::set_snapshot_seq(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_snapshot_seq(value);
+  // @@protoc_insertion_point(field_set:server.TrainControlResponse.snapshot_seq)
+}
+
 // -------------------------------------------------------------------
 
 // TinyRpcRequest
@@ -13132,6 +14618,14 @@ inline void TinyRpcResponse::set_allocated_error_detail(std::string* error_detai
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -125,6 +125,11 @@
 // ccccc is the clientid, aaaaa is the byte offset and bbb is the bit in the
 // byte.
 #define _ACT_DEF_VAR (_ACT_MISC_BASE | 2)
+// Values of ttt in _ACT_DEF_VAR.
+#define _VAR_TYPE_EVENT_BIT 0
+#define _VAR_TYPE_EVENT_BLOCK 1
+#define _VAR_TYPE_BYTE_BLOCK 2
+#define _VAR_TYPE_BYTE_BLOCK_CONSUMER 3
 // This command has arguments.
 // Arg1: 0b0X0Y0bbb, where eventid X will be set from the current contents of
 // event Y, replacing the last bbb+1 bytes. Then bbb+1 bytes will follow for the
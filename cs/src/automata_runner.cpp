@@ -232,6 +232,8 @@ class EventBit : public ReadWriteBit {
         pc_(&bit_),
         defined_(false) {
     if (0) fprintf(stderr, "event bit create on node %p\n", node);
+    // Same as bit_.get_current_state() == VALID.
+    SetDirect(Kind::MASKED_BYTE, ptr, mask);
   }
 
   void Initialize(openlcb::Node*) override {
@@ -276,6 +278,8 @@ class EventBlockBit : public ReadWriteBit {
             new openlcb::BitRangeEventPC(node, event_base, storage_, size)) {
     size_t sz = (size + 31) >> 5;
     memset(&storage_[0], 0, sz * sizeof(storage_[0]));
+    // BitRangeEventPC keeps bit N in storage_[N / 32], bit N % 32.
+    SetDirect(storage_);
   }
 
   ~EventBlockBit() { delete[] storage_; }
@@ -307,6 +311,7 @@ class EventByteBlock : public ReadWriteBit {
         handler_(
             new openlcb::ByteRangeEventP(node, event_base, storage_, size)) {
     memset(&storage_[0], 0, size);
+    SetDirect(Kind::BYTE_ARRAY, storage_);
   }
 
   ~EventByteBlock() { delete[] storage_; }
@@ -345,6 +350,7 @@ class EventByteBlockConsumer : public ReadWriteBit {
         handler_(
             new openlcb::ByteRangeEventC(node, event_base, storage_, size)) {
     memset(&storage_[0], 0, size);
+    SetDirect(Kind::BYTE_ARRAY, storage_);
   }
 
   ~EventByteBlockConsumer() { delete[] storage_; }
@@ -380,17 +386,17 @@ ReadWriteBit* AutomataRunner::create_variable() {
   int bit = arg2 & 7;
   uint8_t* ptr = get_state_byte(client, offset);
   switch (type) {
-    case 0:
+    case _VAR_TYPE_EVENT_BIT:
       return new EventBit(openmrn_node_, aut_eventids_[1], aut_eventids_[0],
                           (1 << bit), ptr);
-    case 1: {
+    case _VAR_TYPE_EVENT_BLOCK: {
       uint16_t size = ((client & 7) << 8) | arg2;
       return new EventBlockBit(openmrn_node_, aut_eventids_[0], size);
     }
-    case 2: {
+    case _VAR_TYPE_BYTE_BLOCK: {
       return new EventByteBlock(openmrn_node_, aut_eventids_[0], arg2);
     }
-    case 3: {
+    case _VAR_TYPE_BYTE_BLOCK_CONSUMER: {
       return new EventByteBlockConsumer(openmrn_node_, aut_eventids_[0], arg2);
     }
     default:
@@ -449,7 +455,7 @@ bool AutomataRunner::eval_condition(insn_t insn) {
   if ((insn & _IF_REG_MASK) == _IF_REG) {
     int cnt = insn & _IF_REG_BITNUM_MASK;
     uint16_t arg = imported_bit_args_[cnt];
-    bool value = GetBit(cnt)->Read(arg, openmrn_node_, current_automata_);
+    bool value = GetBit(cnt)->FastRead(arg, openmrn_node_, current_automata_);
     bool expected = (insn & (1 << 6));
     return value == expected;
   }
@@ -457,7 +463,7 @@ bool AutomataRunner::eval_condition(insn_t insn) {
     int cnt = insn & ~_GET_LOCK_MASK;
     uint16_t arg = imported_bit_args_[cnt];
     ReadWriteBit* bit = GetBit(cnt);
-    if (bit->Read(arg, openmrn_node_, current_automata_)) return false;
+    if (bit->FastRead(arg, openmrn_node_, current_automata_)) return false;
     bit->Write(arg, openmrn_node_, current_automata_, true);
     return true;
   }
@@ -676,13 +682,13 @@ void AutomataRunner::eval_action2(insn_t insn, insn_t arg) {
     case _ACT_GET_VAR_VALUE_ASPECT: {
       unsigned offset = arg >> 5;
       unsigned var = arg & 31;
-      aut_signal_aspect_ = GetBit(var)->GetState(offset);
+      aut_signal_aspect_ = GetBit(var)->FastGetState(offset);
       return;
     }
     case _ACT_GET_VAR_VALUE_SPEED: {
       unsigned offset = arg >> 5;
       unsigned var = arg & 31;
-      arg = GetBit(var)->GetState(offset);
+      arg = GetBit(var)->FastGetState(offset);
     } /* fall through */
     case _ACT_IMM_SPEED: {
       uint8_t value = arg;
@@ -37,12 +37,71 @@ extern AutomataDebugSpace g_aut_debug_space;
 
 class ReadWriteBit {
 public:
+  // Storage layouts that the automata runner reads directly, without going
+  // through the virtual methods. Each bit class fixes its kind in its
+  // constructor.
+  enum class Kind : uint8_t {
+    // Only accessible through the virtual methods.
+    GENERIC,
+    // Read() is (*bytes_ & mask_) != 0; the arg is ignored. Event bits and
+    // timer bits.
+    MASKED_BYTE,
+    // Read(arg) is bit arg of the words_ array. Event blocks.
+    BIT_ARRAY,
+    // GetState(arg) is bytes_[arg]. Byte imports.
+    BYTE_ARRAY,
+  };
+
   virtual ~ReadWriteBit() {}
   virtual bool Read(uint16_t arg, openlcb::Node* node, Automata* aut) = 0;
   virtual void Write(uint16_t arg, openlcb::Node* node, Automata* aut, bool value) = 0;
   virtual uint8_t GetState(uint16_t arg) { HASSERT(0); return 0; }
   virtual void SetState(uint16_t arg, uint8_t state) { HASSERT(0); }
   virtual void Initialize(openlcb::Node* node) = 0;
+
+  // Same as Read(), but the common kinds are read inline.
+  bool FastRead(uint16_t arg, openlcb::Node* node, Automata* aut) {
+    switch (kind_) {
+      case Kind::MASKED_BYTE:
+        return *bytes_ & mask_;
+      case Kind::BIT_ARRAY:
+        return words_[arg >> 5] & (1U << (arg & 31));
+      default:
+        return Read(arg, node, aut);
+    }
+  }
+
+  // Same as GetState(), but byte arrays are read inline.
+  uint8_t FastGetState(uint16_t arg) {
+    if (kind_ == Kind::BYTE_ARRAY) return bytes_[arg];
+    return GetState(arg);
+  }
+
+  Kind kind() { return kind_; }
+
+protected:
+  // Enables direct reads of a byte (MASKED_BYTE) or a byte array
+  // (BYTE_ARRAY). The storage must live as long as this object.
+  void SetDirect(Kind kind, uint8_t* bytes, uint8_t mask = 0xff) {
+    kind_ = kind;
+    bytes_ = bytes;
+    mask_ = mask;
+  }
+
+  // Enables direct reads of a bit array (BIT_ARRAY).
+  void SetDirect(uint32_t* words) {
+    kind_ = Kind::BIT_ARRAY;
+    words_ = words;
+  }
+
+private:
+  Kind kind_{Kind::GENERIC};
+  uint8_t mask_{0};
+  // Which member is valid depends on kind_.
+  union {
+    uint8_t* bytes_{nullptr};
+    uint32_t* words_;
+  };
 };
 
 
@@ -99,6 +158,7 @@ private:
     public:
       TimerBit(int id) : id_(id), state_(0), timer_(0) {
           HASSERT(0 <= id && id <= 255);
+          SetDirect(Kind::MASKED_BYTE, &timer_);
         }
 	virtual ~TimerBit() {}
         bool Read(uint16_t, openlcb::Node*, Automata* aut) override {
@@ -184,6 +244,13 @@ public:
   //! runner object.
   void InjectBit(aut_offset_t offset, ReadWriteBit* bit);
 
+  // Testing only - Returns the bit declared at a given global offset, or NULL
+  // if there is none.
+  ReadWriteBit* GetDeclaredBit(aut_offset_t offset) {
+    auto it = declared_bits_.find(offset);
+    return it == declared_bits_.end() ? NULL : it->second;
+  }
+
   // Testing only - Returns detected list of automatas.
   const vector<Automata*>& GetAllAutomatas() {
     return all_automata_;
@@ -42,6 +42,7 @@
 #define SCMD_INONE 0x11  // arg: input number. ACK-ed if the given input number is true.
 
 #define SCMD_BOOT 0x12 // exit bootloader and start app. No ack.
+#define SCMD_MULTI_ASPECT 0x13 // Broadcast only. arg: pairs of (address, aspect). Every device picks the aspect(s) following its own address. No ack. Max packet len 32.
 
 #define SCMD_DISPLAY 0x18 // For screens. arg: text (UTF8) to display. Max packet len 16. Always ACK-ed when it is received without error.
 
@@ -1,5 +1,5 @@
-#include <map>
 #include <algorithm>
+#include <vector>
 
 #include "cs_config.h"
 #include "event_registry.hxx"
@@ -7,8 +7,82 @@
 using namespace std;
 
 struct EventRegistry::Impl {
-  typedef multimap<uint64_t, EventHandler*> Handlers;
-  Handlers handlers;
+  /// One registration, as given by the caller.
+  struct Registration {
+    uint64_t event;
+    /// Number of low bits of the event that are don't-care.
+    unsigned mask_bits;
+    EventHandler* handler;
+  };
+
+  /// One entry of the frozen exact-match table.
+  struct ExactEntry {
+    uint64_t event;
+    EventHandler* handler;
+    bool operator<(const ExactEntry& o) const { return event < o.event; }
+  };
+
+  /// Number of 32-bit words in the prefilter bitmap.
+  static const unsigned kFilterWords = 8;
+
+  /// @return two bit indexes into the prefilter for an event, packed into the
+  /// low and high byte.
+  static unsigned FilterBits(uint64_t event) {
+    uint64_t h = event * 0x9E3779B97F4A7C15ULL;
+    return h >> 48;
+  }
+
+  void SetFilterBit(unsigned bit) {
+    filter[(bit >> 5) & (kFilterWords - 1)] |= 1u << (bit & 31);
+  }
+
+  bool FilterBit(unsigned bit) const {
+    return filter[(bit >> 5) & (kFilterWords - 1)] & (1u << (bit & 31));
+  }
+
+  /// @return false if no exact-match handler can be registered for event.
+  bool MayMatch(uint64_t event) const {
+    unsigned bits = FilterBits(event);
+    return FilterBit(bits & 0xff) && FilterBit(bits >> 8);
+  }
+
+  /// Rebuilds the dispatch tables from the registrations.
+  void Rebuild() {
+    exact.clear();
+    ranges.clear();
+    globals.clear();
+    fill(filter, filter + kFilterWords, 0);
+    for (const auto& r : registrations) {
+      if (r.event == 0 && r.mask_bits == 0) {
+        globals.push_back(r.handler);
+      } else if (r.mask_bits) {
+        ranges.push_back(r);
+      } else {
+        exact.push_back({r.event, r.handler});
+        unsigned bits = FilterBits(r.event);
+        SetFilterBit(bits & 0xff);
+        SetFilterBit(bits >> 8);
+      }
+    }
+    // Stable, so that handlers of the same event are called in registration
+    // order.
+    stable_sort(exact.begin(), exact.end());
+    dirty = false;
+  }
+
+  /// All registrations in registration order. This is the source of truth;
+  /// the tables below are rebuilt from it when it changes.
+  vector<Registration> registrations;
+  /// Handlers registered for a single event, sorted by event.
+  vector<ExactEntry> exact;
+  /// Handlers registered for an event range.
+  vector<Registration> ranges;
+  /// Handlers called for every event.
+  vector<EventHandler*> globals;
+  /// Bloom filter of the events in exact.
+  uint32_t filter[kFilterWords] = {0};
+  /// True if registrations changed since the last Rebuild.
+  bool dirty = false;
 };
 
 EventRegistry::EventRegistry() {
@@ -22,30 +96,52 @@ EventRegistry::~EventRegistry() {
   delete impl_;
 }
 
-void EventRegistry::RegisterHandler(EventHandler* handler, uint64_t event) {
-  impl_->handlers.insert(make_pair(event, handler));
+void EventRegistry::RegisterHandler(EventHandler* handler, uint64_t event,
+                                    unsigned mask_bits) {
+  ASSERT(mask_bits < 64);
+  // Range registrations are stored with the don't-care bits cleared.
+  if (mask_bits) {
+    event &= ~((uint64_t(1) << mask_bits) - 1);
+  }
+  impl_->registrations.push_back({event, mask_bits, handler});
+  impl_->dirty = true;
 }
 
 void EventRegistry::UnregisterHandler(EventHandler* handler, uint64_t event) {
-  auto r = impl_->handlers.equal_range(event);
-  for (auto it = r.first; it != r.second;) {
-    if (it->second == handler) {
-      it = impl_->handlers.erase(it);
-    } else {
-      ++it;
-    }
+  auto& regs = impl_->registrations;
+  auto it = remove_if(regs.begin(), regs.end(),
+                      [handler, event](const Impl::Registration& r) {
+                        uint64_t base = event;
+                        if (r.mask_bits) {
+                          base &= ~((uint64_t(1) << r.mask_bits) - 1);
+                        }
+                        return r.handler == handler && r.event == base;
+                      });
+  if (it != regs.end()) {
+    regs.erase(it, regs.end());
+    impl_->dirty = true;
   }
 }
 
 void EventRegistry::HandleEvent(uint64_t event) {
-  auto r = impl_->handlers.equal_range(event);
-  for (auto it = r.first; it != r.second; it++) {
-    it->second->HandleEvent(event);
+  if (impl_->dirty) {
+    impl_->Rebuild();
+  }
+  if (impl_->MayMatch(event)) {
+    auto r = equal_range(impl_->exact.begin(), impl_->exact.end(),
+                         Impl::ExactEntry{event, nullptr});
+    for (auto it = r.first; it != r.second; ++it) {
+      it->handler->HandleEvent(event);
+    }
+  }
+  for (const auto& r : impl_->ranges) {
+    if ((event >> r.mask_bits) == (r.event >> r.mask_bits)) {
+      r.handler->HandleEvent(event);
+    }
   }
   // Call global event handlers too.
-  r = impl_->handlers.equal_range(0);
-  for (auto it = r.first; it != r.second; it++) {
-    it->second->HandleEvent(event);
+  for (EventHandler* h : impl_->globals) {
+    h->HandleEvent(event);
   }
 }
 
@@ -17,9 +17,15 @@ class EventRegistry {
   void HandleEvent(uint64_t event);
 
   //! Adds a new event handler. The caller retains ownership of handler.
-  void RegisterHandler(EventHandler* handler, uint64_t event);
-
-  //! Removes handler from handling event.
+  //! If mask_bits is nonzero, the handler is called for every event that
+  //! differs from event only in the lowest mask_bits bits.
+  //!
+  //! The dispatch tables are rebuilt at the next incoming event after
+  //! registrations change, so register handlers in bulk at startup.
+  void RegisterHandler(EventHandler* handler, uint64_t event,
+                       unsigned mask_bits = 0);
+
+  //! Removes handler from handling event (or the range containing event).
   void UnregisterHandler(EventHandler* handler, uint64_t event);
 
   //! Adds a new global event handler. This will be called with every incoming
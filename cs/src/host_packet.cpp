@@ -104,6 +104,13 @@ const uint8_t syncpacket[] = {
 
 typedef Buffer<PacketBase> PacketQEntry;
 
+//! How many packets each class may send in one scheduling round. Control
+//! traffic goes first, but logs and bridge traffic still get their share.
+static const uint8_t kTxWeight[DefaultPacketQueue::NUM_TX_CLASSES] = {8, 4, 1};
+
+//! Log packets beyond this many waiting are dropped.
+static const size_t kMaxLogQueueLength = 32;
+
 class DefaultPacketQueue::TxFlow : public StateFlowBase {
  public:
   TxFlow(DefaultPacketQueue* s)
@@ -124,12 +131,21 @@ class DefaultPacketQueue::TxFlow : public StateFlowBase {
   }
 
   Action get_next_packet() {
-    return allocate_and_call(STATE(send_next_packet),
-                             service()->outgoing_packet_queue());
+    DefaultPacketQueue* s = service();
+    os_mutex_lock(&s->tx_lock_);
+    currentPacket_ = s->PickNextPacket();
+    if (!currentPacket_) {
+      s->tx_waiting_ = true;
+    }
+    os_mutex_unlock(&s->tx_lock_);
+    if (!currentPacket_) {
+      // TransmitPacket will wake us up.
+      return wait_and_call(STATE(get_next_packet));
+    }
+    return call_immediately(STATE(send_next_packet));
   }
 
   Action send_next_packet() {
-    cast_allocation_result(&currentPacket_);
     sizeBuf_ = currentPacket_->data()->size();
     return write_repeated(&selectHelper_, service()->fd(), &sizeBuf_, 1,
                           STATE(send_packet_data), 0);
@@ -155,7 +171,10 @@ class DefaultPacketQueue::TxFlow : public StateFlowBase {
   uint8_t sizeBuf_;
 };
 
-DefaultPacketQueue::DefaultPacketQueue(CanHubFlow* openlcb_can, const char* dev, bool force_sync) : Service(openlcb_can->service()->executor()), synced_(false), usb_vcom_pipe0_(this) {
+DefaultPacketQueue::DefaultPacketQueue(CanHubFlow* openlcb_can, const char* dev, bool force_sync) : Service(openlcb_can->service()->executor()), synced_(false), tx_waiting_(false), usb_vcom_pipe0_(this), tx_flow_(NULL) {
+    os_mutex_init(&tx_lock_);
+    memset(tx_stats_, 0, sizeof(tx_stats_));
+    memcpy(tx_credit_, kTxWeight, sizeof(tx_credit_));
     async_fd_ = open(dev, O_RDWR | O_NONBLOCK);
     sync_fd_ = open(dev, O_RDWR);
     if (force_sync) ForceInitialSync();
@@ -481,12 +500,72 @@ void DefaultPacketQueue::HandleMiscPacket(const PacketBase& in_pkt) {
 }
 
 
+DefaultPacketQueue::TxClass DefaultPacketQueue::ClassifyPacket(
+    const PacketBase& packet) {
+  if (!packet.size()) return TX_CONTROL;
+  switch (packet[0]) {
+  case CMD_RPCLOG:
+  case CMD_CAN_LOG:
+  case CMD_I2C_IRQ_LOG:
+  case CMD_DCCLOG:
+    return TX_LOG;
+  case CMD_CAN_PKT:
+  case CMD_CAN_SENT:
+  case CMD_VCOM0:
+  case CMD_VCOM1:
+  case CMD_VCOM2:
+  case CMD_VCOM3:
+    return TX_BRIDGE;
+  default:
+    return TX_CONTROL;
+  }
+}
+
+Buffer<PacketBase>* DefaultPacketQueue::PickNextPacket() {
+  for (int round = 0; round < 2; ++round) {
+    for (unsigned c = 0; c < NUM_TX_CLASSES; ++c) {
+      if (tx_credit_[c] && !tx_queue_[c].empty()) {
+        --tx_credit_[c];
+        Buffer<PacketBase>* b = tx_queue_[c].front();
+        tx_queue_[c].pop_front();
+        ++tx_stats_[c].sent;
+        return b;
+      }
+    }
+    // Every class that has packets waiting used up its share: starts a new
+    // round.
+    memcpy(tx_credit_, kTxWeight, sizeof(tx_credit_));
+  }
+  return NULL;
+}
+
 void DefaultPacketQueue::TransmitPacket(PacketBase& packet) {
   Buffer<PacketBase>* b;
   mainBufferPool->alloc(&b, nullptr);
   *b->data() = packet;
   packet.release(); // The memory is now owned by the buffer<pkt>.
-  outgoing_packet_queue_.insert(b);
+  TxClass c = ClassifyPacket(*b->data());
+  bool wakeup = false;
+  os_mutex_lock(&tx_lock_);
+  std::deque<Buffer<PacketBase>*>& q = tx_queue_[c];
+  TxStats& stats = tx_stats_[c];
+  if (c == TX_LOG && q.size() >= kMaxLogQueueLength) {
+    // The host link cannot keep up; we rather lose logs than delay
+    // responses.
+    ++stats.dropped;
+    os_mutex_unlock(&tx_lock_);
+    b->unref();
+    return;
+  }
+  q.push_back(b);
+  ++stats.queued;
+  if (q.size() > stats.max_depth) stats.max_depth = q.size();
+  if (tx_waiting_) {
+    tx_waiting_ = false;
+    wakeup = true;
+  }
+  os_mutex_unlock(&tx_lock_);
+  if (wakeup) tx_flow_->notify();
 }
 
 void PacketQueue::TransmitConstPacket(const uint8_t* packet) {
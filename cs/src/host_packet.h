@@ -6,6 +6,8 @@
 #include <stddef.h>
 #include <stdlib.h>
 
+#include <deque>
+
 #include "os/os.h"
 
 #include "cs_config.h"
@@ -115,6 +117,30 @@ protected:
 
 class DefaultPacketQueue : public PacketQueue, public Service {
  public:
+  //! Classes of outgoing packets. Each class has its own queue; the lower
+  //! the value, the higher the priority.
+  enum TxClass {
+    //! Responses to host commands and other control traffic.
+    TX_CONTROL = 0,
+    //! CAN bus and virtual COM bridge traffic.
+    TX_BRIDGE,
+    //! Diagnostic logs. Dropped when the queue is full.
+    TX_LOG,
+    NUM_TX_CLASSES
+  };
+
+  //! Counters for one outgoing packet class.
+  struct TxStats {
+    //! Packets accepted into the queue.
+    uint32_t queued;
+    //! Packets written to the host.
+    uint32_t sent;
+    //! Packets thrown away because the queue was full.
+    uint32_t dropped;
+    //! Largest queue length seen.
+    uint32_t max_depth;
+  };
+
   bool synced() {
     return synced_;
   }
@@ -123,8 +149,10 @@ class DefaultPacketQueue : public PacketQueue, public Service {
     return async_fd_;
   }
 
-  QAsync* outgoing_packet_queue() {
-    return &outgoing_packet_queue_;
+  //! Returns the counters of a packet class. The values are not read
+  //! atomically.
+  TxStats tx_stats(TxClass c) {
+    return tx_stats_[c];
   }
 
  private:
@@ -151,8 +179,23 @@ class DefaultPacketQueue : public PacketQueue, public Service {
     //! Set to true if the first successful sync packets are received.
     bool synced_;
 
-    //! The queue of outgoing packets (to the host).
-    QAsync outgoing_packet_queue_;
+    //! Decides which queue an outgoing packet goes to.
+    static TxClass ClassifyPacket(const PacketBase& packet);
+
+    //! Takes the next packet to send from the queues. Returns NULL if all
+    //! queues are empty. Must be called with tx_lock_ held.
+    Buffer<PacketBase>* PickNextPacket();
+
+    //! The queues of outgoing packets (to the host), one per TxClass.
+    std::deque<Buffer<PacketBase>*> tx_queue_[NUM_TX_CLASSES];
+    //! How many more packets each class may send in the current scheduling
+    //! round.
+    uint8_t tx_credit_[NUM_TX_CLASSES];
+    TxStats tx_stats_[NUM_TX_CLASSES];
+    //! Protects the tx queues, credits, stats and tx_waiting_.
+    os_mutex_t tx_lock_;
+    //! True if the TX flow is waiting for a packet to be queued.
+    bool tx_waiting_;
 
     //! Device to read/write packets from.
     int sync_fd_;
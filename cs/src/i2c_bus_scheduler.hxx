@@ -0,0 +1,216 @@
+#ifndef _BRACZ_TRAIN_I2C_BUS_SCHEDULER_HXX_
+#define _BRACZ_TRAIN_I2C_BUS_SCHEDULER_HXX_
+
+#include <vector>
+
+#include "executor/StateFlow.hxx"
+#include "src/i2c_driver.hxx"
+#include "utils/logging.h"
+
+class I2cBusScheduler;
+
+// A device on the I2C bus that is polled periodically by an
+// I2cBusScheduler. Each poll is a read transaction, optionally followed by a
+// write transaction.
+class I2cPolledDevice {
+ public:
+  // @param address is the 7-bit I2C address.
+  // @param read_len is how many bytes to read at each poll (at most
+  // I2CDriver::kMaxReadSize).
+  I2cPolledDevice(uint8_t address, uint8_t read_len)
+      : address_(address), read_len_(read_len) {
+    HASSERT(read_len <= I2CDriver::kMaxReadSize);
+  }
+
+  virtual ~I2cPolledDevice() {}
+
+  // Called with the result of the read transaction. Runs while the bus is
+  // locked, so it must not block.
+  // @param data is the read bytes, or NULL if the read failed.
+  virtual void ReadDone(const uint8_t* data) = 0;
+
+  // Fills in the bytes to write after a successful read.
+  // @return the number of bytes to write (at most I2CDriver::kMaxWriteSize),
+  // 0 to skip the write.
+  virtual unsigned FillWrite(uint8_t* buf) = 0;
+
+  // Called when the write transaction completed.
+  virtual void WriteDone(bool success) {}
+
+  // @return true if the device has results to send out (e.g. as events)
+  // after the bus was released.
+  virtual bool HasUpdate() { return false; }
+
+  // Sends out (part of) the results. Called outside of the bus lock, as long
+  // as HasUpdate() returns true.
+  // @param done must be notified when the update is sent.
+  virtual void SendUpdate(BarrierNotifiable* done) { done->notify(); }
+
+  uint8_t address() { return address_; }
+
+  // Number of successful polls.
+  uint32_t poll_count() { return poll_count_; }
+  // Number of failed reads.
+  uint32_t error_count() { return error_count_; }
+  // Time between the last two successful polls, in usec.
+  uint32_t last_interval_usec() { return last_interval_usec_; }
+  // Largest time between two successful polls since the last ResetStats().
+  uint32_t max_interval_usec() { return max_interval_usec_; }
+
+  void ResetStats() {
+    poll_count_ = 0;
+    error_count_ = 0;
+    max_interval_usec_ = 0;
+  }
+
+ private:
+  friend class I2cBusScheduler;
+
+  // Updates the statistics after a read.
+  void RecordPoll(bool success, long long now) {
+    if (!success) {
+      ++error_count_;
+      return;
+    }
+    if (last_poll_time_) {
+      uint32_t interval = (now - last_poll_time_) / 1000;
+      last_interval_usec_ = interval;
+      if (interval > max_interval_usec_) {
+        max_interval_usec_ = interval;
+      }
+    }
+    last_poll_time_ = now;
+    ++poll_count_;
+  }
+
+  uint8_t address_;
+  uint8_t read_len_;
+  uint32_t poll_count_ = 0;
+  uint32_t error_count_ = 0;
+  uint32_t last_interval_usec_ = 0;
+  uint32_t max_interval_usec_ = 0;
+  // When the last successful poll happened (os_get_time_monotonic).
+  long long last_poll_time_ = 0;
+};
+
+// Polls all registered devices on one I2C bus in a single flow. The bus mutex
+// is taken once for a batch of devices instead of once per transaction, and
+// the results are sent out after the bus was released, so that slow event
+// traffic does not hold up the bus.
+class I2cBusScheduler : public StateFlowBase {
+ public:
+  // @param driver is the I2C bus.
+  // @param service is the service to run the flow on.
+  // @param budget is how many devices to poll before releasing the bus mutex
+  // for other users.
+  // @param min_round_nsec is the minimum time between the start of two
+  // polling rounds. With 0 the devices are polled continuously.
+  I2cBusScheduler(I2CDriver* driver, Service* service, unsigned budget = 8,
+                  long long min_round_nsec = 0)
+      : StateFlowBase(service),
+        driver_(driver),
+        budget_(budget ? budget : 1),
+        min_round_nsec_(min_round_nsec),
+        timer_(this) {
+    start_flow(STATE(StartRound));
+  }
+
+  // Adds a device to poll. The caller retains ownership.
+  void AddDevice(I2cPolledDevice* device) { devices_.push_back(device); }
+
+  // Prints the poll statistics of all devices.
+  void LogStats() {
+    for (I2cPolledDevice* d : devices_) {
+      LOG(INFO,
+          "i2c 0x%02x: %u polls, %u errors, interval %u usec (max %u usec)",
+          d->address(), (unsigned)d->poll_count(), (unsigned)d->error_count(),
+          (unsigned)d->last_interval_usec(), (unsigned)d->max_interval_usec());
+    }
+  }
+
+ private:
+  Action StartRound() {
+    round_start_ = os_get_time_monotonic();
+    next_ = 0;
+    if (devices_.empty()) {
+      return sleep_and_call(&timer_, MSEC_TO_NSEC(100), STATE(StartRound));
+    }
+    return call_immediately(STATE(GetHardware));
+  }
+
+  Action GetHardware() {
+    budget_left_ = budget_;
+    return allocate_and_call(STATE(StartRead), driver_->mutex());
+  }
+
+  Action StartRead() {
+    I2cPolledDevice* d = devices_[next_];
+    driver_->StartRead(d->address_, 0, d->read_len_, this);
+    return wait_and_call(STATE(ReadDone));
+  }
+
+  Action ReadDone() {
+    I2cPolledDevice* d = devices_[next_];
+    bool success = driver_->success();
+    d->RecordPoll(success, os_get_time_monotonic());
+    d->ReadDone(success ? driver_->read_buffer() : NULL);
+    unsigned len = success ? d->FillWrite(driver_->write_buffer()) : 0;
+    if (!len) {
+      return call_immediately(STATE(DeviceDone));
+    }
+    driver_->StartWrite(d->address_, len, this);
+    return wait_and_call(STATE(WriteDone));
+  }
+
+  Action WriteDone() {
+    devices_[next_]->WriteDone(driver_->success());
+    return call_immediately(STATE(DeviceDone));
+  }
+
+  Action DeviceDone() {
+    ++next_;
+    if (next_ < devices_.size() && --budget_left_ > 0) {
+      return call_immediately(STATE(StartRead));
+    }
+    driver_->mutex()->Unlock();
+    if (next_ < devices_.size()) {
+      // Lets other users of the bus have a go before the rest of the batch.
+      return yield_and_call(STATE(GetHardware));
+    }
+    next_ = 0;
+    return call_immediately(STATE(SendUpdates));
+  }
+
+  Action SendUpdates() {
+    while (next_ < devices_.size()) {
+      I2cPolledDevice* d = devices_[next_];
+      if (d->HasUpdate()) {
+        d->SendUpdate(n_.reset(this));
+        return wait_and_call(STATE(SendUpdates));
+      }
+      ++next_;
+    }
+    long long remaining =
+        round_start_ + min_round_nsec_ - os_get_time_monotonic();
+    if (remaining > 0) {
+      return sleep_and_call(&timer_, remaining, STATE(StartRound));
+    }
+    return yield_and_call(STATE(StartRound));
+  }
+
+  I2CDriver* driver_;
+  // Devices polled before the bus mutex is released.
+  unsigned budget_;
+  // Devices left to poll with the current lock.
+  unsigned budget_left_;
+  long long min_round_nsec_;
+  // When the current round started.
+  long long round_start_;
+  // Index of the device being polled or updated.
+  size_t next_;
+  std::vector<I2cPolledDevice*> devices_;
+  BarrierNotifiable n_;
+  StateFlowTimer timer_;
+};
+
+#endif // _BRACZ_TRAIN_I2C_BUS_SCHEDULER_HXX_
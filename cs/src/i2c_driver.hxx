@@ -11,7 +11,7 @@ class Service;
 class I2CDriver : public Executable {
 public:
   static const int kMaxWriteSize = 50;
-  static const int kMaxReadSize = 4;
+  static const int kMaxReadSize = 16;
 
   I2CDriver(Service* s);
 
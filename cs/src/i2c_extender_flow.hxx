@@ -1,6 +1,7 @@
 #ifndef _BRACZ_TRAIN_I2C_EXTENDER_FLOW_HXX_
 #define _BRACZ_TRAIN_I2C_EXTENDER_FLOW_HXX_
 
+#include "src/i2c_bus_scheduler.hxx"
 #include "src/i2c_driver.hxx"
 #include "openlcb/EventHandlerTemplates.hxx"
 
@@ -15,12 +16,10 @@ class Node;
 static const int DATA_REPEAT_COUNT = 3;
 static openlcb::WriteHelper g_i2c_write_helper;
 
-class I2cExtenderBoard : public StateFlowBase {
+class I2cExtenderBoard : public I2cPolledDevice {
 public:
- I2cExtenderBoard(I2CDriver* driver, uint8_t address, openlcb::Node* node)
-     : StateFlowBase(node->interface()->dispatcher()->service()),
-       driver_(driver),
-       address_(address),
+ I2cExtenderBoard(I2cBusScheduler* bus, uint8_t address, openlcb::Node* node)
+     : I2cPolledDevice(address, 1),
        bit_pc_(node, BRACZ_LAYOUT | (address << 8), &io_store_, 24),
        signal_c_(node, (BRACZ_LAYOUT & (~0xFFFFFF)) | (address << 16),
                  signal_data_, sizeof(signal_data_)) {
@@ -30,85 +29,70 @@ public:
     HASSERT(io_data_[0] == 1);
     io_store_ = 0;
     memset(signal_data_, 1, sizeof(signal_data_));
-    start_flow(STATE(GetHardware));
+    bus->AddDevice(this);
   }
 
-  Action GetHardware() {
-    return allocate_and_call(STATE(StartReceive), driver_->mutex());
-  }
-
-  Action StartReceive() {
-    driver_->StartRead(address_, 0, 1, this);
-    return wait_and_call(STATE(ReadDone));
-  }
-
-  Action ReadDone() {
-    if (driver_->success()) {
-      if (driver_->read_buffer()[0] == new_data_) {
-        // Checks if we had enough repeats to call this data stable.
-        if (++data_count_ >= DATA_REPEAT_COUNT) {
-          // Prevents overflow.
-          data_count_ = DATA_REPEAT_COUNT;
-          return yield_and_call(STATE(UpdateIncomingData));
-        }
-      } else {
-        // Data changed, start over counting.
-        data_count_ = 0;
-        new_data_ = driver_->read_buffer()[0];
-      }
-      return yield_and_call(STATE(StartSend));
-    } else {
+  void ReadDone(const uint8_t* data) override {
+    if (!data) {
       // Failure to read, start over counting and try again later.
       resetblink(0x80000A02);
       data_count_ = 0;
-      driver_->mutex()->Unlock();
-      return yield_and_call(STATE(GetHardware));
+      return;
     }
-  }
-
-  Action UpdateIncomingData() {
-    for (int i = 0; i < 8; ++i) {
-      bool old_state = bit_pc_.Get(kReadBitOffset + i);
-      bool new_state = new_data_ & (1 << i);
-      if (new_state != old_state) {
-        bit_pc_.Set(kReadBitOffset + i, new_state, &g_i2c_write_helper,
-                    n_.reset(this));
-        return wait();
+    if (data[0] == new_data_) {
+      // Checks if we had enough repeats to call this data stable.
+      if (++data_count_ >= DATA_REPEAT_COUNT) {
+        // Prevents overflow.
+        data_count_ = DATA_REPEAT_COUNT;
       }
+    } else {
+      // Data changed, start over counting.
+      data_count_ = 0;
+      new_data_ = data[0];
     }
-    return call_immediately(STATE(StartSend));
   }
 
-  Action StartSend() {
-    uint8_t *buf = driver_->write_buffer();
+  unsigned FillWrite(uint8_t* buf) override {
     buf[0] = io_data_[0];
     buf[1] = io_data_[1];
     memcpy(buf + 2, signal_data_, sizeof(signal_data_));
-    driver_->StartWrite(address_, 2 + sizeof(signal_data_), this);
-    return wait_and_call(STATE(WriteDone));
+    return 2 + sizeof(signal_data_);
   }
 
-  Action WriteDone() {
-    if (driver_->success()) {
+  void WriteDone(bool success) override {
+    if (success) {
       resetblink(0);
     } else {
       resetblink(0x80000A02);
     }
-    driver_->mutex()->Unlock();
-    return call_immediately(STATE(GetHardware));
+  }
+
+  bool HasUpdate() override {
+    return data_count_ >= DATA_REPEAT_COUNT &&
+           io_data_[kReadByteOffset] != new_data_;
+  }
+
+  // Sends out an event for one changed input bit.
+  void SendUpdate(BarrierNotifiable* done) override {
+    for (int i = 0; i < 8; ++i) {
+      bool old_state = bit_pc_.Get(kReadBitOffset + i);
+      bool new_state = new_data_ & (1 << i);
+      if (new_state != old_state) {
+        bit_pc_.Set(kReadBitOffset + i, new_state, &g_i2c_write_helper, done);
+        return;
+      }
+    }
+    done->notify();
   }
 
 private:
   static const int kReadBitOffset = 16;
   static const int kReadByteOffset = 2;
 
-  I2CDriver* driver_;
-  // I2C target address
-  uint8_t address_;
   // Freshly read data.
-  uint8_t new_data_;
+  uint8_t new_data_ = 0;
   // How many times have we seen the same incoming data.
-  uint8_t data_count_;
+  uint8_t data_count_ = 0;
   // Stable version of the data. offset 0-1 is outgoing bit-based data; offset
   // 2 is the stable incoming data.
   union {
@@ -117,7 +101,6 @@ private:
   };
 
   uint8_t signal_data_[EXT_SIGNAL_COUNT * 2];
-  BarrierNotifiable n_;
   openlcb::BitRangeEventPC bit_pc_;
   openlcb::ByteRangeEventC signal_c_;
 };
@@ -79,6 +79,17 @@ void process_packet() {
       set_pix(aspect_to_color[aspect]);
       return g_receiver.ack();
     }
+    case SCMD_MULTI_ASPECT: {
+      // Broadcast; nobody acks, otherwise the replies would collide.
+      for (unsigned i = 2; i + 1 < g_receiver.size(); i += 2) {
+        uint8_t aspect = g_receiver.data()[i + 1];
+        if (g_receiver.data()[i] == NODEID_LOW_BITS &&
+            aspect < ARRAYSIZE(aspect_to_color)) {
+          set_pix(aspect_to_color[aspect]);
+        }
+      }
+      return;
+    }
     case SCMD_PING: {
       return g_receiver.ack();
     }
@@ -282,7 +282,9 @@ TivaGPIOConsumer led_go(BRACZ_LAYOUT | 1, BRACZ_LAYOUT | 0,  io::GoPausedLed::GP
 
 openlcb::RefreshLoop loop(stack.node(), {&sw1, &sw2});
 
-bracz_custom::AutomataControl automatas(stack.node(), stack.dg_service(), (const insn_t*) __automata_start);
+bracz_custom::AutomataControl automatas(
+    stack.node(), stack.dg_service(), (const insn_t *)__automata_start,
+    __automata_end - __automata_start);
 
 /*TivaSwitchProducer sw2(opts, openlcb::Defs::CLEAR_EMERGENCY_OFF_EVENT,
                        openlcb::Defs::EMERGENCY_OFF_EVENT,
@@ -301,7 +303,12 @@ commandstation::TrainDb train_db(cfg.trains().all_trains());
 CanIf can1_interface(stack.service(), &can_hub1);
 mobilestation::MobileStationTraction mosta_traction(&can1_interface, stack.iface(), &train_db, stack.node());
 
-commandstation::AllTrainNodes all_trains(&train_db, &traction_service, stack.info_flow(), stack.memory_config_handler());
+// Train nodes are created on demand, and taken off the bus (freeing their RAM
+// and alias) after five idle minutes.
+commandstation::AllTrainNodes all_trains(&train_db, &traction_service,
+                                         stack.info_flow(),
+                                         stack.memory_config_handler(),
+                                         SEC_TO_NSEC(300));
 
 openlcb::TractionCvSpace traction_cv(stack.memory_config_handler(), &track_if, &railcom_hub, openlcb::MemoryConfigDefs::SPACE_DCC_CV);
 
@@ -389,6 +396,11 @@ int appl_main(int argc, char* argv[])
     openlcb::BitEventConsumer consumer(&logger);
 
     stack.memory_config_handler()->registry()->insert(stack.node(), 0xA0, &automata_space);
+    // Waveforms around the last track and accessory trips.
+    stack.memory_config_handler()->registry()->insert(
+        stack.node(), 0xA1, g_short_detector.capture_space());
+    stack.memory_config_handler()->registry()->insert(
+        stack.node(), 0xA2, g_acc_short_detector.capture_space());
 
 
 #ifdef STANDALONE
@@ -352,6 +352,9 @@ int appl_main(int argc, char* argv[])
     setblink(0x800A02);
 
     stack.check_version_and_factory_reset(cfg.seg().internal_config(), openlcb::CANONICAL_VERSION, false);
+    // Waveform around the last track trip.
+    stack.memory_config_handler()->registry()->insert(
+        stack.node(), 0xA1, g_short_detector.capture_space());
 
 
 #ifdef STANDALONE
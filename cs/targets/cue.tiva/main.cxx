@@ -175,7 +175,9 @@ void adc0_seq2_interrupt_handler(void) {
 
 openlcb::RefreshLoop loop(stack.node(), {&sw1, &sw2});
 
-bracz_custom::AutomataControl automatas(stack.node(), stack.dg_service(), (const insn_t*) __automata_start);
+bracz_custom::AutomataControl automatas(
+    stack.node(), stack.dg_service(), (const insn_t *)__automata_start,
+    __automata_end - __automata_start);
 
 #ifdef HAVE_ACCPOWER
 
@@ -44,6 +44,7 @@ CDI_GROUP_ENTRY(address, openlcb::Uint16ConfigEntry, Name("Cab number"),
                     "Reports this address to the OpenLCB bus in order to be "
                     "acquired by throttles using the numeric keypad."),
                 Default(11000));
+CDI_GROUP_ENTRY(load_control_mode, FeedbackMode);
 CDI_GROUP_END();
 
 CDI_GROUP(DynamicSegment, Segment(DYNAMIC_SEGMENT_ID), Offset(0),
@@ -85,7 +86,7 @@ namespace openlcb {
 extern const SimpleNodeStaticValues SNIP_STATIC_DATA = {
     4, "Balazs Racz", "Dead-rail train", "ESP12", "0.1"};
 
-static const uint16_t EXPECTED_VERSION = 0x1bd6;
+static const uint16_t EXPECTED_VERSION = 0x1bd7;
 
 /// The main structure of the CDI. ConfigDef is the symbol we use in main.cxx
 /// to refer to the configuration defined here.
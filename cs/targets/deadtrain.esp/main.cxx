@@ -91,13 +91,15 @@ class SpeedController : public StateFlow<Buffer<SpeedRequest>, QList<2>>,
  public:
   static constexpr uint64_t ADC_REPORT_EVENT = UINT64_C(0x9000000000000000);
 
-  SpeedController(Service *s, MotorControl mpar)
+  SpeedController(Service *s, MotorControl mpar, FeedbackMode fbmode)
       : StateFlow<Buffer<SpeedRequest>, QList<2>>(s),
         mpar_(mpar),
+        feedbackController_(mpar_.load_control(), fbmode),
         isMoving_(0),
         lastDirMotAHi_(0),
         enableKick_(0),
-        kickRunning_(0) {
+        kickRunning_(0),
+        saveScheduled_(0) {
     HW::MOT_A_HI_Pin::set_off();
     HW::MOT_B_HI_Pin::set_off();
     pwm_.enable();
@@ -267,6 +269,14 @@ class SpeedController : public StateFlow<Buffer<SpeedRequest>, QList<2>>,
     currentPower_ = feedbackController_.measure_tick(lastAdc_);
     long long fill = power_to_fill_rate(currentPower_, period_);
     pwm_.old_set_state(lo_pin, period_, fill);
+    if (feedbackController_.save_pending() && !saveScheduled_) {
+      // Writes the auto-tuning results outside of the PWM cycle.
+      saveScheduled_ = 1;
+      service()->executor()->add(new CallbackExecutable([this]() {
+        feedbackController_.save_tuning();
+        saveScheduled_ = 0;
+      }));
+    }
     // if (v < 0x10) {
     //  call_kick();
     //} else {
@@ -347,7 +357,7 @@ class SpeedController : public StateFlow<Buffer<SpeedRequest>, QList<2>>,
   long long kickDurationNsec_ = 0;
   /// How much time to wait between motor kicks.
   long long kickDelayNsec_ = 0;
-  SpeedFeedbackController feedbackController_{mpar_.load_control()};
+  SpeedFeedbackController feedbackController_;
   /// Last set speed
   openlcb::SpeedType lastSetSpeed_;
   /// Helper class to control the hardware timer.
@@ -362,6 +372,8 @@ class SpeedController : public StateFlow<Buffer<SpeedRequest>, QList<2>>,
   unsigned enableKick_ : 1;
   /// 1 if the kick timer is running.
   unsigned kickRunning_ : 1;
+  /// 1 if saving the auto-tuning results is already queued on the executor.
+  unsigned saveScheduled_ : 1;
 
   /// last ADC value
   uint16_t lastAdc_;
@@ -498,7 +510,8 @@ extern const char *const SNIP_DYNAMIC_FILENAME = CONFIG_FILENAME;
 }  // namespace openlcb
 
 openlcb::SimpleTrainCanStack stack(&trainImpl, kFdiXml, NODE_ID);
-SpeedController g_speed_controller(stack.service(), cfg.seg().motor_control());
+SpeedController g_speed_controller(stack.service(), cfg.seg().motor_control(),
+                                   cfg.seg().load_control_mode());
 
 class DbEntry : public commandstation::ExternalTrainDbEntry, private DefaultConfigUpdateListener {
  public:
@@ -46,7 +46,8 @@
 #include "dcc/FakeTrackIf.hxx"
 #include "executor/PoolToQueueFlow.hxx"
 #include "custom/LoggingBit.hxx"
-#include "openlcb/TractionCvSpace.hxx"
+#include "commandstation/DecoderCvCache.hxx"
+#include "commandstation/ProgrammingTrackCVSpace.hxx"
 
 static const openlcb::NodeID NODE_ID = 0x050101011440ULL;
 openlcb::SimpleCanStack stack(NODE_ID);
@@ -226,7 +227,15 @@ commandstation::TrainDb train_db;
 commandstation::AllTrainNodes all_train_nodes(&train_db, &traction_service, stack.info_flow(), stack.memory_config_handler());
 
 dcc::RailcomHubFlow railcom_hub(stack.service());
-openlcb::TractionCvSpace traction_cv(stack.memory_config_handler(), &track_if, &railcom_hub, openlcb::MemoryConfigDefs::SPACE_DCC_CV);
+
+// There is no programming track here, only POM. This space serves the DCC CV
+// memory space for the train nodes too, so there is no TractionCvSpace.
+commandstation::ProgrammingTrackFrontend prog_track_frontend(
+    nullptr, &track_if, &railcom_hub);
+commandstation::ProgrammingTrackCVSpace prog_track_cv_space(
+    stack.memory_config_handler(), &prog_track_frontend, stack.node());
+// Remembered CV values survive restarts in the working directory.
+commandstation::DecoderCvCache cv_cache("decoder_cv_cache.bin");
 
 /** Entry point to application.
  * @param argc number of command line arguments
@@ -234,6 +243,7 @@ openlcb::TractionCvSpace traction_cv(stack.memory_config_handler(), &track_if, &
  * @return 0, should never return
  */
 int appl_main(int argc, char* argv[]) {
+  prog_track_cv_space.set_cv_cache(&cv_cache);
   stack.connect_tcp_gridconnect_hub("localhost", 12021);
 
   stack.loop_executor();
@@ -253,6 +253,13 @@ logic::OlcbVariableFactory logic_blocks(stack.node(), cfg.seg().logic());
  */
 int appl_main(int argc, char *argv[])
 {
+    // Event reports from the logic blocks are sent in one burst after each
+    // tick instead of waiting for each write to go through loopback.
+    logic_blocks.set_async_writes(true);
+    // Variables created by a compile query their state in pipelined bursts
+    // instead of waiting for each query's loopback.
+    logic_blocks.set_bulk_queries(true);
+
     stack.create_config_file_if_needed(cfg.seg().internal_config(),
                                        openlcb::CANONICAL_VERSION,
                                        openlcb::CONFIG_FILE_SIZE);
@@ -92,7 +92,8 @@ private:
 };
 
 I2CDriver g_i2c_driver(&g_service);
-I2cExtenderBoard brd_22(&g_i2c_driver, 0x22, &g_node);
+I2cBusScheduler g_i2c_bus(&g_i2c_driver, &g_service);
+I2cExtenderBoard brd_22(&g_i2c_bus, 0x22, &g_node);
 
 /** Entry point to application.
  * @param argc number of command line arguments
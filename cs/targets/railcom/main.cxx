@@ -51,7 +51,7 @@
 
 #include "config.hxx"
 #include "commandstation/RailcomBroadcastFlow.hxx"
-#include "custom/DetectorPort.hxx"
+#include "custom/DetectorBank.hxx"
 #include "custom/TivaDAC.hxx"
 #include "custom/TivaGNDControl.hxx"
 #include "freertos_drivers/common/BlinkerGPIO.hxx"
@@ -350,7 +350,7 @@ public:
 
 #endif
 
-bracz_custom::DetectorPort* pports = nullptr;
+bracz_custom::DetectorBank<6>* pports = nullptr;
 
 class WatchForDccSignal : public StateFlowBase {
  public:
@@ -367,16 +367,11 @@ class WatchForDccSignal : public StateFlowBase {
     unsigned current_sample_count = DCCDecode::sampleCount_;
     if (current_sample_count >= lastSampleCount_) {
       unsigned diff = current_sample_count - lastSampleCount_;
-      constexpr auto num_channel = cfg.seg().detectors().num_repeats();
       if (diff >= SAMPLE_THRESHOLD) {
         HaveDccSignalPin::set(true);
-        for (unsigned i = 0; i < num_channel; ++i) {
-          pports[i].set_have_dcc_signal(true);
-        }
+        pports->set_have_dcc_signal(true);
       } else {
-        for (unsigned i = 0; i < num_channel; ++i) {
-          pports[i].set_have_dcc_signal(false);
-        }
+        pports->set_have_dcc_signal(false);
         HaveDccSignalPin::set(false);
       }
     }
@@ -504,21 +499,15 @@ int appl_main(int argc, char* argv[]) {
       cfg.dev().current().overcurrent().count_total().read(fd),
       cfg.dev().current().overcurrent().min_active().read(fd)};
 
-  static bracz_custom::DetectorPort ports[6] = {
-      {stack.node(), 0, fd, cfg.seg().detectors().entry<0>(), opts},
-      {stack.node(), 1, fd, cfg.seg().detectors().entry<1>(), opts},
-      {stack.node(), 2, fd, cfg.seg().detectors().entry<2>(), opts},
-      {stack.node(), 3, fd, cfg.seg().detectors().entry<3>(), opts},
-      {stack.node(), 4, fd, cfg.seg().detectors().entry<4>(), opts},
-      {stack.node(), 5, fd, cfg.seg().detectors().entry<5>(), opts},
-  };
+  static bracz_custom::DetectorBank<6> ports(stack.node(), fd,
+                                             cfg.seg().detectors(), opts);
 
-  pports = ports;
+  pports = &ports;
 
   auto occupancy_proxy =
-      [](unsigned ch, bool value) { pports[ch].set_occupancy(value); };
+      [](unsigned ch, bool value) { pports->set_occupancy(ch, value); };
   auto overcurrent_proxy =
-      [](unsigned ch, bool value) { pports[ch].set_overcurrent(value); };
+      [](unsigned ch, bool value) { pports->set_overcurrent(ch, value); };
 
   static RailcomOccupancyDecoder<CountingDebouncer> occ_decoder(
       0xff, 6, occupancy_proxy, occupancy_debouncer_opts);
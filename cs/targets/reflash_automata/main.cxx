@@ -35,6 +35,9 @@
 #include <stdio.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "openlcb/SimpleStack.hxx"
 #include "openlcb/SimpleNodeInfoMockUserFile.hxx"
 #include "custom/AutomataControl.hxx"
@@ -60,12 +63,14 @@ const char *filename = "automata.bin";
 uint64_t destination_nodeid = 0x050101011432ULL;
 unsigned destination_alias = 0;
 int space_id = 0xA0;
+bool delta = false;
 OVERRIDE_CONST(num_memory_spaces, 4);
 
 void usage(const char *e) {
   fprintf(stderr,
           "Usage: %s ([-i destination_host] [-p port] | [-d device_path]) "
-          "[(-n nodeid | -a alias)] [-w automata_write_file] [-s space_id]\n",
+          "[(-n nodeid | -a alias)] [-w automata_write_file] [-s space_id] "
+          "[-D]\n",
           e);
   fprintf(stderr,
           "Connects to an openlcb bus and reflashes a memory config block "
@@ -89,12 +94,16 @@ void usage(const char *e) {
   fprintf(
       stderr,
       "\nspace_id is the memory space to write to. Defaults to '-s 0xA0'\n");
+  fprintf(stderr,
+          "\n-D only writes the 64-byte blocks that differ from the image "
+          "currently on the node, and verifies the result. Falls back to a "
+          "full write if the node cannot report block hashes.\n");
   exit(1);
 }
 
 void parse_args(int argc, char *argv[]) {
   int opt;
-  while ((opt = getopt(argc, argv, "hi:p:d:n:a:w:s:")) >= 0) {
+  while ((opt = getopt(argc, argv, "hi:p:d:n:a:w:s:D")) >= 0) {
     switch (opt) {
       case 'h':
         usage(argv[0]);
@@ -120,6 +129,9 @@ void parse_args(int argc, char *argv[]) {
       case 's':
         space_id = atoi(optarg);
         break;
+      case 'D':
+        delta = true;
+        break;
       default:
         fprintf(stderr, "Unknown option %c\n", opt);
         usage(argv[0]);
@@ -152,7 +164,11 @@ double get_time() {
     return t * 1.0 / 1e9;
 }
 
-uint8_t send_datagram(openlcb::DatagramPayload p) {
+/// Sends a datagram to the destination node and waits for it to be accepted.
+/// @param rejected if not null, a rejection sets it to true instead of
+/// terminating the program.
+/// @return the reply flags.
+uint8_t send_datagram(openlcb::DatagramPayload p, bool *rejected = nullptr) {
   SyncNotifiable n;
   BarrierNotifiable bn;
 
@@ -176,6 +192,11 @@ uint8_t send_datagram(openlcb::DatagramPayload p) {
 
   if ((client->result() & openlcb::DatagramClient::RESPONSE_CODE_MASK) !=
       openlcb::DatagramClient::OPERATION_SUCCESS) {
+    if (rejected) {
+      *rejected = true;
+      stack.dg_service()->client_allocator()->typed_insert(client);
+      return 0;
+    }
     LOG(FATAL, "Datagram send failed: %04x\n", client->result());
     exit(1);
   }
@@ -222,6 +243,101 @@ class WriteResponseHandler : public openlcb::DefaultDatagramHandler {
     openlcb::NodeHandle dst_;
 };
 
+class HashResponseHandler : public openlcb::DefaultDatagramHandler {
+ public:
+  HashResponseHandler()
+      : DefaultDatagramHandler(stack.dg_service()) {
+    dst_.alias = destination_alias;
+    dst_.id = destination_nodeid;
+    dg_service()->registry()->insert(
+        stack.node(), bracz_custom::AutomataDefs::RESPONSE_CODE, this);
+  }
+
+  Action entry() override {
+    openlcb::IncomingDatagram *datagram = message()->data();
+    if (datagram->dst != stack.node() ||
+        !stack.node()->iface()->matching_node(dst_, datagram->src) ||
+        datagram->payload.size() < 7 ||
+        (uint8_t)datagram->payload[1] !=
+            bracz_custom::AutomataDefs::GET_BLOCK_HASHES) {
+      return respond_reject(DatagramDefs::PERMANENT_ERROR);
+    }
+    response_ = datagram->payload;
+    return respond_ok(DatagramDefs::FLAGS_NONE);
+  }
+
+  Action ok_response_sent() override {
+    n.notify();
+    return release_and_exit();
+  }
+
+  SyncNotifiable n;
+  /// Payload of the last hash response.
+  string response_;
+
+ private:
+  openlcb::NodeHandle dst_;
+};
+
+/// Asks the node for the hashes of the automata image blocks.
+/// @param size is the number of bytes to cover, from offset 0.
+/// @param hashes will get one entry per block.
+/// @return false if the node does not support the request.
+bool get_block_hashes(HashResponseHandler *handler, unsigned size,
+                      std::vector<uint32_t> *hashes) {
+  using bracz_custom::AutomataDefs;
+  static const unsigned chunk =
+      AutomataDefs::MAX_HASH_BLOCKS * AutomataDefs::HASH_BLOCK_SIZE;
+  hashes->clear();
+  for (unsigned ofs = 0; ofs < size; ofs += chunk) {
+    unsigned len = std::min(size - ofs, chunk);
+    openlcb::DatagramPayload p;
+    p.push_back(AutomataDefs::DATAGRAM_CODE);
+    p.push_back(AutomataDefs::GET_BLOCK_HASHES);
+    for (int b = 24; b >= 0; b -= 8) {
+      p.push_back((ofs >> b) & 0xff);
+    }
+    p.push_back(len >> 8);
+    p.push_back(len & 0xff);
+    bool rejected = false;
+    uint8_t flag = send_datagram(std::move(p), &rejected);
+    if (rejected || !(flag & openlcb::DatagramClient::REPLY_PENDING)) {
+      return false;
+    }
+    handler->n.wait_for_notification();
+    const string &r = handler->response_;
+    unsigned count = (uint8_t)r[6];
+    if (r.size() < 7 + count * 4 ||
+        count != (len + AutomataDefs::HASH_BLOCK_SIZE - 1) /
+                     AutomataDefs::HASH_BLOCK_SIZE) {
+      // The node's automata area is smaller than the image.
+      return false;
+    }
+    for (unsigned i = 0; i < count; ++i) {
+      uint32_t h = 0;
+      for (unsigned b = 0; b < 4; ++b) {
+        h = (h << 8) | (uint8_t)r[7 + i * 4 + b];
+      }
+      hashes->push_back(h);
+    }
+  }
+  return true;
+}
+
+/// @return the hash of each block of the image.
+std::vector<uint32_t> image_block_hashes(const string &data) {
+  using bracz_custom::AutomataDefs;
+  std::vector<uint32_t> ret;
+  for (unsigned ofs = 0; ofs < data.size();
+       ofs += AutomataDefs::HASH_BLOCK_SIZE) {
+    unsigned len = std::min((unsigned)data.size() - ofs,
+                            (unsigned)AutomataDefs::HASH_BLOCK_SIZE);
+    ret.push_back(AutomataDefs::block_hash(
+        (const uint8_t *)data.data() + ofs, len));
+  }
+  return ret;
+}
+
 int appl_main(int argc, char *argv[]) {
   parse_args(argc, argv);
 
@@ -236,6 +352,37 @@ int appl_main(int argc, char *argv[]) {
   stack.start_executor_thread("g_executor", 0, 0);
   while (!stack.node()->is_initialized()) usleep(1000);
 
+  static const uint32_t buflen = 64;
+  static_assert(buflen == bracz_custom::AutomataDefs::HASH_BLOCK_SIZE,
+                "writes must line up with the hashed blocks");
+  HashResponseHandler hash_handler;
+  std::vector<uint32_t> image_hashes = image_block_hashes(file_data);
+  // Which blocks to write. Without -D, all of them.
+  std::vector<bool> changed(image_hashes.size(), true);
+  if (delta && space_id != 0xA0) {
+    // The node only hashes the automata image.
+    LOG(WARNING, "-D only works for space 0xA0, writing everything.");
+    delta = false;
+  }
+  if (delta) {
+    std::vector<uint32_t> node_hashes;
+    if (get_block_hashes(&hash_handler, file_data.size(), &node_hashes)) {
+      unsigned num_changed = 0;
+      for (unsigned i = 0; i < changed.size(); ++i) {
+        changed[i] = node_hashes[i] != image_hashes[i];
+        if (changed[i]) ++num_changed;
+      }
+      LOG(INFO, "%u of %u blocks changed.", num_changed,
+          (unsigned)changed.size());
+      if (!num_changed) {
+        return 0;
+      }
+    } else {
+      LOG(WARNING, "Node does not report block hashes, writing everything.");
+      delta = false;
+    }
+  }
+
   openlcb::DatagramPayload p;
   p.push_back(bracz_custom::AutomataDefs::DATAGRAM_CODE);
   p.push_back(bracz_custom::AutomataDefs::STOP_AUTOMATA);
@@ -244,8 +391,8 @@ int appl_main(int argc, char *argv[]) {
   WriteResponseHandler response_handler;
   Ewma ewma(0.8);
 
-  static const uint32_t buflen = 64;
   for (unsigned ofs = 0; ofs < file_data.size(); ofs += buflen) {
+    if (!changed[ofs / buflen]) continue;
     openlcb::DatagramPayload p =
         openlcb::MemoryConfigDefs::write_datagram(space_id, ofs);
     p.append(file_data.substr(ofs, buflen));
@@ -259,6 +406,16 @@ int appl_main(int argc, char *argv[]) {
     LOG(INFO, "ofs %u speed %.0f bytes/sec", ofs, ewma.avg());
   }
 
+  if (delta) {
+    std::vector<uint32_t> node_hashes;
+    if (!get_block_hashes(&hash_handler, file_data.size(), &node_hashes) ||
+        node_hashes != image_hashes) {
+      // Leaves the automata stopped; running a corrupt image is worse.
+      LOG_ERROR("Verification of the written image failed.");
+      return 1;
+    }
+  }
+
   p.clear();
   p.push_back(bracz_custom::AutomataDefs::DATAGRAM_CODE);
   p.push_back(bracz_custom::AutomataDefs::RESTART_AUTOMATA);